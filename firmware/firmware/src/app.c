@@ -55,6 +55,7 @@
 #include "app.h"
 #include "definitions.h"
 #include "app_ble.h"
+#include "app_console.h"
 #include "click_routines/oled_c/oled_c.h"
 #include "ble_trsps/ble_trsps.h"
 #include <stdio.h>
@@ -110,6 +111,11 @@ APP_DATA appData;
 /* TODO:  Add any necessary local functions.
 */
 
+static uint32_t APP_Milliseconds(void)
+{
+    return xTaskGetTickCount() * portTICK_PERIOD_MS;
+}
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -131,6 +137,15 @@ void APP_Initialize ( void )
     appData.state = APP_STATE_INIT;
     
     appData.appQueue = xQueueCreate( 64, sizeof(APP_Msg_T) );
+
+    /* the generated Legato_Initialize passes the empty GPU interface, fills
+       and copies are handed to the SSD1351 driver from here so regenerating
+       the Legato code doesn't drop them */
+    leRenderer_SetGPUInterface(&gfxSSD1351GPUInterface);
+
+    /* the widget update rate limit measures its frame period with this */
+    leCommand_SetClock(APP_Milliseconds);
+
     /* TODO: Initialize your application's state machine and other
      * parameters.
      */
@@ -163,6 +178,7 @@ void APP_Tasks ( void )
             BLE_GAP_SetAdvEnable(0x01, 0);
             SERCOM0_USART_Write((uint8_t *)"WBZ451_OLED_BLE_UART\r\n",24);
             writeConsoleHandle=SYS_CONSOLE_HandleGet(SYS_CONSOLE_INDEX_0);
+            APP_CONSOLE_Initialize();
             
             if (appInitialized)
             {
@@ -192,6 +208,10 @@ void APP_Tasks ( void )
                     // Pass BLE LOG Event Message to User Application for handling
                     APP_BleStackLogHandler((BT_SYS_LogEvent_T *)p_appMsg->msgData);
                 }
+                else if(p_appMsg->msgId==APP_MSG_CONSOLE_EVT)
+                {
+                    APP_CONSOLE_Handler();
+                }
                 else if( p_appMsg->msgId == APP_MSG_OLEDC_EVT)
                 {
                     APP_OLEDC_Handler((uint8_t *)(p_appMsg->msgData));
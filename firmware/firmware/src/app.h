@@ -101,6 +101,7 @@ typedef enum APP_MsgId_T
     APP_MSG_BLE_STACK_LOG,
     APP_MSG_BLE_DISPLAY_EVT,
     APP_MSG_OLEDC_EVT,
+    APP_MSG_CONSOLE_EVT,
     APP_MSG_ZB_STACK_EVT,
     APP_MSG_ZB_STACK_CB,
     APP_MSG_STACK_END
@@ -0,0 +1,563 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  Application Console Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_console.c
+
+  Summary:
+    Single key diagnostic commands on the debug console.
+
+  Description:
+    d - print the renderer damage report
+    r - reset the renderer damage and widget command statistics
+    p - print the renderer profile in microseconds
+    c - clear the renderer profile
+    a - apply the recommended scratch size with band splitting
+    b - band splitting at the full scratch size
+    h - default (halving) splitting at the full scratch size
+    i - cycle the scratch format, RGB565, 4bpp gray, 1bpp and 8bpp global
+        palette
+    f - cycle the widget update rate limit
+    ? - list the commands
+ *******************************************************************************/
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdarg.h>
+#include <stdio.h>
+#include "app_console.h"
+#include "app.h"
+#include "definitions.h"
+#include "system/console/sys_console.h"
+#include "osal/osal_freertos_extend.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Macros
+// *****************************************************************************
+// *****************************************************************************
+
+#define APP_CONSOLE_LINE_SIZE           96
+
+/* column address, page address and write RAM commands with their
+   parameters, sent by the SSD1351 driver ahead of every blit */
+#define APP_CONSOLE_BLIT_CMD_BYTES      7
+
+#define APP_CONSOLE_SCRATCH_BUDGET      (LE_SCRATCH_BUFFER_SIZE_KB * 1024)
+
+/* the renderer profile is sampled from the DWT cycle counter */
+#define APP_CONSOLE_CYCLES_PER_US       (CPU_CLOCK_FREQUENCY / 1000000u)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Variables
+// *****************************************************************************
+// *****************************************************************************
+
+static SYS_CONSOLE_HANDLE consoleHandle = SYS_CONSOLE_HANDLE_INVALID;
+
+/* set from the receive interrupt, cleared once the task has drained the
+   input, keeps at most one console message in the application queue */
+static volatile bool consoleEvtPending;
+
+static uint32_t scratchSize = APP_CONSOLE_SCRATCH_BUDGET;
+static leScratchSplit scratchSplit = LE_SCRATCH_SPLIT_DEFAULT;
+
+/* RGB565 palettes for the indexed scratch formats, the global palette
+   covers the 8bpp case */
+static const uint16_t grayPaletteData[16] =
+{
+    0x0000,0x1082,0x2104,0x3186,0x4228,0x52AA,0x632C,0x73AE,
+    0x8C51,0x9CD3,0xAD55,0xBDD7,0xCE79,0xDEFB,0xEF7D,0xFFFF,
+};
+
+static const uint16_t monoPaletteData[2] =
+{
+    0x0000,0xFFFF,
+};
+
+static const lePalette grayPalette =
+{
+    {
+        LE_STREAM_LOCATION_ID_INTERNAL,
+        (void*)grayPaletteData,
+        sizeof(grayPaletteData),
+    },
+    16,
+    LE_COLOR_MODE_RGB_565
+};
+
+static const lePalette monoPalette =
+{
+    {
+        LE_STREAM_LOCATION_ID_INTERNAL,
+        (void*)monoPaletteData,
+        sizeof(monoPaletteData),
+    },
+    2,
+    LE_COLOR_MODE_RGB_565
+};
+
+static const struct
+{
+    const char* name;
+    const lePalette* palette;
+} scratchFormats[] =
+{
+    { "rgb565", NULL },
+    { "4bpp gray", &grayPalette },
+    { "1bpp mono", &monoPalette },
+    { "8bpp global", &leGlobalPalette },
+};
+
+static uint32_t scratchFormat;
+
+/* widget update rate limits, 0 is unlimited */
+static const uint32_t frameRates[] = { LE_COMMAND_MAX_FPS, 10, 60, 0 };
+
+static uint32_t frameRate;
+
+static const char* const profileStageNames[LE_PROFILE_WIDGET] =
+{
+    "frame",
+    "preframe",
+    "prelayer",
+    "prerect",
+    "prewidget",
+    "drawing",
+    "postwidget",
+    "postrect",
+    "waitbuffer",
+    "postlayer",
+    "postframe",
+    "blit",
+    "latency",
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Functions
+// *****************************************************************************
+// *****************************************************************************
+
+static void APP_CONSOLE_ReadCallback(SERCOM_USART_EVENT event, uintptr_t context)
+{
+    static APP_Msg_T consoleMsg;
+
+    (void)context;
+
+    if(event != SERCOM_USART_EVENT_READ_THRESHOLD_REACHED &&
+       event != SERCOM_USART_EVENT_READ_BUFFER_FULL)
+        return;
+
+    if(consoleEvtPending == true)
+        return;
+
+    consoleEvtPending = true;
+    consoleMsg.msgId = APP_MSG_CONSOLE_EVT;
+
+    if(OSAL_QUEUE_SendISR(&appData.appQueue, &consoleMsg) != OSAL_RESULT_TRUE)
+    {
+        consoleEvtPending = false;
+    }
+}
+
+void APP_CONSOLE_Print(const char* format, ...)
+{
+    char line[APP_CONSOLE_LINE_SIZE];
+    va_list args;
+    int len;
+
+    va_start(args, format);
+    len = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+
+    if(len <= 0)
+        return;
+
+    if(len >= (int)sizeof(line))
+    {
+        len = sizeof(line) - 1;
+    }
+
+    /* the console write is not blocking and drops what doesn't fit */
+    while(SYS_CONSOLE_WriteFreeBufferCountGet(consoleHandle) < len)
+    {
+        vTaskDelay(1);
+    }
+
+    SYS_CONSOLE_Write(consoleHandle, line, len);
+}
+
+static uint32_t APP_CONSOLE_RecommendScratchSize(const leDamageStats* stats)
+{
+    uint32_t i;
+    uint32_t best = UINT32_MAX;
+    uint32_t size = APP_CONSOLE_SCRATCH_BUDGET;
+
+    /* fewest blits within the RAM budget, then the least RAM for that */
+    for(i = 0; i < LE_DAMAGE_CANDIDATE_COUNT; i++)
+    {
+        if(stats->candidateSize[i] > APP_CONSOLE_SCRATCH_BUDGET)
+            break;
+
+        if(stats->candidateBlitCount[i] < best)
+        {
+            best = stats->candidateBlitCount[i];
+            size = stats->candidateSize[i];
+        }
+    }
+
+    return size;
+}
+
+/* painted pixels per damaged pixel in hundredths */
+static uint32_t APP_CONSOLE_Overdraw(const leDamageStats* stats)
+{
+    if(stats->pixelCount == 0)
+    {
+        return 0;
+    }
+
+    return (uint32_t)(((uint64_t)stats->paintPixelCount * 100u) / stats->pixelCount);
+}
+
+static void APP_CONSOLE_RendererReport(void)
+{
+    leDamageStats stats;
+    uint32_t overdraw;
+    uint32_t i;
+
+    if(leRenderer_GetDamageStats(&stats) == LE_FAILURE)
+    {
+        APP_CONSOLE_Print("damage stats compiled out, set LE_RENDERER_DAMAGE_STATS to 1\r\n");
+        return;
+    }
+
+    APP_CONSOLE_Print("frames %lu rects %lu blits %lu pixels %lu\r\n",
+                      (unsigned long)stats.frameCount,
+                      (unsigned long)stats.damageRectCount,
+                      (unsigned long)stats.blitCount,
+                      (unsigned long)stats.pixelCount);
+
+    overdraw = APP_CONSOLE_Overdraw(&stats);
+
+    APP_CONSOLE_Print("overdraw %lu.%02lu avg %lu.%02lu last %lu.%02lu max, %lu paints culled\r\n",
+                      (unsigned long)(overdraw / 100),
+                      (unsigned long)(overdraw % 100),
+                      (unsigned long)(stats.lastOverdraw / 100),
+                      (unsigned long)(stats.lastOverdraw % 100),
+                      (unsigned long)(stats.maxOverdraw / 100),
+                      (unsigned long)(stats.maxOverdraw % 100),
+                      (unsigned long)stats.culledPaintCount);
+
+    APP_CONSOLE_Print("scratch %luB of %luB x%u, %s, %s split, cmd bytes %lu\r\n",
+                      (unsigned long)scratchSize,
+                      (unsigned long)APP_CONSOLE_SCRATCH_BUDGET,
+                      LE_SCRATCH_BUFFER_COUNT,
+                      scratchFormats[scratchFormat].name,
+                      scratchSplit == LE_SCRATCH_SPLIT_BANDS ? "band" : "default",
+                      (unsigned long)(stats.blitCount * APP_CONSOLE_BLIT_CMD_BYTES));
+
+    for(i = 0; i < LE_DAMAGE_HISTOGRAM_SIZE; i++)
+    {
+        APP_CONSOLE_Print("  area %s%5lu px: %lu\r\n",
+                          i < LE_DAMAGE_HISTOGRAM_SIZE - 1 ? "<=" : "> ",
+                          (unsigned long)(64u << (i < LE_DAMAGE_HISTOGRAM_SIZE - 1 ? i : i - 1)),
+                          (unsigned long)stats.histogram[i]);
+    }
+
+    for(i = 0; i < LE_DAMAGE_CANDIDATE_COUNT; i++)
+    {
+        APP_CONSOLE_Print("  scratch %5luB: %lu blits, %lu cmd bytes%s\r\n",
+                          (unsigned long)stats.candidateSize[i],
+                          (unsigned long)stats.candidateBlitCount[i],
+                          (unsigned long)(stats.candidateBlitCount[i] * APP_CONSOLE_BLIT_CMD_BYTES),
+                          stats.candidateSize[i] > APP_CONSOLE_SCRATCH_BUDGET ? " (over budget)" : "");
+    }
+
+    APP_CONSOLE_Print("recommended: %luB band split\r\n",
+                      (unsigned long)APP_CONSOLE_RecommendScratchSize(&stats));
+}
+
+static void APP_CONSOLE_DamageReport(void)
+{
+    gfxIOCTLArg_TransferStats transfer;
+    leCommandStats commands;
+#if LE_IMAGE_CACHE_ENABLED == 1
+    leImageCacheStats images;
+#endif
+#if LE_STRING_CACHE_ENABLED == 1
+    leStringCacheStats strings;
+#endif
+
+    APP_CONSOLE_RendererReport();
+
+    if(DRV_SSD1351_IOCTL(GFX_IOCTL_GET_TRANSFER_STATS, &transfer) == GFX_IOCTL_OK)
+    {
+        APP_CONSOLE_Print("display sent %luB skipped %luB, %lu blits skipped\r\n",
+                          (unsigned long)transfer.bytesSent,
+                          (unsigned long)transfer.bytesSkipped,
+                          (unsigned long)transfer.blitsSkipped);
+    }
+
+    leCommand_GetStats(&commands);
+
+    APP_CONSOLE_Print("commands %lu full %lu merged %lu applied %lu in %lu batches\r\n",
+                      (unsigned long)commands.queued,
+                      (unsigned long)commands.full,
+                      (unsigned long)commands.merged,
+                      (unsigned long)commands.applied,
+                      (unsigned long)commands.batches);
+
+#if LE_IMAGE_CACHE_ENABLED == 1
+    leImageCache_GetStats(&images);
+
+    APP_CONSOLE_Print("image cache %lu hits %lu misses %lu evictions %lu B\r\n",
+                      (unsigned long)images.hits,
+                      (unsigned long)images.misses,
+                      (unsigned long)images.evictions,
+                      (unsigned long)images.bytes);
+#endif
+
+#if LE_STRING_CACHE_ENABLED == 1
+    leStringCache_GetStats(&strings);
+
+    APP_CONSOLE_Print("string cache %lu hits %lu misses %lu evictions %lu B\r\n",
+                      (unsigned long)strings.hits,
+                      (unsigned long)strings.misses,
+                      (unsigned long)strings.evictions,
+                      (unsigned long)strings.bytes);
+#endif
+}
+
+#if LE_RENDERER_PROFILE == 1
+static uint32_t APP_CONSOLE_Cycles(void)
+{
+    return DWT->CYCCNT;
+}
+#endif
+
+static void APP_CONSOLE_ProfileReport(void)
+{
+    leProfileStats stats;
+    uint32_t i;
+    char name[16];
+
+    if(leRenderer_GetProfileStats(LE_PROFILE_FRAME, &stats) == LE_FAILURE)
+    {
+        APP_CONSOLE_Print("renderer profile compiled out, set LE_RENDERER_PROFILE to 1\r\n");
+        return;
+    }
+
+    APP_CONSOLE_Print("%-11s %7s %7s %7s %7s %7s (us)\r\n",
+                      "stage", "count", "min", "avg", "max", "p99");
+
+    for(i = 0; i < LE_PROFILE_BUCKET_COUNT; i++)
+    {
+        if(leRenderer_GetProfileStats((leProfileBucket)i, &stats) == LE_FAILURE ||
+           stats.count == 0)
+            continue;
+
+        if(i < LE_PROFILE_WIDGET)
+        {
+            snprintf(name, sizeof(name), "%s", profileStageNames[i]);
+        }
+        else
+        {
+            snprintf(name, sizeof(name), "widget %lu", (unsigned long)(i - LE_PROFILE_WIDGET));
+        }
+
+        APP_CONSOLE_Print("%-11s %7lu %7lu %7lu %7lu %7lu\r\n",
+                          name,
+                          (unsigned long)stats.count,
+                          (unsigned long)(stats.min / APP_CONSOLE_CYCLES_PER_US),
+                          (unsigned long)(stats.total / stats.count / APP_CONSOLE_CYCLES_PER_US),
+                          (unsigned long)(stats.max / APP_CONSOLE_CYCLES_PER_US),
+                          (unsigned long)(leRenderer_ProfilePercentile(&stats, 99) / APP_CONSOLE_CYCLES_PER_US));
+    }
+}
+
+static void APP_CONSOLE_SetPolicy(uint32_t size, leScratchSplit split)
+{
+    if(leRenderer_SetScratchPolicy(size, split) == LE_FAILURE)
+    {
+        APP_CONSOLE_Print("invalid scratch size %lu\r\n", (unsigned long)size);
+        return;
+    }
+
+    scratchSize = size;
+    scratchSplit = split;
+
+    APP_CONSOLE_Print("scratch %luB, %s split\r\n",
+                      (unsigned long)size,
+                      split == LE_SCRATCH_SPLIT_BANDS ? "band" : "default");
+}
+
+static void APP_CONSOLE_Command(char cmd)
+{
+    leDamageStats stats;
+    uint32_t formatIdx;
+
+    switch(cmd)
+    {
+        case 'd':
+        {
+            APP_CONSOLE_DamageReport();
+            break;
+        }
+        case 'r':
+        {
+            leRenderer_ResetDamageStats();
+            leCommand_ResetStats();
+            APP_CONSOLE_Print("damage and command stats reset\r\n");
+            break;
+        }
+        case 'p':
+        {
+            APP_CONSOLE_ProfileReport();
+            break;
+        }
+        case 'c':
+        {
+            leRenderer_ResetProfileStats();
+            APP_CONSOLE_Print("renderer profile cleared\r\n");
+            break;
+        }
+        case 'a':
+        {
+            if(leRenderer_GetDamageStats(&stats) == LE_FAILURE)
+            {
+                APP_CONSOLE_Print("damage stats compiled out, set LE_RENDERER_DAMAGE_STATS to 1\r\n");
+                break;
+            }
+
+            APP_CONSOLE_SetPolicy(APP_CONSOLE_RecommendScratchSize(&stats),
+                                  LE_SCRATCH_SPLIT_BANDS);
+            break;
+        }
+        case 'b':
+        {
+            APP_CONSOLE_SetPolicy(APP_CONSOLE_SCRATCH_BUDGET, LE_SCRATCH_SPLIT_BANDS);
+            break;
+        }
+        case 'h':
+        {
+            APP_CONSOLE_SetPolicy(APP_CONSOLE_SCRATCH_BUDGET, LE_SCRATCH_SPLIT_DEFAULT);
+            break;
+        }
+        case 'i':
+        {
+            formatIdx = (scratchFormat + 1) % (sizeof(scratchFormats) / sizeof(scratchFormats[0]));
+
+            if(leRenderer_SetScratchPalette(scratchFormats[formatIdx].palette) == LE_FAILURE)
+            {
+                APP_CONSOLE_Print("indexed scratch disabled\r\n");
+                break;
+            }
+
+            scratchFormat = formatIdx;
+
+            APP_CONSOLE_Print("scratch format %s\r\n", scratchFormats[formatIdx].name);
+            break;
+        }
+        case 'f':
+        {
+            frameRate = (frameRate + 1) % (sizeof(frameRates) / sizeof(frameRates[0]));
+
+            leCommand_SetMaxFrameRate(frameRates[frameRate]);
+
+            if(frameRates[frameRate] == 0)
+            {
+                APP_CONSOLE_Print("update rate unlimited\r\n");
+            }
+            else
+            {
+                APP_CONSOLE_Print("update rate %lu fps\r\n", (unsigned long)frameRates[frameRate]);
+            }
+            break;
+        }
+        case '?':
+        {
+            APP_CONSOLE_Print("d report, r reset, p profile, c clear profile, a apply recommended,\r\n");
+            APP_CONSOLE_Print("b band, h default, i format, f update rate\r\n");
+
+#if LE_RENDERER_DAMAGE_STATS == 0
+            APP_CONSOLE_Print("damage stats compiled out, d and a need LE_RENDERER_DAMAGE_STATS 1\r\n");
+#endif
+#if LE_RENDERER_PROFILE == 0
+            APP_CONSOLE_Print("profile compiled out, p needs LE_RENDERER_PROFILE 1\r\n");
+#endif
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+void APP_CONSOLE_Initialize(void)
+{
+    consoleHandle = SYS_CONSOLE_HandleGet(SYS_CONSOLE_INDEX_0);
+
+    SERCOM0_USART_ReadCallbackRegister(APP_CONSOLE_ReadCallback, 0);
+    SERCOM0_USART_ReadThresholdSet(1);
+    SERCOM0_USART_ReadNotificationEnable(true, true);
+
+#if LE_RENDERER_PROFILE == 1
+    /* start the cycle counter for the renderer profile */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    leRenderer_SetProfileClock(APP_CONSOLE_Cycles);
+#endif
+}
+
+void APP_CONSOLE_Handler(void)
+{
+    char cmd;
+
+    consoleEvtPending = false;
+
+    while(SYS_CONSOLE_Read(consoleHandle, &cmd, 1) == 1)
+    {
+        APP_CONSOLE_Command(cmd);
+    }
+}
+
+
+/*******************************************************************************
+ End of File
+ */
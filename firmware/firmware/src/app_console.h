@@ -0,0 +1,142 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  Application Console Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    app_console.h
+
+  Summary:
+    Single key diagnostic commands on the debug console.
+
+  Description:
+    Received console characters are turned into an APP_MSG_CONSOLE_EVT message
+    and handled in the application task, where the graphics diagnostics can
+    be printed or the renderer policy changed.
+*******************************************************************************/
+
+#ifndef APP_CONSOLE_H
+#define APP_CONSOLE_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/*******************************************************************************
+  Function:
+    void APP_CONSOLE_Initialize(void)
+
+  Summary:
+     Enables console receive notifications.
+
+  Description:
+    Must be called after the application queue has been created.
+
+  Precondition:
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+*/
+void APP_CONSOLE_Initialize(void);
+
+/*******************************************************************************
+  Function:
+    void APP_CONSOLE_Handler(void)
+
+  Summary:
+     Processes the pending console characters.
+
+  Description:
+    Called from the application task on APP_MSG_CONSOLE_EVT.
+
+  Precondition:
+
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+*/
+void APP_CONSOLE_Handler(void);
+
+/*******************************************************************************
+  Function:
+    void APP_CONSOLE_Print(const char* format, ...)
+
+  Summary:
+     Prints a formatted line to the console.
+
+  Description:
+    Waits for room in the console transmit buffer instead of dropping the
+    output, so it must only be called from task context.
+
+  Precondition:
+
+  Parameters:
+    format - printf style format string
+
+  Returns:
+    None.
+
+*/
+void APP_CONSOLE_Print(const char* format, ...);
+
+//DOM-IGNORE-BEGIN
+#ifdef __cplusplus
+}
+#endif
+//DOM-IGNORE-END
+
+#endif /* APP_CONSOLE_H */
+
+
+/*******************************************************************************
+ End of File
+ */
@@ -96,32 +96,42 @@ void oled_c_print(uint8_t display, uint8_t line, uint8_t *data)
     }
 }
 
+/* widgets belong to the Legato task, changes are queued to it and applied
+   between frames.  the queue only fills up while a frame is being sent */
+static void oled_c_Set_String(leWidget* widget, leFixedString* str, uint8_t *dText)
+{
+    while(leCommand_SetString(widget, str->fn->getFont(str), (char*)dText) == LE_FAILURE)
+    {
+        vTaskDelay(1);
+    }
+}
+
+static void oled_c_Set_Visible(leWidget* widget, leBool visible)
+{
+    while(leCommand_SetVisible(widget, visible) == LE_FAILURE)
+    {
+        vTaskDelay(1);
+    }
+}
+
 void oled_c_Text_Field_textStr1(uint8_t *dText)
 {
-    char lcl_textStrLine[TXT_STR1_MAX_LEN];
-    memset(lcl_textStrLine, 0,TXT_STR1_MAX_LEN);
-    sprintf( (char*)lcl_textStrLine, "%s", dText);
-    textStr1.fn->setFromCStr(&textStr1, (char*)lcl_textStrLine);
-    Screen0_txtStr1->fn->setString(Screen0_txtStr1, (leString*)&textStr1);
+    oled_c_Set_String((leWidget*)Screen0_txtStr1, &textStr1, dText);
 }
 
 void oled_c_Text_Field_textStr2(uint8_t *dText)
 {
-    char lcl_textStrLine[TXT_STR2_MAX_LEN];
-    memset(lcl_textStrLine, 0,TXT_STR2_MAX_LEN);
-    sprintf( (char*)lcl_textStrLine, "%s", dText);
-    textStr2.fn->setFromCStr(&textStr2, (char*)lcl_textStrLine);
-    Screen0_txtStr2->fn->setString(Screen0_txtStr2, (leString*)&textStr2);
+    oled_c_Set_String((leWidget*)Screen0_txtStr2, &textStr2, dText);
 }
 
 void oled_c_Image_mchplogo_visible(void)
 {
-    Screen0_mchplogo->fn->setVisible(Screen0_mchplogo, LE_TRUE);
+    oled_c_Set_Visible((leWidget*)Screen0_mchplogo, LE_TRUE);
 }
 
 void oled_c_Image_mchplogo_invisible(void)
 {
-    Screen0_mchplogo->fn->setVisible(Screen0_mchplogo, LE_FALSE);
+    oled_c_Set_Visible((leWidget*)Screen0_mchplogo, LE_FALSE);
 }
 
 void oled_c_dispaly_referesh(void)
@@ -114,6 +114,11 @@ extern "C" {
 #define DRV_SPI_CLIENTS_NUMBER_IDX0           1
 #define DRV_SPI_QUEUE_SIZE_IDX0               4
 
+/* SSD1351 Display Driver Configuration Options */
+#define DRV_SSD1351_BLIT_NONBLOCKING          1
+#define DRV_SSD1351_SHADOW_FRAMEBUFFER        1
+#define DRV_SSD1351_SHADOW_SPAN_COST          8
+
 
 
 // *****************************************************************************
@@ -39,6 +39,7 @@
 
 
 
+#include <string.h>
 #include "definitions.h"
 
 #include "gfx/interface/drv_gfx_disp_intf.h"
@@ -77,12 +78,82 @@
 
 
 #define PIXEL_BUFFER_BYTES_PER_PIXEL 2
+
+// The panel is mapped onto a 128 row GRAM starting at this display line
+#define DRV_SSD1351_GRAM_ROWS       128
+#define DRV_SSD1351_START_LINE      0x20
+
+// GRAM column of the left edge of the panel
+#define DRV_SSD1351_COLUMN_OFFSET   16
+
+// Batch segments and bytes taken by a window setup, and what it costs in
+// bytes with each segment sent as its own transfer
+#define DRV_SSD1351_WINDOW_SEGMENTS 5
+#define DRV_SSD1351_WINDOW_BYTES    7
+#define DRV_SSD1351_WINDOW_COST     (DRV_SSD1351_WINDOW_BYTES + \
+                                     DRV_SSD1351_WINDOW_SEGMENTS * DRV_SSD1351_SHADOW_SPAN_COST)
+
+// Colors of the palette indexed scratch buffers are expanded through
+#define DRV_SSD1351_PALETTE_SIZE    256
 static uint8_t pixelBuffer[SCREEN_WIDTH * PIXEL_BUFFER_BYTES_PER_PIXEL];
 
+/* Palette set with GFX_IOCTL_SET_PALETTE, in wire order */
+static uint16_t palette[DRV_SSD1351_PALETTE_SIZE];
+
+/* Window setup and pixel stream of the blit being sent */
+static GFX_DISP_INTF_BATCH blitBatch;
+
+#if DRV_SSD1351_SHADOW_FRAMEBUFFER == 1
+/* GRAM contents of the panel columns in wire order. All GRAM rows are
+   covered, the ones a scroll moves out of view keep what they showed */
+static uint16_t shadow[DRV_SSD1351_GRAM_ROWS][DISPLAY_WIDTH];
+
+/* Rows of the shadow known to match GRAM */
+static gfxBool shadowValid[DRV_SSD1351_GRAM_ROWS];
+
+/* Changed columns of each row of a region, right is -1 if none changed */
+static int16_t rowLeft[DISPLAY_HEIGHT];
+static int16_t rowRight[DISPLAY_HEIGHT];
+
+/* Cheapest bytes to send the rows above each row and the first row of the
+   last span, -1 if that row is left out */
+static int32_t spanCost[DISPLAY_HEIGHT + 1];
+static int16_t spanStart[DISPLAY_HEIGHT + 1];
+#endif
+
+/* Part of a scratch buffer to send, in display coordinates. Indexed buffers
+   have no pixels, the region starts at index 'first' of the buffer */
+typedef struct
+{
+    uint16_t* pixels;
+    const uint8_t* indices;
+    uint32_t first;
+    uint32_t bpp;
+    int32_t stride;
+    int32_t x;
+    int32_t y;
+    int32_t width;
+    int32_t height;
+    gfxBool bigEndian;
+} DRV_SSD1351_REGION;
+
+/* Rows of a region sent through one GRAM window, relative to the region */
+typedef struct
+{
+    int16_t left;
+    int16_t top;
+    int16_t width;
+    int16_t height;
+} DRV_SSD1351_SPAN;
+
+/* Windows the region of the blit being sent is split into */
+static DRV_SSD1351_SPAN blitSpans[DISPLAY_HEIGHT];
+
 typedef enum
 {
     INIT = 0,
     RUN,
+    BLIT,
     ERROR,
 } DRV_STATE;
 
@@ -93,6 +164,51 @@ typedef struct ILI9488_DRV
 
     /* Port-specific private data */
     void *port_priv;
+
+    /* GRAM rows the display content is scrolled up by */
+    uint32_t scroll;
+
+    /* Scroll requested through the IOCTL, applied on the next blit. Also
+       set to send the start line again after a failed transfer */
+    volatile uint32_t pendingScroll;
+    volatile gfxBool scrollPending;
+
+    /* GRAM write left open by the last blit. A blit that continues it
+       directly below, at the same column and width, skips the window setup.
+       The next row is a panel row */
+    gfxBool windowOpen;
+    int32_t windowX;
+    int32_t windowWidth;
+    int32_t windowNextRow;
+
+    /* Pixel bytes sent and left out because the panel already showed them */
+    uint32_t bytesSent;
+    uint32_t bytesSkipped;
+    uint32_t blitsSkipped;
+
+    /* Region being sent, the number of its spans, the span being sent and
+       its next row, -1 until its window is set up */
+    DRV_SSD1351_REGION blitRegion;
+    uint32_t blitSpanCount;
+    uint32_t blitSpan;
+    int32_t blitRow;
+
+    /* Rows between the open window and the first span, sent from the
+       shadow to carry on in the window, and the next of them to send */
+    DRV_SSD1351_REGION blitGap;
+    int32_t blitGapRow;
+
+#if DRV_SSD1351_BLIT_NONBLOCKING == 1
+    /* Scratch buffer currently being sent */
+    gfxPixelBuffer* volatile blitBuffer;
+
+    /* Pixel count of a staged region and the index of the next to stage */
+    uint32_t blitPixelCount;
+    uint32_t blitPixelIdx;
+
+    /* Blit completion callback */
+    gfxBlitCallBack blitCallback;
+#endif
 } SSD1351_DRV;
 
 SSD1351_DRV drv;
@@ -157,6 +273,10 @@ static void DRV_SSD1351_Reset(void)
 int DRV_SSD1351_Initialize(void)
 {
     drv.state = INIT;
+    drv.windowOpen = GFX_FALSE;
+    drv.scroll = 0;
+    drv.pendingScroll = 0;
+    drv.scrollPending = GFX_FALSE;
 
     return 0;
 }
@@ -182,7 +302,7 @@ static int DRV_SSD1351_Configure(SSD1351_DRV *drvPtr)
 
     //SET_DISPLAY_START_LINE_COMMAND
     cmd = 0xa1;
-    parms[0] = 0x20;
+    parms[0] = DRV_SSD1351_START_LINE;
     GFX_Disp_Intf_WriteCommand(intf, cmd);
     GFX_Disp_Intf_WriteData(intf, parms, 1);
 
@@ -194,195 +314,1573 @@ static int DRV_SSD1351_Configure(SSD1351_DRV *drvPtr)
 
 /**
   Function:
-    static void DRV_SSD1351_Update(void)
+    static uint16_t DRV_SSD1351_RegionPixel(const DRV_SSD1351_REGION* rgn,
+                                            int32_t row,
+                                            int32_t col)
 
   Summary:
-    Driver-specific implementation of GFX HAL update function.
+    Reads a pixel of a region in wire order.
 
   Description:
-    On GFX update, this function flushes any pending pixels to the SSD1351.
+    Pixels of indexed regions are looked up in the palette. Rows of regions
+    that are not cut by columns are contiguous, so col may run past the end
+    of row.
 
   Parameters:
-    None.
+    rgn     - the region
+    row     - the row in the region
+    col     - the column in the region
 
   Returns:
-    * GFX_SUCCESS       - Operation successful
-    * GFX_FAILURE       - Operation failed
+    The RGB565 pixel, high byte first in memory.
 
 */
-void DRV_SSD1351_Update(void)
+static inline uint16_t DRV_SSD1351_RegionPixel(const DRV_SSD1351_REGION* rgn,
+                                               int32_t row,
+                                               int32_t col)
 {
-    uint32_t openVal;
+    uint32_t idx = row * rgn->stride + col;
+    uint16_t clr;
 
-    if(drv.state == INIT)
+    switch(rgn->bpp)
     {
-        openVal = GFX_Disp_Intf_Open();
+        case 1:
+            idx += rgn->first;
+            return palette[(rgn->indices[idx >> 3] >> (7 - (idx & 0x7))) & 0x1];
+        case 4:
+            idx += rgn->first;
+            return palette[(rgn->indices[idx >> 1] >> ((idx & 0x1) ? 0 : 4)) & 0xF];
+        case 8:
+            return palette[rgn->indices[rgn->first + idx]];
+        default:
+            break;
+    }
 
-        drv.port_priv = (void *)openVal;
+    clr = rgn->pixels[idx];
 
-        if (drv.port_priv == 0)
-        {
-            drv.state = ERROR;
-            return;
-        }
+    if(rgn->bigEndian == GFX_FALSE)
+    {
+        clr = (uint16_t)((clr >> 8) | (clr << 8));
+    }
 
-        DRV_SSD1351_Reset();
+    return clr;
+}
 
-        DRV_SSD1351_Configure(&drv);
+/**
+  Function:
+    static int32_t DRV_SSD1351_GramRow(int32_t row)
 
-        drv.state = RUN;
-    }
+  Summary:
+    Maps a panel row to the GRAM row it is shown from.
+
+  Parameters:
+    row     - the panel row
+
+  Returns:
+    The GRAM row.
+
+*/
+static inline int32_t DRV_SSD1351_GramRow(int32_t row)
+{
+    return (row + drv.scroll) % DRV_SSD1351_GRAM_ROWS;
 }
 
+#if DRV_SSD1351_SHADOW_FRAMEBUFFER == 1
+/**
+  Function:
+    static void DRV_SSD1351_ShadowInvalidate(void)
+
+  Summary:
+    Marks the whole shadow as not matching GRAM.
 
+  Description:
+    Every row is then sent in full until a blit covering the whole row has
+    brought it back in sync.
 
-gfxResult DRV_SSD1351_BlitBuffer(int32_t x,
-                                           int32_t y,
-                                           gfxPixelBuffer* buf)
+  Parameters:
+    None.
+
+  Returns:
+    None.
+
+*/
+static void DRV_SSD1351_ShadowInvalidate(void)
 {
+    memset(shadowValid, 0, sizeof(shadowValid));
+}
 
-    int row;
-    uint16_t clr;
-    uint16_t* ptr;
-    uint8_t parm[4];
+/**
+  Function:
+    static int32_t DRV_SSD1351_RowsCost(int32_t stride,
+                                        int32_t width,
+                                        int32_t rows)
 
-    GFX_Disp_Intf intf;
+  Summary:
+    Bytes it takes to send rows of pixels in place.
 
-    if (drv.state != RUN)
-        return GFX_FAILURE;
+  Parameters:
+    stride  - pixels from one row to the next in memory
+    width   - pixels per row
+    rows    - the number of rows
 
-    intf = (GFX_Disp_Intf) drv.port_priv;
+  Returns:
+    The pixel bytes, plus DRV_SSD1351_SHADOW_SPAN_COST for each transfer,
+    one for all rows when they are contiguous and one per row otherwise.
 
-    //Add X offset
-    x += 16;
+*/
+static int32_t DRV_SSD1351_RowsCost(int32_t stride,
+                                    int32_t width,
+                                    int32_t rows)
+{
+    int32_t cost = rows * width * PIXEL_BUFFER_BYTES_PER_PIXEL;
 
-    DRV_SSD1351_NCSAssert(intf);
+    if(width != stride)
+    {
+        cost += rows * DRV_SSD1351_SHADOW_SPAN_COST;
+    }
+    else
+    {
+        cost += DRV_SSD1351_SHADOW_SPAN_COST;
+    }
 
-    //Write X/Column Address
-    parm[0] = x;
-    parm[1] = (x + buf->size.width - 1);
-    GFX_Disp_Intf_WriteCommand(intf, 0x15);
-    GFX_Disp_Intf_WriteData(intf, parm, 2);
+    return cost;
+}
 
-    //Write Y/Page Address
-    parm[0] = y;
-    parm[1] = (y + buf->size.height - 1);
-    GFX_Disp_Intf_WriteCommand(intf, 0x75);
-    GFX_Disp_Intf_WriteData(intf, parm, 2);
+/**
+  Function:
+    static gfxBool DRV_SSD1351_ShadowGap(int32_t x,
+                                         int32_t y,
+                                         int32_t width,
+                                         int32_t rows)
 
-    //Start Memory Write
-    GFX_Disp_Intf_WriteCommand(intf, 0x5c);
+  Summary:
+    Decides whether a blit below the open window carries on in it.
 
+  Description:
+    The rows in between are taken from the shadow. That is only done when
+    the panel is known to show them and they cost fewer bytes than a new
+    window. Sets up the rows as the gap of the blit.
+
+  Parameters:
+    x, y    - display column and row of the first row in between
+    width   - window width
+    rows    - the number of rows in between
+
+  Returns:
+    * GFX_TRUE       - The blit carries on in the open window
+    * GFX_FALSE      - The blit needs a window of its own
+
+*/
+static gfxBool DRV_SSD1351_ShadowGap(int32_t x,
+                                     int32_t y,
+                                     int32_t width,
+                                     int32_t rows)
+{
+    int32_t row;
 
-    for(row = 0; row < buf->size.height; row++)
+    drv.blitGap.height = 0;
+    drv.blitGapRow = 0;
+
+    if(rows == 0)
+        return GFX_TRUE;
+
+    /* the gap has to fit one batch, pixels staged after it must not come
+       before its last row */
+    if(rows >= GFX_DISP_INTF_BATCH_SEGMENTS ||
+       DRV_SSD1351_RowsCost(DISPLAY_WIDTH, width, rows) >= DRV_SSD1351_WINDOW_COST)
+        return GFX_FALSE;
+
+    for(row = y; row < y + rows; row++)
     {
-        int col, dataIdx;
-        ptr = gfxPixelBufferOffsetGet_Unsafe(buf, 0, row);
-        for(col = 0, dataIdx = 0; col < buf->size.width; col++)
-        {
-            clr = ptr[col];
-            pixelBuffer[dataIdx++] = (uint8_t) (clr >> 8);
-            pixelBuffer[dataIdx++] = (uint8_t) (uint8_t) (clr & 0xff);
-        }
-        GFX_Disp_Intf_WriteData(intf,
-                                pixelBuffer,
-                                PIXEL_BUFFER_BYTES_PER_PIXEL *
-                                buf->size.width);
+        if(shadowValid[DRV_SSD1351_GramRow(row)] == GFX_FALSE)
+            return GFX_FALSE;
     }
-    DRV_SSD1351_NCSDeassert(intf);
 
-    return GFX_SUCCESS;
+    drv.blitGap.pixels = &shadow[DRV_SSD1351_GramRow(y)][x];
+    drv.blitGap.indices = NULL;
+    drv.blitGap.first = 0;
+    drv.blitGap.bpp = 16;
+    drv.blitGap.stride = DISPLAY_WIDTH;
+    drv.blitGap.x = x;
+    drv.blitGap.y = y;
+    drv.blitGap.width = width;
+    drv.blitGap.height = rows;
+    drv.blitGap.bigEndian = GFX_TRUE;
+
+    return GFX_TRUE;
 }
 
-gfxDriverIOCTLResponse DRV_SSD1351_IOCTL(gfxDriverIOCTLRequest request,
-                                     void* arg)
+/**
+  Function:
+    static uint32_t DRV_SSD1351_ShadowDelta(DRV_SSD1351_REGION* rgn,
+                                            DRV_SSD1351_SPAN* spans)
+
+  Summary:
+    Compares a region against the shadow and splits the pixels that changed
+    into spans.
+
+  Description:
+    The shadow is updated to the new contents. Each span is a run of rows
+    with the changed columns of all of them, sent through its own window.
+    The rows are split where that costs fewer bytes than one window around
+    them, unchanged rows in between included, so a text update that only
+    touches a few glyphs in a band sends little more than those glyphs.
+    Only regions in wire order are split, so their rows can be sent in
+    place. Byte swapped and indexed regions are cut down to the changed
+    rows and sent as one contiguous span.
+
+  Parameters:
+    rgn     - the region to send, in display coordinates
+    spans   - receives the spans, one per row at most
+
+  Returns:
+    The number of spans, 0 if the panel already shows the region.
+
+*/
+static uint32_t DRV_SSD1351_ShadowDelta(DRV_SSD1351_REGION* rgn,
+                                        DRV_SSD1351_SPAN* spans)
 {
-    gfxIOCTLArg_Value* val;
-    gfxIOCTLArg_DisplaySize* disp;
-    gfxIOCTLArg_LayerRect* rect;
+    DRV_SSD1351_SPAN tmp;
+    uint16_t* dst;
+    uint16_t clr;
+    int32_t row, col, start, end, cost, gram;
+    int32_t left, right, top, bottom;
+    uint32_t count, i;
+    gfxBool valid;
+
+    /* shouldn't happen, the renderer clips to the layer */
+    if(rgn->x < 0 || rgn->y < 0 ||
+       rgn->x + rgn->width > DISPLAY_WIDTH ||
+       rgn->y + rgn->height > DISPLAY_HEIGHT)
+    {
+        spans[0].left = 0;
+        spans[0].top = 0;
+        spans[0].width = rgn->width;
+        spans[0].height = rgn->height;
 
-    switch(request)
+        return 1;
+    }
+
+    top = -1;
+    bottom = -1;
+
+    for(row = 0; row < rgn->height; row++)
     {
-        case GFX_IOCTL_FRAME_END:
-        {
-            return GFX_IOCTL_OK;
-        }
-        case GFX_IOCTL_GET_COLOR_MODE:
-        {
-            val = (gfxIOCTLArg_Value*)arg;
+        gram = DRV_SSD1351_GramRow(rgn->y + row);
 
-            val->value.v_colormode = PIXEL_BUFFER_COLOR_MODE;
+        dst = &shadow[gram][rgn->x];
+        valid = shadowValid[gram];
 
-            return GFX_IOCTL_OK;
-        }
-        case GFX_IOCTL_GET_BUFFER_COUNT:
+        rowLeft[row] = rgn->width;
+        rowRight[row] = -1;
+
+        for(col = 0; col < rgn->width; col++)
         {
-            val = (gfxIOCTLArg_Value*)arg;
+            clr = DRV_SSD1351_RegionPixel(rgn, row, col);
 
-            val->value.v_uint = 1;
+            if(valid == GFX_TRUE && dst[col] == clr)
+                continue;
 
-            return GFX_IOCTL_OK;
-        }
-        case GFX_IOCTL_GET_DISPLAY_SIZE:
-        {
-            disp = (gfxIOCTLArg_DisplaySize*)arg;
+            dst[col] = clr;
 
-            disp->width = DISPLAY_WIDTH;
-            disp->height = DISPLAY_HEIGHT;
+            if(col < rowLeft[row])
+            {
+                rowLeft[row] = col;
+            }
 
-            return GFX_IOCTL_OK;
+            rowRight[row] = col;
         }
-        case GFX_IOCTL_GET_LAYER_COUNT:
+
+        if(rgn->width == DISPLAY_WIDTH)
         {
-            val = (gfxIOCTLArg_Value*)arg;
+            shadowValid[gram] = GFX_TRUE;
+        }
 
-            val->value.v_uint = 1;
+        if(rowRight[row] >= 0)
+        {
+            if(top < 0)
+            {
+                top = row;
+            }
 
-            return GFX_IOCTL_OK;
+            bottom = row;
         }
-        case GFX_IOCTL_GET_ACTIVE_LAYER:
-        {
-            val = (gfxIOCTLArg_Value*)arg;
+    }
 
-            val->value.v_uint = 0;
+    if(top < 0)
+        return 0;
 
-            return GFX_IOCTL_OK;
+    if(rgn->bigEndian == GFX_FALSE)
+    {
+        /* rows of a byte swapped or indexed region are staged in one go */
+        if(rgn->bpp == 16)
+        {
+            rgn->pixels += top * rgn->stride;
         }
-        case GFX_IOCTL_GET_LAYER_RECT:
+        else
         {
-            rect = (gfxIOCTLArg_LayerRect*)arg;
+            rgn->first += top * rgn->stride;
+        }
 
-            rect->layer.id = 0;
-            rect->x = 0;
-            rect->y = 0;
-            rect->width = DISPLAY_WIDTH;
-            rect->height = DISPLAY_HEIGHT;
+        rgn->y += top;
+        rgn->height = bottom - top + 1;
 
-            return GFX_IOCTL_OK;
+        spans[0].left = 0;
+        spans[0].top = 0;
+        spans[0].width = rgn->width;
+        spans[0].height = rgn->height;
+
+        return 1;
+    }
+
+    /* cheapest way to send the rows above each row, ending with a span that
+       starts and ends on a changed row */
+    spanCost[0] = 0;
+
+    for(end = 1; end <= rgn->height; end++)
+    {
+        spanCost[end] = spanCost[end - 1];
+        spanStart[end] = -1;
+
+        if(rowRight[end - 1] < 0)
+            continue;
+
+        left = rgn->width;
+        right = -1;
+        spanCost[end] = INT32_MAX;
+
+        for(start = end - 1; start >= 0; start--)
+        {
+            if(rowRight[start] < 0)
+                continue;
+
+            if(rowLeft[start] < left)
+            {
+                left = rowLeft[start];
+            }
+
+            if(rowRight[start] > right)
+            {
+                right = rowRight[start];
+            }
+
+            cost = spanCost[start] + DRV_SSD1351_WINDOW_COST +
+                   DRV_SSD1351_RowsCost(rgn->stride, right - left + 1, end - start);
+
+            if(cost < spanCost[end])
+            {
+                spanCost[end] = cost;
+                spanStart[end] = start;
+            }
         }
-        case GFX_IOCTL_GET_VSYNC_COUNT:
+    }
+
+    /* the spans come out bottom up */
+    count = 0;
+
+    for(end = rgn->height; end > 0; )
+    {
+        start = spanStart[end];
+
+        if(start < 0)
         {
-            val = (gfxIOCTLArg_Value*)arg;
+            end--;
 
-            val->value.v_uint = swapCount;
+            continue;
+        }
 
-            return GFX_IOCTL_OK;
+        left = rgn->width;
+        right = -1;
+
+        for(row = start; row < end; row++)
+        {
+            if(rowRight[row] < 0)
+                continue;
+
+            if(rowLeft[row] < left)
+            {
+                left = rowLeft[row];
+            }
+
+            if(rowRight[row] > right)
+            {
+                right = rowRight[row];
+            }
         }
-        case GFX_IOCTL_GET_STATUS:
-		{
-            val = (gfxIOCTLArg_Value*)arg;
 
-            if (drv.state == RUN)
-                val->value.v_uint = 0;
-            else
-                val->value.v_uint = 1;
+        spans[count].left = left;
+        spans[count].top = start;
+        spans[count].width = right - left + 1;
+        spans[count].height = end - start;
+        count++;
 
-            return GFX_IOCTL_OK;
-	    }
-        default:
-        { }
+        end = start;
     }
 
-    return GFX_IOCTL_UNSUPPORTED;
+    for(i = 0; i < count / 2; i++)
+    {
+        tmp = spans[i];
+        spans[i] = spans[count - 1 - i];
+        spans[count - 1 - i] = tmp;
+    }
+
+    return count;
+}
+#else
+#define DRV_SSD1351_ShadowInvalidate()
+#define DRV_SSD1351_ShadowGap(x, y, width, rows) ((rows) == 0 ? GFX_TRUE : GFX_FALSE)
+#endif
+
+/**
+  Function:
+    static uint32_t DRV_SSD1351_WrapSpans(const DRV_SSD1351_REGION* rgn,
+                                          DRV_SSD1351_SPAN* spans,
+                                          uint32_t count)
+
+  Summary:
+    Splits the span that runs past the end of GRAM in two.
+
+  Description:
+    Once the display is scrolled, the panel rows below the wrap row are
+    stored at the top of GRAM. A window can't wrap around, so the rows on
+    either side need one each. Spans don't share rows, so at most one of
+    them crosses the wrap row and the span array always has room.
+
+  Parameters:
+    rgn     - the region being sent
+    spans   - the spans of the region, sorted by row
+    count   - the number of spans
+
+  Returns:
+    The number of spans.
+
+*/
+static uint32_t DRV_SSD1351_WrapSpans(const DRV_SSD1351_REGION* rgn,
+                                      DRV_SSD1351_SPAN* spans,
+                                      uint32_t count)
+{
+    int32_t wrap;
+    uint32_t i;
+
+    /* region row that is stored in GRAM row 0 */
+    wrap = (DRV_SSD1351_GRAM_ROWS - drv.scroll) % DRV_SSD1351_GRAM_ROWS - rgn->y;
+
+    for(i = 0; i < count; i++)
+    {
+        if(spans[i].top >= wrap || spans[i].top + spans[i].height <= wrap)
+            continue;
+
+        memmove(&spans[i + 2], &spans[i + 1], (count - i - 1) * sizeof(spans[0]));
+
+        spans[i + 1] = spans[i];
+        spans[i + 1].top = wrap;
+        spans[i + 1].height = spans[i].top + spans[i].height - wrap;
+        spans[i].height = wrap - spans[i].top;
+
+        return count + 1;
+    }
+
+    return count;
 }
 
+/**
+  Function:
+    static void DRV_SSD1351_SetWindow(GFX_DISP_INTF_BATCH* batch,
+                                      int32_t x,
+                                      int32_t y,
+                                      int32_t width,
+                                      int32_t height)
+
+  Summary:
+    Adds the GRAM write window and a memory write to a command batch.
+
+  Description:
+    Blits start with an empty batch, so the window always fits.
+
+  Parameters:
+    batch   - the command batch
+    x, y    - GRAM column and row of the top left corner
+    width   - window width
+    height  - window height
+
+  Returns:
+    None.
+
+*/
+static void DRV_SSD1351_SetWindow(GFX_DISP_INTF_BATCH* batch,
+                                  int32_t x,
+                                  int32_t y,
+                                  int32_t width,
+                                  int32_t height)
+{
+    uint8_t parm[2];
+
+    //Write X/Column Address
+    parm[0] = x;
+    parm[1] = (x + width - 1);
+    GFX_Disp_Intf_BatchCommand(batch, 0x15);
+    GFX_Disp_Intf_BatchData(batch, parm, 2);
+
+    //Write Y/Page Address
+    parm[0] = y;
+    parm[1] = (y + height - 1);
+    GFX_Disp_Intf_BatchCommand(batch, 0x75);
+    GFX_Disp_Intf_BatchData(batch, parm, 2);
+
+    //Start Memory Write
+    GFX_Disp_Intf_BatchCommand(batch, 0x5c);
+}
+
+/**
+  Function:
+    static int32_t DRV_SSD1351_BatchRows(GFX_DISP_INTF_BATCH* batch,
+                                         const DRV_SSD1351_REGION* rgn,
+                                         int32_t row,
+                                         int32_t count)
+
+  Summary:
+    Adds rows of a big-endian region to a command batch.
+
+  Description:
+    The rows are sent in place when the batch is submitted, in one transfer
+    when they are contiguous and one per row otherwise. Stops at the first
+    row the batch has no room for.
+
+  Parameters:
+    batch   - the command batch
+    rgn     - the region being sent
+    row     - the first row to add
+    count   - the number of rows to add
+
+  Returns:
+    The number of rows added.
+
+*/
+static int32_t DRV_SSD1351_BatchRows(GFX_DISP_INTF_BATCH* batch,
+                                     const DRV_SSD1351_REGION* rgn,
+                                     int32_t row,
+                                     int32_t count)
+{
+    int bytes = PIXEL_BUFFER_BYTES_PER_PIXEL * rgn->width;
+    int32_t added;
+
+    if(rgn->stride == rgn->width)
+    {
+        /* already in wire order, send all rows in one transfer */
+        if(GFX_Disp_Intf_BatchDataRef(batch,
+                                      (uint8_t*)(rgn->pixels + row * rgn->stride),
+                                      bytes * count) != 0)
+        {
+            return 0;
+        }
+
+        return count;
+    }
+
+    for(added = 0; added < count; added++)
+    {
+        if(GFX_Disp_Intf_BatchDataRef(batch,
+                                      (uint8_t*)(rgn->pixels + (row + added) * rgn->stride),
+                                      bytes) != 0)
+        {
+            break;
+        }
+    }
+
+    return added;
+}
+
+/**
+  Function:
+    static void DRV_SSD1351_BatchSpans(GFX_DISP_INTF_BATCH* batch)
+
+  Summary:
+    Adds the windows and rows of the spans left to send to a command batch.
+
+  Description:
+    Picks up at the span and row the last batch stopped at and stops when
+    the batch is full. The gap rows from the shadow go first. Rows of byte
+    swapped and indexed regions are staged by the caller, only their window
+    is added.
+
+  Parameters:
+    batch   - the command batch
+
+  Returns:
+    None.
+
+*/
+static void DRV_SSD1351_BatchSpans(GFX_DISP_INTF_BATCH* batch)
+{
+    DRV_SSD1351_SPAN* span;
+    DRV_SSD1351_REGION rgn;
+
+    if(drv.blitGapRow < drv.blitGap.height)
+    {
+        drv.blitGapRow += DRV_SSD1351_BatchRows(batch,
+                                                &drv.blitGap,
+                                                drv.blitGapRow,
+                                                drv.blitGap.height - drv.blitGapRow);
+
+        if(drv.blitGapRow < drv.blitGap.height)
+            return;
+    }
+
+    while(drv.blitSpan < drv.blitSpanCount)
+    {
+        span = &blitSpans[drv.blitSpan];
+
+        rgn = drv.blitRegion;
+        rgn.x += span->left;
+        rgn.y += span->top;
+        rgn.width = span->width;
+        rgn.height = span->height;
+
+        if(drv.blitRow < 0)
+        {
+            if(batch->count + DRV_SSD1351_WINDOW_SEGMENTS > GFX_DISP_INTF_BATCH_SEGMENTS ||
+               batch->used + DRV_SSD1351_WINDOW_BYTES > GFX_DISP_INTF_BATCH_BYTES)
+                return;
+
+            /* open the window down to the end of GRAM so the next band can
+               continue it */
+            DRV_SSD1351_SetWindow(batch,
+                                  rgn.x + DRV_SSD1351_COLUMN_OFFSET,
+                                  DRV_SSD1351_GramRow(rgn.y),
+                                  rgn.width,
+                                  DRV_SSD1351_GRAM_ROWS - DRV_SSD1351_GramRow(rgn.y));
+
+            drv.blitRow = 0;
+        }
+
+        if(rgn.bigEndian == GFX_FALSE)
+            return;
+
+        rgn.pixels += span->top * rgn.stride + span->left;
+
+        drv.blitRow += DRV_SSD1351_BatchRows(batch,
+                                             &rgn,
+                                             drv.blitRow,
+                                             rgn.height - drv.blitRow);
+
+        if(drv.blitRow < rgn.height)
+            return;
+
+        drv.blitSpan++;
+        drv.blitRow = -1;
+    }
+}
+
+#if DRV_SSD1351_BLIT_NONBLOCKING == 1
+/**
+  Function:
+    static uint32_t DRV_SSD1351_StagePixels(uint32_t idx)
+
+  Summary:
+    Converts the next chunk of the region being sent into the pixel buffer.
+
+  Description:
+    Used when the scratch buffer is stored in CPU byte order or holds
+    palette indices, the SSD1351 expects RGB565 pixels high byte first.
+    Rows are contiguous and the GRAM window wraps on its own, so chunks do
+    not need to line up with rows. Buffers flagged GFX_BF_BIG_ENDIAN skip
+    this step entirely.
+
+  Parameters:
+    idx     - index of the first pixel to stage
+
+  Returns:
+    The number of bytes staged.
+
+*/
+static uint32_t DRV_SSD1351_StagePixels(uint32_t idx)
+{
+    uint32_t count, i, dataIdx;
+    uint16_t clr;
+
+    count = drv.blitPixelCount - idx;
+
+    if(count > SCREEN_WIDTH)
+    {
+        count = SCREEN_WIDTH;
+    }
+
+    for(i = 0, dataIdx = 0; i < count; i++)
+    {
+        clr = DRV_SSD1351_RegionPixel(&drv.blitRegion, 0, idx + i);
+        pixelBuffer[dataIdx++] = (uint8_t) (clr & 0xff);
+        pixelBuffer[dataIdx++] = (uint8_t) (clr >> 8);
+    }
+
+    return count * PIXEL_BUFFER_BYTES_PER_PIXEL;
+}
+
+/**
+  Function:
+    static void DRV_SSD1351_BatchStaged(GFX_DISP_INTF_BATCH* batch)
+
+  Summary:
+    Stages the first chunk of the span being sent and adds it to a batch.
+
+  Description:
+    Byte swapped and indexed regions have one span, or two when they wrap
+    around the end of GRAM. The rest of the span is staged from the transfer
+    callback.
+
+  Parameters:
+    batch   - the command batch, with the window of the span added
+
+  Returns:
+    None.
+
+*/
+static void DRV_SSD1351_BatchStaged(GFX_DISP_INTF_BATCH* batch)
+{
+    const DRV_SSD1351_SPAN* span = &blitSpans[drv.blitSpan];
+    uint32_t bytes;
+
+    drv.blitPixelIdx = span->top * drv.blitRegion.width;
+    drv.blitPixelCount = (span->top + span->height) * drv.blitRegion.width;
+
+    bytes = DRV_SSD1351_StagePixels(drv.blitPixelIdx);
+
+    GFX_Disp_Intf_BatchDataRef(batch, pixelBuffer, bytes);
+
+    drv.blitPixelIdx += bytes / PIXEL_BUFFER_BYTES_PER_PIXEL;
+}
+
+/**
+  Function:
+    static void DRV_SSD1351_TransferCallback(GFX_Disp_Intf intf,
+                                             GFX_DISP_INTF_STATUS status,
+                                             void* parm)
+
+  Summary:
+    Display interface transfer callback.
+
+  Description:
+    Queues the next chunk of the scratch buffer being blitted, or the spans
+    of a big-endian region that did not fit the first batch. Once the last
+    chunk is out the scratch buffer is unlocked and the blit callback is
+    called. Runs in interrupt context.
+
+  Parameters:
+    intf    - the interface handle
+    status  - transfer status
+    parm    - the driver object
+
+  Returns:
+    None.
+
+*/
+static void DRV_SSD1351_TransferCallback(GFX_Disp_Intf intf,
+                                         GFX_DISP_INTF_STATUS status,
+                                         void* parm)
+{
+    SSD1351_DRV* drvPtr = (SSD1351_DRV*)parm;
+    gfxPixelBuffer* buf = drvPtr->blitBuffer;
+    uint32_t bytes;
+
+    /* command writes from the task context also end up here */
+    if(drvPtr->state != BLIT || buf == NULL)
+        return;
+
+    if(status == GFX_DISP_INTF_TX_DONE &&
+       drvPtr->blitPixelIdx < drvPtr->blitPixelCount)
+    {
+        bytes = DRV_SSD1351_StagePixels(drvPtr->blitPixelIdx);
+
+        drvPtr->blitPixelIdx += bytes / PIXEL_BUFFER_BYTES_PER_PIXEL;
+
+        if(GFX_Disp_Intf_WriteDataAsync(intf, pixelBuffer, bytes) == 0)
+            return;
+
+        status = GFX_DISP_INTF_ERROR;
+    }
+    else if(status == GFX_DISP_INTF_TX_DONE &&
+            drvPtr->blitRegion.bigEndian == GFX_FALSE &&
+            drvPtr->blitSpan + 1 < drvPtr->blitSpanCount)
+    {
+        /* the rows past the end of GRAM go to a window at its top */
+        drvPtr->blitSpan++;
+        drvPtr->blitRow = -1;
+
+        GFX_Disp_Intf_BatchBegin(&blitBatch);
+
+        DRV_SSD1351_BatchSpans(&blitBatch);
+        DRV_SSD1351_BatchStaged(&blitBatch);
+
+        if(GFX_Disp_Intf_BatchSubmit(intf, &blitBatch) == 0)
+            return;
+
+        status = GFX_DISP_INTF_ERROR;
+    }
+    else if(status == GFX_DISP_INTF_TX_DONE &&
+            drvPtr->blitRegion.bigEndian == GFX_TRUE &&
+            drvPtr->blitSpan < drvPtr->blitSpanCount)
+    {
+        /* the GRAM write is still open, the rows carry on from the last */
+        GFX_Disp_Intf_BatchBegin(&blitBatch);
+
+        DRV_SSD1351_BatchSpans(&blitBatch);
+
+        if(GFX_Disp_Intf_BatchSubmit(intf, &blitBatch) == 0)
+            return;
+
+        status = GFX_DISP_INTF_ERROR;
+    }
+
+    /* the GRAM address is unknown after a failed transfer, and the start
+       line may not have gone out */
+    if(status != GFX_DISP_INTF_TX_DONE)
+    {
+        drvPtr->windowOpen = GFX_FALSE;
+        drvPtr->scrollPending = GFX_TRUE;
+
+        DRV_SSD1351_ShadowInvalidate();
+    }
+
+    drvPtr->blitBuffer = NULL;
+    gfxPixelBuffer_SetLocked(buf, GFX_FALSE);
+
+    drvPtr->state = RUN;
+
+    if(drvPtr->blitCallback != NULL)
+    {
+        drvPtr->blitCallback();
+    }
+}
+#endif
+
+/**
+  Function:
+    static void DRV_SSD1351_Update(void)
+
+  Summary:
+    Driver-specific implementation of GFX HAL update function.
+
+  Description:
+    On GFX update, this function flushes any pending pixels to the SSD1351.
+    The first call resets and configures the controller and blocks until
+    that is done, waiting for every command and the reset delays. Blits
+    are refused until then.
+
+  Parameters:
+    None.
+
+  Returns:
+    * GFX_SUCCESS       - Operation successful
+    * GFX_FAILURE       - Operation failed
+
+*/
+void DRV_SSD1351_Update(void)
+{
+    uint32_t openVal;
+
+    if(drv.state == INIT)
+    {
+        openVal = GFX_Disp_Intf_Open();
+
+        drv.port_priv = (void *)openVal;
+
+        if (drv.port_priv == 0)
+        {
+            drv.state = ERROR;
+            return;
+        }
+
+        DRV_SSD1351_Reset();
+
+        /* whatever GRAM held before the reset is unknown, and the start
+           line is back at its configured value */
+        drv.windowOpen = GFX_FALSE;
+        drv.scroll = 0;
+        drv.pendingScroll = 0;
+        drv.scrollPending = GFX_FALSE;
+
+        DRV_SSD1351_ShadowInvalidate();
+
+        DRV_SSD1351_Configure(&drv);
+
+        /* configuration is done at the slow clock, stream pixels at the
+           fastest clock the controller accepts */
+        GFX_Disp_Intf_SetClockProfile((GFX_Disp_Intf) drv.port_priv,
+                                      GFX_DISP_INTF_CLOCK_FAST);
+
+#if DRV_SSD1351_BLIT_NONBLOCKING == 1
+        GFX_Disp_Intf_Set_Callback((GFX_Disp_Intf) drv.port_priv,
+                                   DRV_SSD1351_TransferCallback,
+                                   &drv);
+#endif
+
+        drv.state = RUN;
+    }
+}
+
+
+
+#if DRV_SSD1351_BLIT_NONBLOCKING == 0
+/**
+  Function:
+    static void DRV_SSD1351_SubmitWait(GFX_Disp_Intf intf,
+                                       GFX_DISP_INTF_BATCH* batch)
+
+  Summary:
+    Sends a command batch, waits for it and empties it.
+
+  Description:
+    Spins until the transfer is done, only the blocking build uses it. A
+    batch that can't be sent leaves the panel out of step with the shadow.
+
+  Parameters:
+    intf    - the interface handle
+    batch   - the command batch
+
+  Returns:
+    None.
+
+*/
+static void DRV_SSD1351_SubmitWait(GFX_Disp_Intf intf,
+                                   GFX_DISP_INTF_BATCH* batch)
+{
+    if(batch->count > 0)
+    {
+        if(GFX_Disp_Intf_BatchSubmit(intf, batch) == 0)
+        {
+            while(!GFX_Disp_Intf_Ready(intf));
+        }
+        else
+        {
+            drv.windowOpen = GFX_FALSE;
+            drv.scrollPending = GFX_TRUE;
+
+            DRV_SSD1351_ShadowInvalidate();
+        }
+    }
+
+    GFX_Disp_Intf_BatchBegin(batch);
+}
+
+/**
+  Function:
+    static void DRV_SSD1351_WriteRows(GFX_Disp_Intf intf,
+                                      GFX_DISP_INTF_BATCH* batch)
+
+  Summary:
+    Sends the spans of the region being blitted and waits for them.
+
+  Description:
+    Big-endian rows are sent in place, a batch at a time. Other regions have
+    one span, or two when they wrap around the end of GRAM. Their rows are
+    byte swapped or expanded from palette indices a row at a time, so the
+    batch with the window is sent first and each row waits for its transfer.
+
+  Parameters:
+    intf    - the interface handle
+    batch   - the command batch, with the first spans added
+
+  Returns:
+    None.
+
+*/
+static void DRV_SSD1351_WriteRows(GFX_Disp_Intf intf,
+                                  GFX_DISP_INTF_BATCH* batch)
+{
+    const DRV_SSD1351_REGION* rgn = &drv.blitRegion;
+    const DRV_SSD1351_SPAN* span;
+    uint16_t clr;
+    int32_t row, col, dataIdx;
+    int bytes = PIXEL_BUFFER_BYTES_PER_PIXEL * rgn->width;
+
+    if(rgn->bigEndian == GFX_TRUE)
+    {
+        while(drv.blitSpan < drv.blitSpanCount)
+        {
+            DRV_SSD1351_SubmitWait(intf, batch);
+
+            DRV_SSD1351_BatchSpans(batch);
+        }
+
+        DRV_SSD1351_SubmitWait(intf, batch);
+
+        return;
+    }
+
+    while(drv.blitSpan < drv.blitSpanCount)
+    {
+        span = &blitSpans[drv.blitSpan];
+
+        DRV_SSD1351_SubmitWait(intf, batch);
+
+        for(row = span->top; row < span->top + span->height; row++)
+        {
+            for(col = 0, dataIdx = 0; col < rgn->width; col++)
+            {
+                clr = DRV_SSD1351_RegionPixel(rgn, row, col);
+                pixelBuffer[dataIdx++] = (uint8_t) (clr & 0xff);
+                pixelBuffer[dataIdx++] = (uint8_t) (clr >> 8);
+            }
+            GFX_Disp_Intf_WriteData(intf, pixelBuffer, bytes);
+        }
+
+        drv.blitSpan++;
+        drv.blitRow = -1;
+
+        DRV_SSD1351_BatchSpans(batch);
+    }
+}
+#else
+/**
+  Function:
+    static gfxResult DRV_SSD1351_Submit(GFX_Disp_Intf intf,
+                                        gfxPixelBuffer* buf)
+
+  Summary:
+    Starts sending the blit batch.
+
+  Description:
+    The scratch buffer is held until the transfer callback has sent the
+    rest of it.
+
+  Parameters:
+    intf    - the interface handle
+    buf     - the scratch buffer being sent
+
+  Returns:
+    * GFX_SUCCESS       - The transfer was started
+    * GFX_FAILURE       - The batch could not be sent
+
+*/
+static gfxResult DRV_SSD1351_Submit(GFX_Disp_Intf intf,
+                                    gfxPixelBuffer* buf)
+{
+    gfxPixelBuffer_SetLocked(buf, GFX_TRUE);
+
+    drv.blitBuffer = buf;
+    drv.state = BLIT;
+
+    if(GFX_Disp_Intf_BatchSubmit(intf, &blitBatch) != 0)
+    {
+        drv.windowOpen = GFX_FALSE;
+        drv.scrollPending = GFX_TRUE;
+        drv.blitBuffer = NULL;
+        gfxPixelBuffer_SetLocked(buf, GFX_FALSE);
+        drv.state = RUN;
+
+        /* the shadow already holds the new pixels */
+        DRV_SSD1351_ShadowInvalidate();
+
+        return GFX_FAILURE;
+    }
+
+    return GFX_SUCCESS;
+}
+#endif
+
+gfxResult DRV_SSD1351_BlitBuffer(int32_t x,
+                                           int32_t y,
+                                           gfxPixelBuffer* buf)
+{
+    DRV_SSD1351_REGION rgn;
+    DRV_SSD1351_SPAN* first;
+    DRV_SSD1351_SPAN* last;
+    uint32_t total, sent, i;
+    uint8_t parm;
+
+    GFX_Disp_Intf intf;
+
+    if (drv.state != RUN)
+        return GFX_FAILURE;
+
+    intf = (GFX_Disp_Intf) drv.port_priv;
+
+    rgn.stride = buf->size.width;
+    rgn.x = x;
+    rgn.y = y;
+    rgn.width = buf->size.width;
+    rgn.height = buf->size.height;
+
+    switch(buf->mode)
+    {
+        case GFX_COLOR_MODE_INDEX_1:
+        case GFX_COLOR_MODE_INDEX_4:
+        case GFX_COLOR_MODE_INDEX_8:
+        {
+            /* expanded through the palette on the way out */
+            rgn.pixels = NULL;
+            rgn.indices = (const uint8_t*)buf->pixels;
+            rgn.first = 0;
+            rgn.bpp = gfxColorInfoTable[buf->mode].bpp;
+            rgn.bigEndian = GFX_FALSE;
+
+            break;
+        }
+        default:
+        {
+            rgn.pixels = (uint16_t*)buf->pixels;
+            rgn.indices = NULL;
+            rgn.first = 0;
+            rgn.bpp = 16;
+            rgn.bigEndian = (buf->flags & GFX_BF_BIG_ENDIAN) > 0 ? GFX_TRUE : GFX_FALSE;
+        }
+    }
+
+    total = rgn.width * rgn.height * PIXEL_BUFFER_BYTES_PER_PIXEL;
+
+    /* the window setup and the pixels go out as one batch, chip select
+       stays asserted and RS/DCx only flips between commands and data */
+    GFX_Disp_Intf_BatchBegin(&blitBatch);
+
+    /* scroll requests are applied here so they are serialized with the
+       blits and land in the same frame as the repaint of the exposed rows.
+       GRAM and the shadow stay as they are, only the panel rows they are
+       shown at move */
+    if(drv.scrollPending == GFX_TRUE)
+    {
+        drv.scroll = drv.pendingScroll;
+        drv.scrollPending = GFX_FALSE;
+
+        //SET_DISPLAY_START_LINE_COMMAND
+        parm = (DRV_SSD1351_START_LINE + drv.scroll) % DRV_SSD1351_GRAM_ROWS;
+        GFX_Disp_Intf_BatchCommand(&blitBatch, 0xa1);
+        GFX_Disp_Intf_BatchData(&blitBatch, &parm, 1);
+
+        /* any command ends the memory write */
+        drv.windowOpen = GFX_FALSE;
+    }
+
+#if DRV_SSD1351_SHADOW_FRAMEBUFFER == 1
+    drv.blitSpanCount = DRV_SSD1351_ShadowDelta(&rgn, blitSpans);
+
+    if(drv.blitSpanCount == 0)
+    {
+        /* the panel already shows these pixels */
+        drv.bytesSkipped += total;
+        drv.blitsSkipped++;
+
+        if(blitBatch.count == 0)
+            return GFX_SUCCESS;
+
+        /* only the scroll command needs to go out */
+#if DRV_SSD1351_BLIT_NONBLOCKING == 1
+        drv.blitSpan = 0;
+        drv.blitPixelCount = 0;
+        drv.blitPixelIdx = 0;
+
+        return DRV_SSD1351_Submit(intf, buf);
+#else
+        DRV_SSD1351_SubmitWait(intf, &blitBatch);
+
+        return GFX_SUCCESS;
+#endif
+    }
+#else
+    blitSpans[0].left = 0;
+    blitSpans[0].top = 0;
+    blitSpans[0].width = rgn.width;
+    blitSpans[0].height = rgn.height;
+
+    drv.blitSpanCount = 1;
+#endif
+
+    drv.blitSpanCount = DRV_SSD1351_WrapSpans(&rgn, blitSpans, drv.blitSpanCount);
+
+    for(i = 0, sent = 0; i < drv.blitSpanCount; i++)
+    {
+        sent += blitSpans[i].width * blitSpans[i].height * PIXEL_BUFFER_BYTES_PER_PIXEL;
+    }
+
+    drv.bytesSkipped += total - sent;
+
+    drv.blitRegion = rgn;
+    drv.blitSpan = 0;
+    drv.blitRow = -1;
+
+    //Add X offset
+    first = &blitSpans[0];
+    last = &blitSpans[drv.blitSpanCount - 1];
+
+    x = rgn.x + first->left + DRV_SSD1351_COLUMN_OFFSET;
+    y = rgn.y + first->top;
+
+    /* band split frames arrive as stacked rects of the same width sorted by
+       y, the GRAM address carries on from the previous band so only its
+       pixels need to be sent. a rect further down carries on too when the
+       rows in between cost less than a new window, they are sent from the
+       shadow */
+    drv.blitGap.height = 0;
+    drv.blitGapRow = 0;
+
+    if(drv.windowOpen == GFX_TRUE &&
+       drv.windowX == x &&
+       drv.windowWidth == first->width &&
+       drv.windowNextRow <= y &&
+       DRV_SSD1351_GramRow(y) - DRV_SSD1351_GramRow(drv.windowNextRow) == y - drv.windowNextRow &&
+       DRV_SSD1351_ShadowGap(x - DRV_SSD1351_COLUMN_OFFSET,
+                             drv.windowNextRow,
+                             first->width,
+                             y - drv.windowNextRow) == GFX_TRUE)
+    {
+        drv.blitRow = 0;
+        sent += drv.blitGap.width * drv.blitGap.height * PIXEL_BUFFER_BYTES_PER_PIXEL;
+    }
+
+    drv.bytesSent += sent;
+
+    /* the last span leaves its window open */
+    drv.windowX = rgn.x + last->left + DRV_SSD1351_COLUMN_OFFSET;
+    drv.windowWidth = last->width;
+    drv.windowNextRow = rgn.y + last->top + last->height;
+
+    /* at the end of GRAM the write pointer returns to the window start */
+    drv.windowOpen = DRV_SSD1351_GramRow(drv.windowNextRow - 1) + 1 < DRV_SSD1351_GRAM_ROWS ? GFX_TRUE : GFX_FALSE;
+
+    DRV_SSD1351_BatchSpans(&blitBatch);
+
+#if DRV_SSD1351_BLIT_NONBLOCKING == 1
+    if(rgn.bigEndian == GFX_TRUE)
+    {
+        /* already in wire order, the rows are sent in place. spans that
+           don't fit the batch follow from the transfer callback */
+        drv.blitPixelCount = 0;
+        drv.blitPixelIdx = 0;
+    }
+    else
+    {
+        /* rows of a byte swapped or indexed region are never cut, so each
+           span is contiguous */
+        DRV_SSD1351_BatchStaged(&blitBatch);
+    }
+
+    /* hold the scratch buffer until the transfer callback releases it */
+    return DRV_SSD1351_Submit(intf, buf);
+#else
+    DRV_SSD1351_WriteRows(intf, &blitBatch);
+
+    return GFX_SUCCESS;
+#endif
+}
+
+gfxDriverIOCTLResponse DRV_SSD1351_IOCTL(gfxDriverIOCTLRequest request,
+                                     void* arg)
+{
+    gfxIOCTLArg_Value* val;
+    gfxIOCTLArg_DisplaySize* disp;
+    gfxIOCTLArg_LayerRect* rect;
+    gfxIOCTLArg_TransferStats* stats;
+    gfxIOCTLArg_Palette* pal;
+    gfxColor clr;
+    uint32_t i;
+
+    switch(request)
+    {
+        case GFX_IOCTL_FRAME_END:
+        {
+            return GFX_IOCTL_OK;
+        }
+        case GFX_IOCTL_GET_COLOR_MODE:
+        {
+            val = (gfxIOCTLArg_Value*)arg;
+
+            val->value.v_colormode = PIXEL_BUFFER_COLOR_MODE;
+
+            return GFX_IOCTL_OK;
+        }
+        case GFX_IOCTL_GET_BUFFER_COUNT:
+        {
+            val = (gfxIOCTLArg_Value*)arg;
+
+            /* this is the number of frame buffers, the SSD1351 has a single
+               GRAM. scratch buffers are counted by LE_SCRATCH_BUFFER_COUNT */
+
+            val->value.v_uint = 1;
+
+            return GFX_IOCTL_OK;
+        }
+        case GFX_IOCTL_GET_DISPLAY_SIZE:
+        {
+            disp = (gfxIOCTLArg_DisplaySize*)arg;
+
+            disp->width = DISPLAY_WIDTH;
+            disp->height = DISPLAY_HEIGHT;
+
+            return GFX_IOCTL_OK;
+        }
+        case GFX_IOCTL_GET_LAYER_COUNT:
+        {
+            val = (gfxIOCTLArg_Value*)arg;
+
+            val->value.v_uint = 1;
+
+            return GFX_IOCTL_OK;
+        }
+        case GFX_IOCTL_GET_ACTIVE_LAYER:
+        {
+            val = (gfxIOCTLArg_Value*)arg;
+
+            val->value.v_uint = 0;
+
+            return GFX_IOCTL_OK;
+        }
+        case GFX_IOCTL_GET_LAYER_RECT:
+        {
+            rect = (gfxIOCTLArg_LayerRect*)arg;
+
+            rect->layer.id = 0;
+            rect->x = 0;
+            rect->y = 0;
+            rect->width = DISPLAY_WIDTH;
+            rect->height = DISPLAY_HEIGHT;
+
+            return GFX_IOCTL_OK;
+        }
+        case GFX_IOCTL_GET_VSYNC_COUNT:
+        {
+            val = (gfxIOCTLArg_Value*)arg;
+
+            val->value.v_uint = swapCount;
+
+            return GFX_IOCTL_OK;
+        }
+        case GFX_IOCTL_GET_TRANSFER_STATS:
+        {
+            stats = (gfxIOCTLArg_TransferStats*)arg;
+
+            stats->bytesSent = drv.bytesSent;
+            stats->bytesSkipped = drv.bytesSkipped;
+            stats->blitsSkipped = drv.blitsSkipped;
+
+            return GFX_IOCTL_OK;
+        }
+        case GFX_IOCTL_SET_PALETTE:
+        {
+            pal = (gfxIOCTLArg_Palette*)arg;
+
+            if(pal->colorCount > DRV_SSD1351_PALETTE_SIZE)
+                return GFX_IOCTL_ERROR_UNKNOWN;
+
+            /* a blit in flight is still being expanded with the old colors */
+            if(drv.state == BLIT)
+                return GFX_IOCTL_ERROR_UNKNOWN;
+
+            for(i = 0; i < pal->colorCount; i++)
+            {
+                clr = 0;
+
+                memcpy(&clr,
+                       (uint8_t*)pal->palette + i * gfxColorInfoTable[pal->mode].size,
+                       gfxColorInfoTable[pal->mode].size);
+
+                clr = gfxColorConvert(pal->mode, PIXEL_BUFFER_COLOR_MODE, clr);
+
+                palette[i] = (uint16_t)(((clr >> 8) & 0xff) | ((clr & 0xff) << 8));
+            }
+
+            return GFX_IOCTL_OK;
+        }
+        case GFX_IOCTL_SET_VERTICAL_SCROLL:
+        {
+            val = (gfxIOCTLArg_Value*)arg;
+
+            /* relative to the scroll still waiting for a blit, if any */
+            drv.pendingScroll = (drv.pendingScroll + DRV_SSD1351_GRAM_ROWS +
+                                 val->value.v_int % DRV_SSD1351_GRAM_ROWS) % DRV_SSD1351_GRAM_ROWS;
+            drv.scrollPending = GFX_TRUE;
+
+            return GFX_IOCTL_OK;
+        }
+#if DRV_SSD1351_BLIT_NONBLOCKING == 1
+        case GFX_IOCTL_SET_BLIT_CALLBACK:
+        {
+            val = (gfxIOCTLArg_Value*)arg;
+
+            drv.blitCallback = (gfxBlitCallBack)val->value.v_pointer;
+
+            return GFX_IOCTL_OK;
+        }
+#endif
+        case GFX_IOCTL_GET_STATUS:
+		{
+            val = (gfxIOCTLArg_Value*)arg;
+
+            if (drv.state == RUN)
+                val->value.v_uint = 0;
+            else
+                val->value.v_uint = 1;
+
+            return GFX_IOCTL_OK;
+	    }
+        default:
+        { }
+    }
+
+    return GFX_IOCTL_UNSUPPORTED;
+}
+
+
+/* The SSD1351 has no fill or copy commands of its own, these operations
+   accelerate the scratch buffer work that Legato otherwise does one pixel at
+   a time. */
+static struct
+{
+    gfxBlend blend;
+    gfxBool globalAlpha;
+} gpu;
+
+static gfxBool DRV_SSD1351_GPU_CanDraw(const gfxPixelBuffer* dest)
+{
+    return dest->mode == PIXEL_BUFFER_COLOR_MODE &&
+           dest->orientation == GFX_ORIENT_0 &&
+           gpu.blend == GFX_BLEND_NONE &&
+           gpu.globalAlpha == GFX_FALSE;
+}
+
+static gfxBool DRV_SSD1351_GPU_ClipRect(const gfxPixelBuffer* buf,
+                                        const gfxRect* rect,
+                                        gfxRect* res)
+{
+    int32_t r, b;
+
+    res->x = rect->x < 0 ? 0 : rect->x;
+    res->y = rect->y < 0 ? 0 : rect->y;
+
+    r = rect->x + rect->width;
+    b = rect->y + rect->height;
+
+    if(r > buf->size.width)
+        r = buf->size.width;
+
+    if(b > buf->size.height)
+        b = buf->size.height;
+
+    res->width = r - res->x;
+    res->height = b - res->y;
+
+    return res->width > 0 && res->height > 0;
+}
+
+gfxResult DRV_SSD1351_GPU_FillRect(gfxPixelBuffer* dest,
+                                   const gfxRect* clipRect,
+                                   const gfxColor color)
+{
+    gfxRect rect;
+    uint16_t clr = color;
+    uint32_t pair;
+    uint16_t* row;
+    uint32_t* words;
+    int32_t i, count;
+
+    if(DRV_SSD1351_GPU_CanDraw(dest) == GFX_FALSE)
+        return GFX_FAILURE;
+
+    if(DRV_SSD1351_GPU_ClipRect(dest, clipRect, &rect) == GFX_FALSE)
+        return GFX_SUCCESS;
+
+    if((dest->flags & GFX_BF_BIG_ENDIAN) > 0)
+    {
+        clr = (uint16_t)((clr << 8) | (clr >> 8));
+    }
+
+    pair = ((uint32_t)clr << 16) | clr;
+
+    /* fill the first row two pixels at a time, then copy it down */
+    row = gfxPixelBufferOffsetGet_Unsafe(dest, rect.x, rect.y);
+    count = rect.width;
+
+    if(((uintptr_t)row & 0x3) != 0)
+    {
+        *row = clr;
+        count--;
+    }
+
+    words = (uint32_t*)(row + (rect.width - count));
+
+    for(i = 0; i < count / 2; i++)
+    {
+        words[i] = pair;
+    }
+
+    if((count & 1) != 0)
+    {
+        row[rect.width - 1] = clr;
+    }
+
+    for(i = 1; i < rect.height; i++)
+    {
+        memcpy(gfxPixelBufferOffsetGet_Unsafe(dest, rect.x, rect.y + i),
+               row,
+               rect.width * PIXEL_BUFFER_BYTES_PER_PIXEL);
+    }
+
+    return GFX_SUCCESS;
+}
+
+gfxResult DRV_SSD1351_GPU_BlitBuffer(const gfxPixelBuffer* source,
+                                     const gfxRect* srcRect,
+                                     const gfxPixelBuffer* dest,
+                                     const gfxRect* destRect)
+{
+    gfxRect rect;
+    const uint16_t* src;
+    uint16_t* dst;
+    int32_t row, col;
+
+    /* straight copies only, no scaling, blending or color conversion */
+    if(DRV_SSD1351_GPU_CanDraw(dest) == GFX_FALSE ||
+       source->mode != dest->mode ||
+       srcRect->width != destRect->width ||
+       srcRect->height != destRect->height)
+        return GFX_FAILURE;
+
+    if(srcRect->x < 0 || srcRect->y < 0 ||
+       srcRect->x + srcRect->width > source->size.width ||
+       srcRect->y + srcRect->height > source->size.height)
+        return GFX_FAILURE;
+
+    if(DRV_SSD1351_GPU_ClipRect(dest, destRect, &rect) == GFX_FALSE)
+        return GFX_SUCCESS;
+
+    for(row = 0; row < rect.height; row++)
+    {
+        src = gfxPixelBufferOffsetGet_Unsafe(source,
+                                             srcRect->x + rect.x - destRect->x,
+                                             srcRect->y + rect.y - destRect->y + row);
+
+        dst = gfxPixelBufferOffsetGet_Unsafe(dest, rect.x, rect.y + row);
+
+        if((dest->flags & GFX_BF_BIG_ENDIAN) == (source->flags & GFX_BF_BIG_ENDIAN))
+        {
+            memcpy(dst, src, rect.width * PIXEL_BUFFER_BYTES_PER_PIXEL);
+        }
+        else
+        {
+            for(col = 0; col < rect.width; col++)
+            {
+                dst[col] = (uint16_t)((src[col] << 8) | (src[col] >> 8));
+            }
+        }
+    }
+
+    return GFX_SUCCESS;
+}
+
+gfxResult DRV_SSD1351_GPU_SetBlend(const gfxBlend blend)
+{
+    gpu.blend = blend;
+
+    return GFX_SUCCESS;
+}
+
+gfxResult DRV_SSD1351_GPU_SetGlobalAlpha(const gfxAlpha srcGlobalAlpha,
+                                         const gfxAlpha dstGlobalAlpha,
+                                         uint32_t srcGlobalAlphaValue,
+                                         uint32_t dstGlobalAlphaValue)
+{
+    (void)dstGlobalAlphaValue;
+
+    gpu.globalAlpha = (srcGlobalAlpha != GFX_GLOBAL_ALPHA_OFF && srcGlobalAlphaValue < 255) ||
+                      (dstGlobalAlpha != GFX_GLOBAL_ALPHA_OFF)
+                      ? GFX_TRUE : GFX_FALSE;
+
+    return GFX_SUCCESS;
+}
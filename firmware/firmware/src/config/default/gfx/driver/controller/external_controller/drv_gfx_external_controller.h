@@ -51,8 +51,32 @@
 #ifndef DRV_GFX_SSD1351_H
 #define DRV_GFX_SSD1351_H
 
+#include "configuration.h"
 #include "gfx/driver/gfx_driver.h"
 
+/* Set to 1 to stream blits in the background. BlitBuffer then returns as
+   soon as the first chunk is queued and keeps the scratch buffer locked
+   until the last chunk has been sent. Set to 0 and every blit spins until
+   its pixels are out. Either way the controller configuration blocks, it is
+   sent once from DRV_SSD1351_Update before the first blit. */
+#ifndef DRV_SSD1351_BLIT_NONBLOCKING
+#define DRV_SSD1351_BLIT_NONBLOCKING        1
+#endif
+
+/* Set to 1 to keep a copy of the GRAM behind the panel, 24 KB. Blits then
+   only send the pixels that changed, and none at all when nothing did. Rows
+   brought into view by GFX_IOCTL_SET_VERTICAL_SCROLL only send what differs
+   from the line that scrolled out of view there. */
+#ifndef DRV_SSD1351_SHADOW_FRAMEBUFFER
+#define DRV_SSD1351_SHADOW_FRAMEBUFFER      1
+#endif
+
+/* Bytes a transfer costs on top of its data. Decides how changed pixels
+   are split into windows and when a blit carries on in the open window. */
+#ifndef DRV_SSD1351_SHADOW_SPAN_COST
+#define DRV_SSD1351_SHADOW_SPAN_COST        8
+#endif
+
 #ifdef __cplusplus
     extern "C" {
 #endif
@@ -117,6 +141,63 @@ static const gfxDisplayDriver gfxDriverInterface =
 	.ioctl = DRV_SSD1351_IOCTL,                
 };
 
+/**
+ * @brief Fill rectangle.
+ * @details Fills <span style="color: #820a32"><em>clipRect</em></span> of the
+ * scratch buffer <span style="color: #820a32"><em>dest</em></span> with a solid
+ * color.
+ * @return GFX_SUCCESS if the fill was performed, GFX_FAILURE if the buffer
+ * format or blend state is not supported.
+ */
+gfxResult DRV_SSD1351_GPU_FillRect(gfxPixelBuffer* dest,
+                                   const gfxRect* clipRect,
+                                   const gfxColor color);
+
+/**
+ * @brief Blit buffer to buffer.
+ * @details Copies <span style="color: #820a32"><em>srcRect</em></span> of
+ * <span style="color: #820a32"><em>source</em></span> into the scratch buffer
+ * <span style="color: #820a32"><em>dest</em></span>, converting the byte order
+ * if the buffers differ.
+ * @return GFX_SUCCESS if the copy was performed, GFX_FAILURE if it needs
+ * scaling, blending or color conversion.
+ */
+gfxResult DRV_SSD1351_GPU_BlitBuffer(const gfxPixelBuffer* source,
+                                     const gfxRect* srcRect,
+                                     const gfxPixelBuffer* dest,
+                                     const gfxRect* destRect);
+
+/**
+ * @brief Set blend mode.
+ * @details Anything other than GFX_BLEND_NONE makes the draw operations
+ * fall back to the CPU.
+ * @return GFX_SUCCESS.
+ */
+gfxResult DRV_SSD1351_GPU_SetBlend(const gfxBlend blend);
+
+/**
+ * @brief Set global alpha.
+ * @details Active global alpha makes the draw operations fall back to the
+ * CPU.
+ * @return GFX_SUCCESS.
+ */
+gfxResult DRV_SSD1351_GPU_SetGlobalAlpha(const gfxAlpha srcGlobalAlpha,
+                                         const gfxAlpha dstGlobalAlpha,
+                                         uint32_t srcGlobalAlphaValue,
+                                         uint32_t dstGlobalAlphaValue);
+
+/**
+ * @brief Defines the External Controller graphics processor functions.
+ * @details Scratch buffer fill and copy operations for the Legato renderer.
+ */
+static const gfxGraphicsProcessor gfxSSD1351GPUInterface =
+{
+    .fillRect = DRV_SSD1351_GPU_FillRect,
+    .blitBuffer = DRV_SSD1351_GPU_BlitBuffer,
+    .setBlend = DRV_SSD1351_GPU_SetBlend,
+    .setGlobalAlpha = DRV_SSD1351_GPU_SetGlobalAlpha,
+};
+
 #ifdef __cplusplus
     }
 #endif
@@ -491,6 +491,7 @@ enum gfxBufferFlags
 {
     GFX_BF_NONE = 0,
     GFX_BF_LOCKED = 1 << 0,
+    GFX_BF_BIG_ENDIAN = 1 << 1, // multi-byte pixels are stored MSB first
 };
 
 // *****************************************************************************
@@ -1063,6 +1064,9 @@ typedef enum gfxDriverIOCTLRequest
     GFX_IOCTL_SET_BLIT_CALLBACK, // set a callback for scratch buffer blit completion, arg = gfxIOCTLArg_Value
     GFX_IOCTL_SET_IRQ_CALLBACK, // set a callback for the driver IRQ, arg = gfxIOCTLArg_LayerValue
 
+    GFX_IOCTL_SET_VERTICAL_SCROLL, // scrolls the display content up by v_int rows, down when negative, arg = gfxIOCTLArg_Value
+    GFX_IOCTL_GET_TRANSFER_STATS, // gets the display transfer counters, arg = gfxIOCTLArg_TransferStats
+
 } gfxDriverIOCTLRequest;
 
 #define GFX_IOCTL_LAYER_REQ_START GFX_IOCTL_SET_LAYER_LOCK
@@ -1193,6 +1197,18 @@ typedef struct
     } value;
 } gfxIOCTLArg_LayerValue;
 
+/**
+ * @brief This struct represents display transfer counters.
+ * @details Counts the pixel bytes a driver sent to the display and the ones
+ * it left out because the display already showed them.
+ */
+typedef struct
+{
+    uint32_t bytesSent;
+    uint32_t bytesSkipped;
+    uint32_t blitsSkipped;
+} gfxIOCTLArg_TransferStats;
+
 /**
  * @brief This struct represents the display driver interface.
  * @details Establishes the interface for a Legato display driver.  All drivers
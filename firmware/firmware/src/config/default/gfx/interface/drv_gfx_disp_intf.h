@@ -109,6 +109,74 @@ typedef enum
     GFX_DISP_INTF_PIN_SET = 1,
 } GFX_DISP_INTF_PIN_VALUE;
 
+/** GFX_DISP_INTF_CLOCK_PROFILE
+
+  Summary:
+    Enum of GFX Intf clock profiles.
+
+*/
+/**
+ * @brief This enum represents display interface clock profiles
+ * @details The slow profile is used while the controller is reset and
+ * configured. The fast profile is the highest clock the controller accepts
+ * for display RAM writes.
+ */
+typedef enum
+{
+    GFX_DISP_INTF_CLOCK_SLOW,    //Reset and configuration sequence
+    GFX_DISP_INTF_CLOCK_FAST,    //Display RAM writes
+} GFX_DISP_INTF_CLOCK_PROFILE;
+
+/* Maximum number of segments in a command batch */
+#ifndef GFX_DISP_INTF_BATCH_SEGMENTS
+#define GFX_DISP_INTF_BATCH_SEGMENTS    16
+#endif
+
+/* Bytes of command and parameter storage in a command batch */
+#ifndef GFX_DISP_INTF_BATCH_BYTES
+#define GFX_DISP_INTF_BATCH_BYTES       32
+#endif
+
+/** GFX_DISP_INTF_BATCH_SEGMENT
+
+  Summary:
+    A run of bytes sent with one RS/DCx level.
+
+*/
+/**
+ * @brief This struct represents one segment of a command batch
+ * @details Consecutive bytes with the same RS/DCx level that are stored
+ * next to each other are merged into a single segment, each segment is
+ * sent as one interface transfer.
+ */
+typedef struct
+{
+    uint8_t * data;
+    uint32_t bytes;
+    GFX_DISP_INTF_PIN_VALUE rsdc;
+} GFX_DISP_INTF_BATCH_SEGMENT;
+
+/** GFX_DISP_INTF_BATCH
+
+  Summary:
+    A list of command and data writes that is sent as one transaction.
+
+*/
+/**
+ * @brief This struct represents a command batch
+ * @details Commands and their parameters are copied into the batch, pixel
+ * streams are referenced. The batch is built with GFX_Disp_Intf_BatchBegin,
+ * GFX_Disp_Intf_BatchCommand, GFX_Disp_Intf_BatchData and
+ * GFX_Disp_Intf_BatchDataRef and sent with GFX_Disp_Intf_BatchSubmit.
+ */
+typedef struct
+{
+    GFX_DISP_INTF_BATCH_SEGMENT segments[GFX_DISP_INTF_BATCH_SEGMENTS];
+    uint32_t count;
+    uint8_t storage[GFX_DISP_INTF_BATCH_BYTES];
+    uint32_t used;
+} GFX_DISP_INTF_BATCH;
+
 /** GFX_Disp_Intf_Callback
 
   Summary:
@@ -313,7 +381,48 @@ int GFX_Disp_Intf_WriteCommandParm(GFX_Disp_Intf intf, uint8_t cmd, uint8_t * pa
  */
 int GFX_Disp_Intf_WriteData(GFX_Disp_Intf intf, uint8_t * data, int bytes);
 
-/** 
+/**
+  Function:
+    int GFX_Disp_Intf_WriteDataAsync(GFX_Disp_Intf intf, uint8_t * data, int bytes)
+
+  Summary:
+    Deasserts the RS/DCx control pin (HIGH) and queues the byte stream to the
+    interface without waiting for the transfer to complete
+
+  Description:
+    The data buffer must remain valid until the transfer is done. Completion
+    is reported through the callback registered with GFX_Disp_Intf_Set_Callback,
+    which may be called from interrupt context.
+
+  Parameters:
+    intf - the interface handle
+    data - the byte stream
+    bytes - the number of bytes in the data stream
+
+  Returns:
+    * 0       - Transfer queued
+    * -1       - Operation failed
+*/
+/**
+ * @brief Queue data bytes.
+ * @details Queues the data byte stream <span class="param">data</span>
+ * using <span class="param">intf</span> and returns without waiting for
+ * the transfer to finish. The number of bytes are specified
+ * by <span class="param">bytes</span>.
+ * @remark Deasserts the RS/DCx control pin (HIGH). The buffer must remain
+ * valid until the interface callback reports GFX_DISP_INTF_TX_DONE. The
+ * callback may be called from interrupt context.
+ * @code
+ * GFX_Disp_Intf intf;
+ * uint8_t * data;
+ * int bytes;
+ * int res = GFX_Disp_Intf_WriteDataAsync(intf, data, bytes);
+ * @endcode
+ * @return 0 if the transfer was queued, otherwise -1.
+ */
+int GFX_Disp_Intf_WriteDataAsync(GFX_Disp_Intf intf, uint8_t * data, int bytes);
+
+/**
   Function:
     int GFX_Disp_Intf_WriteData16(GFX_Disp_Intf intf, uint16_t * data, int num)
 
@@ -630,6 +739,204 @@ int GFX_Disp_Intf_Ready(GFX_Disp_Intf intf);
  */
 int GFX_Disp_Intf_Set_Callback(GFX_Disp_Intf intf, GFX_Disp_Intf_Callback cb, void * parm);
 
+/**
+  Function:
+    int GFX_Disp_Intf_SetClockProfile(GFX_Disp_Intf intf, GFX_DISP_INTF_CLOCK_PROFILE profile)
+
+  Summary:
+    Selects the interface clock used for the following transfers. The interface
+    must be idle when this is called.
+
+  Description:
+
+  Parameters:
+    intf - the interface handle
+    profile - the clock profile
+
+  Returns:
+    * 0       - Operation successful
+    * -1       - Operation failed
+*/
+/**
+ * @brief Set interface clock profile.
+ * @details Selects clock profile <span class="param">profile</span>
+ * for the following transfers on <span class="param">intf</span>.
+ * GFX_Disp_Intf_Open starts with GFX_DISP_INTF_CLOCK_SLOW.
+ * @code
+ * GFX_Disp_Intf intf;
+ * int res = GFX_Disp_Intf_SetClockProfile(intf, GFX_DISP_INTF_CLOCK_FAST);
+ * @endcode
+ * @return 0 if successful, otherwise -1.
+ */
+int GFX_Disp_Intf_SetClockProfile(GFX_Disp_Intf intf, GFX_DISP_INTF_CLOCK_PROFILE profile);
+
+/**
+  Function:
+    void GFX_Disp_Intf_BatchBegin(GFX_DISP_INTF_BATCH * batch)
+
+  Summary:
+    Empties a command batch.
+
+  Description:
+
+  Parameters:
+    batch - the command batch
+
+  Returns:
+    None
+*/
+/**
+ * @brief Start a command batch.
+ * @details Empties <span class="param">batch</span> so commands and data
+ * can be added to it.
+ * @code
+ * GFX_DISP_INTF_BATCH batch;
+ * GFX_Disp_Intf_BatchBegin(&batch);
+ * @endcode
+ * @return void.
+ */
+void GFX_Disp_Intf_BatchBegin(GFX_DISP_INTF_BATCH * batch);
+
+/**
+  Function:
+    int GFX_Disp_Intf_BatchCommand(GFX_DISP_INTF_BATCH * batch, uint8_t cmd)
+
+  Summary:
+    Adds a command byte to a command batch, sent with the RS/DCx control pin
+    asserted (LOW)
+
+  Description:
+
+  Parameters:
+    batch - the command batch
+    cmd - the command
+
+  Returns:
+    * 0       - Operation successful
+    * -1       - The batch is full
+*/
+/**
+ * @brief Add a command to a batch.
+ * @details Copies command <span class="param">cmd</span> into
+ * <span class="param">batch</span>. Consecutive commands are sent in one
+ * transfer.
+ * @code
+ * GFX_DISP_INTF_BATCH batch;
+ * int res = GFX_Disp_Intf_BatchCommand(&batch, 0x5c);
+ * @endcode
+ * @return 0 if successful, -1 if the batch is full.
+ */
+int GFX_Disp_Intf_BatchCommand(GFX_DISP_INTF_BATCH * batch, uint8_t cmd);
+
+/**
+  Function:
+    int GFX_Disp_Intf_BatchData(GFX_DISP_INTF_BATCH * batch, uint8_t * data, int bytes)
+
+  Summary:
+    Copies parameter bytes into a command batch, sent with the RS/DCx
+    control pin deasserted (HIGH)
+
+  Description:
+    Meant for command parameters, the bytes must fit in the batch storage.
+
+  Parameters:
+    batch - the command batch
+    data - the parameter bytes
+    bytes - the number of bytes
+
+  Returns:
+    * 0       - Operation successful
+    * -1       - The batch is full
+*/
+/**
+ * @brief Add parameter bytes to a batch.
+ * @details Copies <span class="param">bytes</span> bytes from
+ * <span class="param">data</span> into <span class="param">batch</span>.
+ * Consecutive parameters are sent in one transfer.
+ * @code
+ * GFX_DISP_INTF_BATCH batch;
+ * uint8_t parm[2];
+ * int res = GFX_Disp_Intf_BatchData(&batch, parm, 2);
+ * @endcode
+ * @return 0 if successful, -1 if the batch is full.
+ */
+int GFX_Disp_Intf_BatchData(GFX_DISP_INTF_BATCH * batch, uint8_t * data, int bytes);
+
+/**
+  Function:
+    int GFX_Disp_Intf_BatchDataRef(GFX_DISP_INTF_BATCH * batch, uint8_t * data, int bytes)
+
+  Summary:
+    Adds a data stream to a command batch without copying it, sent with the
+    RS/DCx control pin deasserted (HIGH)
+
+  Description:
+    The data must remain valid until the batch has been sent.
+
+  Parameters:
+    batch - the command batch
+    data - the byte stream
+    bytes - the number of bytes in the data stream
+
+  Returns:
+    * 0       - Operation successful
+    * -1       - The batch is full
+*/
+/**
+ * @brief Add a data stream to a batch.
+ * @details References <span class="param">bytes</span> bytes at
+ * <span class="param">data</span> from <span class="param">batch</span>.
+ * @remark The data is not copied, it must remain valid until the batch
+ * has been sent.
+ * @code
+ * GFX_DISP_INTF_BATCH batch;
+ * uint8_t * pixels;
+ * int bytes;
+ * int res = GFX_Disp_Intf_BatchDataRef(&batch, pixels, bytes);
+ * @endcode
+ * @return 0 if successful, -1 if the batch is full.
+ */
+int GFX_Disp_Intf_BatchDataRef(GFX_DISP_INTF_BATCH * batch, uint8_t * data, int bytes);
+
+/**
+  Function:
+    int GFX_Disp_Intf_BatchSubmit(GFX_Disp_Intf intf, GFX_DISP_INTF_BATCH * batch)
+
+  Summary:
+    Queues a command batch to the interface without waiting for it to
+    complete
+
+  Description:
+    The segments are sent back to back with chip select held asserted, the
+    RS/DCx control pin only changes between segments of different levels.
+    The batch must not be modified until it has been sent. Completion of the
+    whole batch is reported once through the callback registered with
+    GFX_Disp_Intf_Set_Callback, which may be called from interrupt context,
+    and GFX_Disp_Intf_Ready returns true again.
+
+  Parameters:
+    intf - the interface handle
+    batch - the command batch
+
+  Returns:
+    * 0       - Batch queued
+    * -1       - Operation failed
+*/
+/**
+ * @brief Queue a command batch.
+ * @details Queues all segments of <span class="param">batch</span> using
+ * <span class="param">intf</span> and returns without waiting.
+ * @remark The batch must remain valid until the interface callback reports
+ * GFX_DISP_INTF_TX_DONE. The callback may be called from interrupt context.
+ * @code
+ * GFX_Disp_Intf intf;
+ * GFX_DISP_INTF_BATCH batch;
+ * int res = GFX_Disp_Intf_BatchSubmit(intf, &batch);
+ * @endcode
+ * @return 0 if the batch was queued, otherwise -1.
+ */
+int GFX_Disp_Intf_BatchSubmit(GFX_Disp_Intf intf, GFX_DISP_INTF_BATCH * batch);
+
 
     /* Provide C++ Compatibility */
 #ifdef __cplusplus
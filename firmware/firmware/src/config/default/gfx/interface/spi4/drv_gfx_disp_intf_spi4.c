@@ -38,6 +38,9 @@
     Created with MPLAB Harmony Version 3.0
  *******************************************************************************/
 
+#include <string.h>
+
+#include "configuration.h"
 #include "driver/spi/drv_spi.h"
 
 #include "../drv_gfx_disp_intf.h"
@@ -52,6 +55,17 @@
 
 #define DRV_SPI_INDEX 0
 
+/* SPI clock for the reset and configuration sequence */
+#ifndef GFX_DISP_INTF_SPI_CLOCK_SLOW_HZ
+#define GFX_DISP_INTF_SPI_CLOCK_SLOW_HZ 1000000
+#endif
+
+/* SPI clock for display RAM writes. The SSD1351 serial clock cycle is 220ns
+   minimum, the fastest SERCOM1 rate from 64MHz that meets it is 4MHz */
+#ifndef GFX_DISP_INTF_SPI_CLOCK_FAST_HZ
+#define GFX_DISP_INTF_SPI_CLOCK_FAST_HZ 4000000
+#endif
+
 /** SPI_TRANS_STATUS
 
   Summary:
@@ -88,12 +102,70 @@ typedef struct
 
     /* SPI interface callback param*/
     void * callback_parm;
+
+    /* SPI transfer setup */
+    DRV_SPI_TRANSFER_SETUP setup;
+
+    /* Command batch being sent, NULL if none */
+    GFX_DISP_INTF_BATCH * volatile batch;
+
+    /* Batch segments handed to the SPI driver and completed by it */
+    volatile uint32_t batchQueued;
+    volatile uint32_t batchDone;
 } GFX_DISP_INTF_SPI;
 
 static GFX_DISP_INTF_SPI spiIntf;
 
 /* ************************************************************************** */
 
+/**
+  Function:
+    static int GFX_Disp_Intf_BatchQueue(GFX_DISP_INTF_SPI * spiIntfPtr)
+
+  Summary:
+    Hands the next batch segments to the SPI driver.
+
+  Description:
+    Keeps up to DRV_SPI_QUEUE_SIZE_IDX0 segments queued so they are started
+    back to back. The SPI driver calls the event handler before it starts the
+    next queued transfer, which is where the RS/DCx pin is set for it.
+
+  Parameters:
+    spiIntfPtr      - the SPI interface
+
+  Returns:
+    * 0       - Operation successful
+    * -1       - Operation failed
+
+ */
+static int GFX_Disp_Intf_BatchQueue(GFX_DISP_INTF_SPI * spiIntfPtr)
+{
+    GFX_DISP_INTF_BATCH * batch = spiIntfPtr->batch;
+    GFX_DISP_INTF_BATCH_SEGMENT * seg;
+
+    while (spiIntfPtr->batchQueued < batch->count &&
+           spiIntfPtr->batchQueued - spiIntfPtr->batchDone < DRV_SPI_QUEUE_SIZE_IDX0)
+    {
+        seg = &batch->segments[spiIntfPtr->batchQueued];
+
+        spiIntfPtr->batchQueued++;
+
+        DRV_SPI_WriteTransferAdd(spiIntfPtr->drvSPIHandle,
+                                (void *) seg->data,
+                                (size_t) seg->bytes,
+                                (void *) &spiIntfPtr->drvSPITransferHandle);
+
+        if (DRV_SPI_TRANSFER_HANDLE_INVALID == spiIntfPtr->drvSPITransferHandle)
+        {
+            spiIntfPtr->batchQueued--;
+
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
 /** 
   Function:
     static void GFX_Disp_Intf_CallBack(DRV_SPI_BUFFER_EVENT event, 
@@ -106,7 +178,8 @@ static GFX_DISP_INTF_SPI spiIntf;
   Description:
 
     This callback will set the ILI9488 SPI driver's SPI transaction status 
-    based on the event.
+    based on the event. While a command batch is being sent it moves on to
+    the next segment and only reports the completion of the whole batch.
 
 
   Parameters:
@@ -124,10 +197,38 @@ static void GFX_Disp_Intf_CallBack(DRV_SPI_TRANSFER_EVENT event,
 {
     volatile GFX_DISP_INTF_SPI_TRANS_STATUS *status = 
                     ((GFX_DISP_INTF_SPI_TRANS_STATUS *) context);
+    GFX_DISP_INTF_BATCH * batch = spiIntf.batch;
 
    if (!status)
         return;
 
+    if (batch != NULL && event == DRV_SPI_TRANSFER_EVENT_COMPLETE)
+    {
+        spiIntf.batchDone++;
+
+        if (spiIntf.batchDone < batch->count)
+        {
+            /* the next segment is started after this handler returns */
+            if (batch->segments[spiIntf.batchDone].rsdc == GFX_DISP_INTF_PIN_CLEAR)
+            {
+                GFX_DISP_INTF_PIN_RSDC_Clear();
+            }
+            else
+            {
+                GFX_DISP_INTF_PIN_RSDC_Set();
+            }
+
+            if (GFX_Disp_Intf_BatchQueue(&spiIntf) == 0)
+                return;
+
+            event = DRV_SPI_TRANSFER_EVENT_ERROR;
+        }
+    }
+
+    spiIntf.batch = NULL;
+
+    GFX_DISP_INTF_PIN_CS_Set();
+
     switch (event) 
     {
         case DRV_SPI_TRANSFER_EVENT_COMPLETE:
@@ -146,6 +247,15 @@ static void GFX_Disp_Intf_CallBack(DRV_SPI_TRANSFER_EVENT event,
         case DRV_SPI_TRANSFER_EVENT_ERROR:
         {
             *status = SPI_TRANS_FAIL;
+
+            if (spiIntf.callback != NULL)
+            {
+                spiIntf.callback((GFX_Disp_Intf) &spiIntf,
+                                       GFX_DISP_INTF_ERROR,
+                                       spiIntf.callback_parm);
+            }
+
+            break;
         }
         default:
         {
@@ -156,14 +266,16 @@ static void GFX_Disp_Intf_CallBack(DRV_SPI_TRANSFER_EVENT event,
 
 GFX_Disp_Intf GFX_Disp_Intf_Open(void)
 {   
-    DRV_SPI_TRANSFER_SETUP setup;
+    DRV_SPI_TRANSFER_SETUP* setup = &spiIntf.setup;
     
-    setup.baudRateInHz = 1000000;
-    setup.clockPhase = DRV_SPI_CLOCK_PHASE_VALID_LEADING_EDGE;
-    setup.clockPolarity = DRV_SPI_CLOCK_POLARITY_IDLE_LOW;
-    setup.dataBits = DRV_SPI_DATA_BITS_8;
-    setup.chipSelect = GFX_DISP_INTF_PIN_CS_PIN;
-    setup.csPolarity = DRV_SPI_CS_POLARITY_ACTIVE_LOW;
+    setup->baudRateInHz = GFX_DISP_INTF_SPI_CLOCK_SLOW_HZ;
+    setup->clockPhase = DRV_SPI_CLOCK_PHASE_VALID_LEADING_EDGE;
+    setup->clockPolarity = DRV_SPI_CLOCK_POLARITY_IDLE_LOW;
+    setup->dataBits = DRV_SPI_DATA_BITS_8;
+    /* chip select is driven here so it can stay asserted across the
+       transfers of a command batch */
+    setup->chipSelect = SYS_PORT_PIN_NONE;
+    setup->csPolarity = DRV_SPI_CS_POLARITY_ACTIVE_LOW;
 
     spiIntf.drvSPIHandle = DRV_SPI_Open(0, DRV_IO_INTENT_READWRITE);
     
@@ -172,7 +284,7 @@ GFX_Disp_Intf GFX_Disp_Intf_Open(void)
         return 0;
     }
 
-    if (DRV_SPI_TransferSetup(spiIntf.drvSPIHandle, &setup) != true)
+    if (DRV_SPI_TransferSetup(spiIntf.drvSPIHandle, setup) != true)
     {
         return 0;
     }
@@ -287,6 +399,36 @@ int GFX_Disp_Intf_WriteData(GFX_Disp_Intf intf, uint8_t * data, int bytes)
     return GFX_Disp_Intf_Write(intf, data, bytes);
 }
 
+int GFX_Disp_Intf_WriteDataAsync(GFX_Disp_Intf intf, uint8_t * data, int bytes)
+{
+    GFX_DISP_INTF_SPI * spiIntfPtr = (GFX_DISP_INTF_SPI *) intf;
+
+    if (spiIntfPtr == NULL || bytes == 0 || data == NULL)
+        return -1;
+
+    GFX_DISP_INTF_PIN_RSDC_Set();
+
+    spiIntfPtr->drvSPITransStatus = SPI_TRANS_CMD_WR_PENDING;
+
+    GFX_DISP_INTF_PIN_CS_Clear();
+
+    DRV_SPI_WriteTransferAdd(spiIntfPtr->drvSPIHandle,
+                            (void *) data,
+                            (size_t) bytes,
+                            (void *) &spiIntfPtr->drvSPITransferHandle);
+
+    if (DRV_SPI_TRANSFER_HANDLE_INVALID == spiIntfPtr->drvSPITransferHandle)
+    {
+        GFX_DISP_INTF_PIN_CS_Set();
+
+        spiIntfPtr->drvSPITransStatus = SPI_TRANS_FAIL;
+
+        return -1;
+    }
+
+    return 0;
+}
+
 int GFX_Disp_Intf_ReadData(GFX_Disp_Intf intf, uint8_t * data, int bytes)
 {
     GFX_DISP_INTF_PIN_RSDC_Set();
@@ -335,6 +477,8 @@ int GFX_Disp_Intf_Write(GFX_Disp_Intf intf, uint8_t * data, int bytes)
     
     spiIntfPtr->drvSPITransStatus = SPI_TRANS_CMD_WR_PENDING;
     
+    GFX_DISP_INTF_PIN_CS_Clear();
+
     DRV_SPI_WriteTransferAdd(spiIntfPtr->drvSPIHandle,
                             (void *) data,
                             (size_t) bytes,
@@ -342,6 +486,8 @@ int GFX_Disp_Intf_Write(GFX_Disp_Intf intf, uint8_t * data, int bytes)
                             
     if (DRV_SPI_TRANSFER_HANDLE_INVALID == spiIntfPtr->drvSPITransferHandle)
     {
+        GFX_DISP_INTF_PIN_CS_Set();
+
         return -1;
     }
     
@@ -361,13 +507,19 @@ int GFX_Disp_Intf_Read(GFX_Disp_Intf intf, uint8_t * data, int bytes)
     // Read the valid pixels
     spiIntfPtr->drvSPITransStatus = SPI_TRANS_CMD_RD_PENDING;
     
+    GFX_DISP_INTF_PIN_CS_Clear();
+
     DRV_SPI_ReadTransferAdd(spiIntfPtr->drvSPIHandle,
                             (void *) data,
                             bytes,
                             (void *) &spiIntfPtr->drvSPITransferHandle);
                             
     if (DRV_SPI_TRANSFER_HANDLE_INVALID == spiIntfPtr->drvSPITransferHandle)
+    {
+        GFX_DISP_INTF_PIN_CS_Set();
+
         return -1;
+    }
 
     while(!GFX_Disp_Intf_Ready(intf));
     
@@ -402,6 +554,167 @@ int GFX_Disp_Intf_Set_Callback(GFX_Disp_Intf intf, GFX_Disp_Intf_Callback cb, vo
     return 0;
 }
 
+int GFX_Disp_Intf_SetClockProfile(GFX_Disp_Intf intf, GFX_DISP_INTF_CLOCK_PROFILE profile)
+{
+    GFX_DISP_INTF_SPI * spiIntfPtr = (GFX_DISP_INTF_SPI *) intf;
+
+    if (spiIntfPtr == NULL)
+        return -1;
+
+    switch(profile)
+    {
+        case GFX_DISP_INTF_CLOCK_SLOW:
+        {
+            spiIntfPtr->setup.baudRateInHz = GFX_DISP_INTF_SPI_CLOCK_SLOW_HZ;
+
+            break;
+        }
+        case GFX_DISP_INTF_CLOCK_FAST:
+        {
+            spiIntfPtr->setup.baudRateInHz = GFX_DISP_INTF_SPI_CLOCK_FAST_HZ;
+
+            break;
+        }
+        default:
+        {
+            return -1;
+        }
+    }
+
+    /* applied by the SPI driver when the next transfer starts */
+    if (DRV_SPI_TransferSetup(spiIntfPtr->drvSPIHandle, &spiIntfPtr->setup) != true)
+        return -1;
+
+    return 0;
+}
+
+void GFX_Disp_Intf_BatchBegin(GFX_DISP_INTF_BATCH * batch)
+{
+    batch->count = 0;
+    batch->used = 0;
+}
+
+static int GFX_Disp_Intf_BatchAdd(GFX_DISP_INTF_BATCH * batch,
+                                  uint8_t * data,
+                                  int bytes,
+                                  GFX_DISP_INTF_PIN_VALUE rsdc)
+{
+    GFX_DISP_INTF_BATCH_SEGMENT * seg;
+
+    if (batch == NULL || data == NULL || bytes <= 0)
+        return -1;
+
+    /* extend the previous segment if the bytes follow it in memory at the
+       same RS/DCx level, this is what merges commands and parameters */
+    if (batch->count > 0)
+    {
+        seg = &batch->segments[batch->count - 1];
+
+        if (seg->rsdc == rsdc && seg->data + seg->bytes == data)
+        {
+            seg->bytes += bytes;
+
+            return 0;
+        }
+    }
+
+    if (batch->count == GFX_DISP_INTF_BATCH_SEGMENTS)
+        return -1;
+
+    seg = &batch->segments[batch->count++];
+
+    seg->data = data;
+    seg->bytes = bytes;
+    seg->rsdc = rsdc;
+
+    return 0;
+}
+
+static int GFX_Disp_Intf_BatchCopy(GFX_DISP_INTF_BATCH * batch,
+                                   uint8_t * data,
+                                   int bytes,
+                                   GFX_DISP_INTF_PIN_VALUE rsdc)
+{
+    uint8_t * dest;
+
+    if (batch == NULL || data == NULL || bytes <= 0 ||
+        batch->used + bytes > GFX_DISP_INTF_BATCH_BYTES)
+        return -1;
+
+    dest = &batch->storage[batch->used];
+
+    if (GFX_Disp_Intf_BatchAdd(batch, dest, bytes, rsdc) != 0)
+        return -1;
+
+    memcpy(dest, data, bytes);
+
+    batch->used += bytes;
+
+    return 0;
+}
+
+int GFX_Disp_Intf_BatchCommand(GFX_DISP_INTF_BATCH * batch, uint8_t cmd)
+{
+    return GFX_Disp_Intf_BatchCopy(batch, &cmd, 1, GFX_DISP_INTF_PIN_CLEAR);
+}
+
+int GFX_Disp_Intf_BatchData(GFX_DISP_INTF_BATCH * batch, uint8_t * data, int bytes)
+{
+    return GFX_Disp_Intf_BatchCopy(batch, data, bytes, GFX_DISP_INTF_PIN_SET);
+}
+
+int GFX_Disp_Intf_BatchDataRef(GFX_DISP_INTF_BATCH * batch, uint8_t * data, int bytes)
+{
+    return GFX_Disp_Intf_BatchAdd(batch, data, bytes, GFX_DISP_INTF_PIN_SET);
+}
+
+int GFX_Disp_Intf_BatchSubmit(GFX_Disp_Intf intf, GFX_DISP_INTF_BATCH * batch)
+{
+    GFX_DISP_INTF_SPI * spiIntfPtr = (GFX_DISP_INTF_SPI *) intf;
+
+    if (spiIntfPtr == NULL || batch == NULL || batch->count == 0 ||
+        spiIntfPtr->batch != NULL)
+        return -1;
+
+    spiIntfPtr->drvSPITransStatus = SPI_TRANS_CMD_WR_PENDING;
+
+    spiIntfPtr->batchQueued = 0;
+    spiIntfPtr->batchDone = 0;
+    spiIntfPtr->batch = batch;
+
+    if (batch->segments[0].rsdc == GFX_DISP_INTF_PIN_CLEAR)
+    {
+        GFX_DISP_INTF_PIN_RSDC_Clear();
+    }
+    else
+    {
+        GFX_DISP_INTF_PIN_RSDC_Set();
+    }
+
+    GFX_DISP_INTF_PIN_CS_Clear();
+
+    /* only the first segment is queued from here, the rest is topped up from
+       the SPI event handler so the queue is never filled from two contexts */
+    spiIntfPtr->batchQueued = 1;
+
+    DRV_SPI_WriteTransferAdd(spiIntfPtr->drvSPIHandle,
+                            (void *) batch->segments[0].data,
+                            (size_t) batch->segments[0].bytes,
+                            (void *) &spiIntfPtr->drvSPITransferHandle);
+
+    if (DRV_SPI_TRANSFER_HANDLE_INVALID == spiIntfPtr->drvSPITransferHandle)
+    {
+        GFX_DISP_INTF_PIN_CS_Set();
+
+        spiIntfPtr->batch = NULL;
+        spiIntfPtr->drvSPITransStatus = SPI_TRANS_FAIL;
+
+        return -1;
+    }
+
+    return 0;
+}
+
 /* *****************************************************************************
  End of File
  */
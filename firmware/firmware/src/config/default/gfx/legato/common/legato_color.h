@@ -73,6 +73,7 @@ typedef uint32_t leColor;
 #define RGB_565_RED_MASK       0xF800
 #define RGB_565_GREEN_MASK     0x7E0
 #define RGB_565_BLUE_MASK      0x1F
+#define RGB_565_SPLIT_MASK     0x07E0F81F // green moved clear of red and blue
 
 #define RGBA_5551_RED_MASK     0xF800
 #define RGBA_5551_GREEN_MASK   0x7C0
@@ -588,6 +589,43 @@ leColor leColorBlend_RGBA_8888(leColor fore, leColor back);
  */
 leColor leColorBlend_ARGB_8888(leColor fore, leColor back);
 
+// *****************************************************************************
+/* Function:
+    leColor leColorBlend_RGB_565(leColor fore, leColor back, uint32_t a)
+
+  Summary:
+    Blends an RGB565 color over another one with an alpha value.
+
+  Description:
+    Works on the packed pixels without converting them to RGBA8888.  The
+    alpha value is reduced to 33 levels, the result may differ from an
+    RGBA8888 blend by one in each channel.
+
+  Parameters:
+    leColor - the foreground color
+    leColor - the background color
+    uint32_t - the foreground alpha value [0-255]
+
+  Returns:
+    leColor - the blended result color
+*/
+/**
+ * @brief Get color from RGB565 blend
+ * @details Gets a color from the blend of RGB565 <span class="param">fore</span>
+ * over RGB565 <span class="param">back</span> with alpha
+ * <span class="param">a</span>.
+ * @code
+ * leColor fore;
+ * leColor back;
+ * leColor blend = leColorBlend_RGB_565(fore, back, 128);
+ * @endcode
+ * @param fore is the foreground color.
+ * @param back is the background color
+ * @param a is the foreground alpha value.
+ * @return the blended result color.
+ */
+leColor leColorBlend_RGB_565(leColor fore, leColor back, uint32_t a);
+
 // *****************************************************************************
 /* Function:
     leColor leColorLerp(leColor l,
@@ -172,3 +172,20 @@ leColor leColorBlend_ARGB_8888(leColor c1, leColor c2)
     
     return result;
 }
+
+leColor leColorBlend_RGB_565(leColor fore, leColor back, uint32_t a)
+{
+    uint32_t f;
+    uint32_t b;
+
+    // 0-255 to 0-32, the fields below have five spare bits
+    a = (a + 4) >> 3;
+
+    // green moves to the upper half so each field has room to be multiplied
+    f = (fore | (fore << 16)) & RGB_565_SPLIT_MASK;
+    b = (back | (back << 16)) & RGB_565_SPLIT_MASK;
+
+    b = (b + (((f - b) * a) >> 5)) & RGB_565_SPLIT_MASK;
+
+    return (b | (b >> 16)) & 0xFFFF;
+}
@@ -0,0 +1,327 @@
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2020 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+#include "gfx/legato/core/legato_command.h"
+
+#include <string.h>
+
+#include "gfx/legato/core/legato_state.h"
+#include "gfx/legato/renderer/legato_renderer.h"
+#include "gfx/legato/string/legato_fixedstring.h"
+
+#if LE_LABEL_WIDGET_ENABLED == 1
+#include "gfx/legato/widget/label/legato_widget_label.h"
+#endif
+
+#if LE_TEXTFIELD_WIDGET_ENABLED == 1
+#include "gfx/legato/widget/textfield/legato_widget_textfield.h"
+#endif
+
+// one slot stays empty so a full ring can be told from an empty one.  head is
+// only written by the producer, tail only by the consumer
+static leCommand _ring[LE_COMMAND_QUEUE_SIZE];
+static volatile uint32_t _head;
+static volatile uint32_t _tail;
+
+// latest change per widget property, in the order the properties were first
+// changed
+static leCommand _pending[LE_COMMAND_QUEUE_SIZE];
+static uint32_t _pendingCount;
+
+static uint32_t _minPeriod = LE_COMMAND_MAX_FPS > 0 ? 1000 / LE_COMMAND_MAX_FPS : 0; // ms between batches
+static uint32_t _sinceApply = UINT32_MAX; // ms since the last batch, saturates
+static leCommandClock _clock;
+static uint32_t _clockTime; // clock reading _sinceApply was last advanced at
+
+// each field has a single writer, the producer or the consumer
+static leCommandStats _stats;
+
+// the string queued text is handed to the widgets in
+static leFixedString _string;
+static leChar _stringBuf[LE_COMMAND_TEXT_SIZE];
+
+// keeps the compiler and the core from moving slot accesses across an index
+// update
+#define commandBarrier() __sync_synchronize()
+
+static leCommand* beginCommand(leCommandType type, leWidget* widget)
+{
+    leCommand* cmd;
+
+    if(widget == NULL)
+        return NULL;
+
+    if((_head + 1) % LE_COMMAND_QUEUE_SIZE == _tail)
+    {
+        _stats.full++;
+
+        return NULL;
+    }
+
+    cmd = &_ring[_head];
+
+    cmd->type = type;
+    cmd->widget = widget;
+
+    return cmd;
+}
+
+static leResult endCommand(void)
+{
+    commandBarrier();
+
+    _head = (_head + 1) % LE_COMMAND_QUEUE_SIZE;
+
+    _stats.queued++;
+
+    _leRenderer_Wake();
+
+    return LE_SUCCESS;
+}
+
+leResult leCommand_SetString(leWidget* widget,
+                             const leFont* font,
+                             const char* text)
+{
+    leCommand* cmd = beginCommand(LE_COMMAND_SET_STRING, widget);
+
+    if(cmd == NULL || text == NULL)
+        return LE_FAILURE;
+
+    cmd->data.string.font = font;
+
+    strncpy(cmd->data.string.text, text, LE_COMMAND_TEXT_SIZE - 1);
+    cmd->data.string.text[LE_COMMAND_TEXT_SIZE - 1] = '\0';
+
+    return endCommand();
+}
+
+leResult leCommand_SetVisible(leWidget* widget, leBool visible)
+{
+    leCommand* cmd = beginCommand(LE_COMMAND_SET_VISIBLE, widget);
+
+    if(cmd == NULL)
+        return LE_FAILURE;
+
+    cmd->data.visible = visible;
+
+    return endCommand();
+}
+
+leResult leCommand_SetPosition(leWidget* widget, int32_t x, int32_t y)
+{
+    leCommand* cmd = beginCommand(LE_COMMAND_SET_POSITION, widget);
+
+    if(cmd == NULL)
+        return LE_FAILURE;
+
+    cmd->data.position.x = x;
+    cmd->data.position.y = y;
+
+    return endCommand();
+}
+
+static void setString(leWidget* widget, leString* str)
+{
+    switch(widget->type)
+    {
+#if LE_LABEL_WIDGET_ENABLED == 1
+        case LE_WIDGET_LABEL:
+        {
+            ((leLabelWidget*)widget)->fn->setString((leLabelWidget*)widget, str);
+            break;
+        }
+#endif
+#if LE_TEXTFIELD_WIDGET_ENABLED == 1
+        case LE_WIDGET_TEXTFIELD:
+        {
+            ((leTextFieldWidget*)widget)->fn->setString((leTextFieldWidget*)widget, str);
+            break;
+        }
+#endif
+        default:
+        {
+            break;
+        }
+    }
+}
+
+static void applyCommand(const leCommand* cmd)
+{
+    switch(cmd->type)
+    {
+        case LE_COMMAND_SET_STRING:
+        {
+            // the widgets copy the string, one buffer serves all commands
+            leFixedString_Constructor(&_string, _stringBuf, LE_COMMAND_TEXT_SIZE);
+
+            _string.fn->setFont(&_string, cmd->data.string.font);
+            _string.fn->setFromCStr(&_string, cmd->data.string.text);
+
+            setString(cmd->widget, (leString*)&_string);
+
+            break;
+        }
+        case LE_COMMAND_SET_VISIBLE:
+        {
+            cmd->widget->fn->setVisible(cmd->widget, cmd->data.visible);
+
+            break;
+        }
+        case LE_COMMAND_SET_POSITION:
+        {
+            cmd->widget->fn->setPosition(cmd->widget,
+                                         cmd->data.position.x,
+                                         cmd->data.position.y);
+
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+void leCommand_SetClock(leCommandClock clock)
+{
+    _clock = clock;
+
+    if(clock != NULL)
+    {
+        _clockTime = clock();
+    }
+}
+
+// adds dt, or the time the clock moved on by, to the time since the last batch
+static void advanceTime(uint32_t dt)
+{
+    uint32_t now;
+
+    if(_clock != NULL)
+    {
+        now = _clock();
+        dt = now - _clockTime;
+        _clockTime = now;
+    }
+
+    _sinceApply = dt < UINT32_MAX - _sinceApply ? _sinceApply + dt : UINT32_MAX;
+}
+
+void leCommand_SetMaxFrameRate(uint32_t fps)
+{
+    _minPeriod = fps > 0 ? 1000 / fps : 0;
+}
+
+leBool leCommand_GetHoldTime(uint32_t* ms)
+{
+    if(_pendingCount == 0 && _tail == _head)
+        return LE_FALSE;
+
+    advanceTime(0);
+
+    *ms = _sinceApply < _minPeriod ? _minPeriod - _sinceApply : 0;
+
+    return LE_TRUE;
+}
+
+void leCommand_GetStats(leCommandStats* stats)
+{
+    *stats = _stats;
+}
+
+void leCommand_ResetStats(void)
+{
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+// moves the ring into the pending table, a command replaces the pending
+// change of the same widget property
+static void collectCommands(void)
+{
+    uint32_t head = _head;
+    uint32_t idx;
+    uint32_t i;
+
+    commandBarrier();
+
+    for(idx = _tail; idx != head; idx = (idx + 1) % LE_COMMAND_QUEUE_SIZE)
+    {
+        for(i = 0; i < _pendingCount; i++)
+        {
+            if(_pending[i].widget == _ring[idx].widget &&
+               _pending[i].type == _ring[idx].type)
+                break;
+        }
+
+        if(i < _pendingCount)
+        {
+            _stats.merged++;
+        }
+        else if(_pendingCount == LE_COMMAND_QUEUE_SIZE)
+        {
+            // the rest waits in the ring until the table is applied
+            break;
+        }
+        else
+        {
+            _pendingCount++;
+        }
+
+        _pending[i] = _ring[idx];
+    }
+
+    commandBarrier();
+
+    _tail = idx;
+}
+
+void leCommand_ProcessCommands(uint32_t dt)
+{
+    uint32_t i;
+
+    collectCommands();
+
+    advanceTime(dt);
+
+    if(_pendingCount == 0 ||
+       _sinceApply < _minPeriod ||
+       leIsDrawing() == LE_TRUE)
+        return;
+
+    for(i = 0; i < _pendingCount; i++)
+    {
+        applyCommand(&_pending[i]);
+    }
+
+    _stats.applied += _pendingCount;
+    _stats.batches++;
+
+    _pendingCount = 0;
+    _sinceApply = 0;
+
+    // anything left in the ring goes into the next batch
+    collectCommands();
+}
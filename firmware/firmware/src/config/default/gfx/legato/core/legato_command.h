@@ -0,0 +1,282 @@
+/*******************************************************************************
+* Copyright (C) 2020 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+ Module for Microchip Graphics Library - Legato User Interface Library
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    legato_command.h
+
+  Summary:
+    Queues widget property changes from another task for the task that runs
+    leUpdate.
+
+  Description:
+    The queue is a lock free ring with exactly one producer task and the
+    Legato task as its consumer.  The consumer moves commands out of the ring
+    into a pending table where a command replaces an earlier one that sets
+    the same property of the same widget.  Pending changes are applied while
+    no frame is in progress, so a widget never changes underneath the
+    renderer, and at most once per frame period so a burst of updates costs
+    one repaint per period rather than one per update.
+*******************************************************************************/
+
+/** \file legato_command.h
+ * @brief Widget property command queue.
+ *
+ * @details Queues widget property changes from one producer task for the
+ * task that runs leUpdate.
+ */
+
+#ifndef LEGATO_COMMAND_H
+#define LEGATO_COMMAND_H
+
+#include "gfx/legato/common/legato_common.h"
+#include "gfx/legato/font/legato_font.h"
+#include "gfx/legato/widget/legato_widget.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+/**
+ * @brief This enum represents the widget properties a command can set.
+ */
+typedef enum leCommandType
+{
+    LE_COMMAND_SET_STRING,   /**< string of a label or text field widget. */
+    LE_COMMAND_SET_VISIBLE,  /**< widget visibility. */
+    LE_COMMAND_SET_POSITION, /**< widget position. */
+} leCommandType;
+
+// *****************************************************************************
+/**
+ * @brief This struct represents a queued widget property change.
+ * @details The string is copied into the command so the producer may reuse
+ * its buffer as soon as the command is queued.
+ */
+typedef struct leCommand
+{
+    leCommandType type;  /**< the property to set. */
+    leWidget* widget;    /**< the target widget. */
+
+    union
+    {
+        struct
+        {
+            const leFont* font;                /**< the string font. */
+            char text[LE_COMMAND_TEXT_SIZE];   /**< the string, truncated. */
+        } string;
+
+        leBool visible;    /**< the visibility. */
+        lePoint position;  /**< the position. */
+    } data;
+} leCommand;
+
+// *****************************************************************************
+/**
+ * @brief This struct represents the command queue statistics.
+ */
+typedef struct leCommandStats
+{
+    uint32_t queued;   /**< commands queued by the producer. */
+    uint32_t full;     /**< commands refused because the ring was full. */
+    uint32_t merged;   /**< commands replaced by a later one before applying. */
+    uint32_t applied;  /**< commands applied to widgets. */
+    uint32_t batches;  /**< times pending changes were applied. */
+} leCommandStats;
+
+// *****************************************************************************
+/* Function:
+    leResult leCommand_SetString(leWidget* widget,
+                                 const leFont* font,
+                                 const char* text)
+
+  Summary:
+    Queues a string change for a label or text field widget.
+
+  Parameters:
+    leWidget* widget - the widget
+    const leFont* font - the font of the string
+    const char* text - the string, truncated to LE_COMMAND_TEXT_SIZE - 1
+                       characters
+
+  Returns:
+    leResult - LE_FAILURE if the queue is full
+*/
+leResult leCommand_SetString(leWidget* widget,
+                             const leFont* font,
+                             const char* text);
+
+// *****************************************************************************
+/* Function:
+    leResult leCommand_SetVisible(leWidget* widget, leBool visible)
+
+  Summary:
+    Queues a visibility change.
+
+  Parameters:
+    leWidget* widget - the widget
+    leBool visible - the visibility
+
+  Returns:
+    leResult - LE_FAILURE if the queue is full
+*/
+leResult leCommand_SetVisible(leWidget* widget, leBool visible);
+
+// *****************************************************************************
+/* Function:
+    leResult leCommand_SetPosition(leWidget* widget, int32_t x, int32_t y)
+
+  Summary:
+    Queues a position change.
+
+  Parameters:
+    leWidget* widget - the widget
+    int32_t x - the x position relative to the parent
+    int32_t y - the y position relative to the parent
+
+  Returns:
+    leResult - LE_FAILURE if the queue is full
+*/
+leResult leCommand_SetPosition(leWidget* widget, int32_t x, int32_t y);
+
+// *****************************************************************************
+/**
+ * @brief Millisecond clock the frame period is measured with.
+ */
+typedef uint32_t (*leCommandClock)(void);
+
+// *****************************************************************************
+/* Function:
+    void leCommand_SetClock(leCommandClock clock)
+
+  Summary:
+    Sets the clock the frame period is measured with.
+
+  Description:
+    Without a clock the period is measured with the dt passed to leUpdate,
+    which the generated Legato_Tasks leaves at zero.  The clock may wrap.
+
+  Parameters:
+    leCommandClock clock - the clock in milliseconds, NULL to use dt
+
+  Returns:
+    void
+*/
+void leCommand_SetClock(leCommandClock clock);
+
+// *****************************************************************************
+/* Function:
+    void leCommand_SetMaxFrameRate(uint32_t fps)
+
+  Summary:
+    Limits how often pending changes are applied.
+
+  Description:
+    Changes are held until 1000 / fps milliseconds have passed since the
+    previous ones were applied.  The first change after a quiet period is
+    applied right away.
+
+  Parameters:
+    uint32_t fps - the maximum rate, 0 for no limit
+
+  Returns:
+    void
+*/
+void leCommand_SetMaxFrameRate(uint32_t fps);
+
+// *****************************************************************************
+/* Function:
+    leBool leCommand_GetHoldTime(uint32_t* ms)
+
+  Summary:
+    Returns how long pending changes are still held back.
+
+  Description:
+    Lets the Legato task sleep until the changes are due.
+
+  Parameters:
+    uint32_t* ms - the time in milliseconds, 0 if the changes are due
+
+  Returns:
+    leBool - LE_FALSE if nothing is pending
+*/
+leBool leCommand_GetHoldTime(uint32_t* ms);
+
+// *****************************************************************************
+/* Function:
+    void leCommand_GetStats(leCommandStats* stats)
+
+  Summary:
+    Copies out the queue statistics collected since the last reset.
+
+  Parameters:
+    leCommandStats* stats - the destination
+
+  Returns:
+    void
+*/
+void leCommand_GetStats(leCommandStats* stats);
+
+// *****************************************************************************
+/* Function:
+    void leCommand_ResetStats(void)
+
+  Summary:
+    Clears the queue statistics.
+
+  Returns:
+    void
+*/
+void leCommand_ResetStats(void);
+
+// *****************************************************************************
+/* Function:
+    void leCommand_ProcessCommands(uint32_t dt)
+
+  Summary:
+    Collects the queued commands and applies them when they are due.
+
+  Description:
+    Called by leUpdate from the Legato task.  Target widgets must not be
+    deleted while commands for them are queued or pending.
+
+  Parameters:
+    uint32_t dt - milliseconds since the last call, ignored while a clock
+                  is set
+
+  Returns:
+    void
+*/
+void leCommand_ProcessCommands(uint32_t dt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LEGATO_COMMAND_H */
@@ -26,6 +26,7 @@
 
 #include "gfx/legato/core/legato_state.h"
 
+#include "gfx/legato/core/legato_command.h"
 #include "gfx/legato/core/legato_input.h"
 
 #include "gfx/legato/image/legato_image.h"
@@ -435,6 +436,9 @@ leResult leUpdate(uint32_t dt)
     }
 #endif
 
+    // widget changes queued by other tasks, applied between frames
+    leCommand_ProcessCommands(dt);
+
     updateWidgets(dt);
 
     leRenderer_Paint();
@@ -26,6 +26,7 @@
 
 #include "gfx/legato/datastructure/legato_rectarray.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 #include "gfx/legato/common/legato_error.h"
@@ -414,6 +415,179 @@ leResult leRectArray_RemoveOverlapping(leRectArray* arr)
     return LE_SUCCESS;
 }
 
+static int _compareTop(const void* l, const void* r)
+{
+    return ((const leRect*)l)->y - ((const leRect*)r)->y;
+}
+
+leResult leRectArray_Union(leRectArray* arr)
+{
+    leRect* src;
+    uint16_t* active;
+    leRect span;
+    uint32_t count, activeCount, next;
+    uint32_t i, j;
+    uint32_t bandStart, prevStart = 0, prevEnd = 0;
+    int32_t right, prevBottom = 0;
+    int32_t top, bottom;
+
+    if(arr == NULL)
+        return LE_FAILURE;
+
+    if(arr->size < 2)
+        return LE_SUCCESS;
+
+    if(arr->size > UINT16_MAX)
+        return LE_FAILURE;
+
+    // input copy sorted by top and the indices of the rects crossing the
+    // current band sorted by x
+    src = LE_MALLOC(arr->size * (sizeof(leRect) + sizeof(uint16_t)));
+
+    if(src == NULL)
+        return LE_FAILURE;
+
+    active = (uint16_t*)(src + arr->size);
+
+    for(i = 0, count = 0; i < arr->size; i++)
+    {
+        if(arr->rects[i].width <= 0 || arr->rects[i].height <= 0)
+            continue;
+
+        src[count++] = arr->rects[i];
+    }
+
+    qsort(src, count, sizeof(leRect), _compareTop);
+
+    leRectArray_Clear(arr);
+
+    activeCount = 0;
+    next = 0;
+    top = count > 0 ? src[0].y : 0;
+
+    // a band ends at the next top or bottom edge, every rect crossing it
+    // crosses all of it
+    while(next < count || activeCount > 0)
+    {
+        for(i = 0, j = 0; i < activeCount; i++)
+        {
+            if(src[active[i]].y + src[active[i]].height > top)
+            {
+                active[j++] = active[i];
+            }
+        }
+
+        activeCount = j;
+
+        // skip the gap to the next rect
+        if(activeCount == 0 && src[next].y > top)
+        {
+            top = src[next].y;
+        }
+
+        for(; next < count && src[next].y <= top; next++)
+        {
+            for(i = activeCount; i > 0 && src[active[i - 1]].x > src[next].x; i--)
+            {
+                active[i] = active[i - 1];
+            }
+
+            active[i] = (uint16_t)next;
+            activeCount++;
+        }
+
+        bottom = next < count ? src[next].y : INT32_MAX;
+
+        for(i = 0; i < activeCount; i++)
+        {
+            if(src[active[i]].y + src[active[i]].height < bottom)
+            {
+                bottom = src[active[i]].y + src[active[i]].height;
+            }
+        }
+
+        bandStart = arr->size;
+
+        // join overlapping and touching spans
+        span.x = src[active[0]].x;
+        span.y = (int16_t)top;
+        span.height = (int16_t)(bottom - top);
+        right = src[active[0]].x + src[active[0]].width;
+
+        for(i = 1; i <= activeCount; i++)
+        {
+            if(i < activeCount && src[active[i]].x <= right)
+            {
+                if(src[active[i]].x + src[active[i]].width > right)
+                {
+                    right = src[active[i]].x + src[active[i]].width;
+                }
+
+                continue;
+            }
+
+            span.width = right - span.x;
+
+            if(leRectArray_PushBack(arr, &span) == LE_FAILURE)
+            {
+                // out of memory, put the input back
+                leRectArray_Clear(arr);
+
+                for(i = 0; i < count; i++)
+                {
+                    leRectArray_PushBack(arr, &src[i]);
+                }
+
+                LE_FREE(src);
+
+                return LE_FAILURE;
+            }
+
+            if(i < activeCount)
+            {
+                span.x = src[active[i]].x;
+                right = src[active[i]].x + src[active[i]].width;
+            }
+        }
+
+        // a band directly below one with the same spans extends it
+        if(prevEnd > prevStart &&
+           prevBottom == top &&
+           arr->size - bandStart == prevEnd - prevStart)
+        {
+            for(i = 0; i < prevEnd - prevStart; i++)
+            {
+                if(arr->rects[prevStart + i].x != arr->rects[bandStart + i].x ||
+                   arr->rects[prevStart + i].width != arr->rects[bandStart + i].width)
+                    break;
+            }
+
+            if(i == prevEnd - prevStart)
+            {
+                for(i = prevStart; i < prevEnd; i++)
+                {
+                    arr->rects[i].height += (int16_t)(bottom - top);
+                }
+
+                arr->size = bandStart;
+                prevBottom = bottom;
+                top = bottom;
+
+                continue;
+            }
+        }
+
+        prevStart = bandStart;
+        prevEnd = arr->size;
+        prevBottom = bottom;
+        top = bottom;
+    }
+
+    LE_FREE(src);
+
+    return LE_SUCCESS;
+}
+
 #if LE_SCRATCH_BUFFER_PADDING == 1
 leResult leRectArray_PadRectangles(leRectArray* arr)
 {
@@ -598,5 +772,54 @@ leResult leRectArray_CropToSizeX(leRectArray* arr,
         }
     }
 
+    return LE_SUCCESS;
+}
+
+leResult leRectArray_CropToSizeBands(leRectArray* arr,
+                                     uint32_t size)
+{
+    uint32_t rectItr;
+    uint32_t rows;
+    leRect split;
+
+    /* minimal sane magic number size limit */
+    if(size < 4)
+        return LE_FAILURE;
+
+    for(rectItr = 0; rectItr < arr->size; rectItr++)
+    {
+        if((uint32_t)arr->rects[rectItr].width *
+           (uint32_t)arr->rects[rectItr].height <= size)
+            continue;
+
+        split = arr->rects[rectItr];
+
+        // a single row doesn't fit, cut off a column first
+        if((uint32_t)arr->rects[rectItr].width > size)
+        {
+            arr->rects[rectItr].width = size;
+
+            split.width -= size;
+            split.x += size;
+
+            leRectArray_PushBack(arr, &split);
+
+            split = arr->rects[rectItr];
+        }
+
+        rows = size / (uint32_t)arr->rects[rectItr].width;
+
+        if(rows < (uint32_t)arr->rects[rectItr].height)
+        {
+            arr->rects[rectItr].height = rows;
+
+            split.height -= rows;
+            split.y += rows;
+
+            // remainder is cropped again when the loop reaches it
+            leRectArray_PushBack(arr, &split);
+        }
+    }
+
     return LE_SUCCESS;
 }
\ No newline at end of file
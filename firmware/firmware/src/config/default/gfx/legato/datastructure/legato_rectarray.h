@@ -341,6 +341,27 @@ leResult leRectArray_MergeSimilar(leRectArray* arr);
  */
 leResult leRectArray_RemoveOverlapping(leRectArray* arr);
 
+// *****************************************************************************
+/**
+ * @brief Replace rectangles with the bands of their union
+ * @details Replaces the rectangles in <span class="param">arr</span> with
+ * non-overlapping rectangles covering the same area.  The area is cut into
+ * horizontal bands at every top and bottom edge, touching spans in a band
+ * are joined and bands with the same spans as the band above are merged
+ * into it.  The result is sorted by Y, then X.  Sorting the rectangles by
+ * top makes this O(n log n) plus the rectangles crossing each band, where
+ * the pairwise passes above are quadratic or worse.  Needs a working
+ * buffer of ten bytes per rectangle.
+ * @code
+ * leRectArray* arr;
+ * leResult res = leRectArray_Union(arr)
+ * @endcode
+ * @param arr the array to modify.
+ * @returns LE_FAILURE if memory ran out, the array then holds the input
+ * rectangles, otherwise LE_SUCCESS.
+ */
+leResult leRectArray_Union(leRectArray* arr);
+
 #if LE_SCRATCH_BUFFER_PADDING == 1
 /**
  * @brief Pad existing rectangles
@@ -446,6 +467,25 @@ leResult leRectArray_CropToSizeY(leRectArray* arr, uint32_t size);
  */
 leResult leRectArray_CropToSizeX(leRectArray* arr, uint32_t size);
 
+// *****************************************************************************
+/**
+ * @brief Slices an array of rectangles into row bands of a given pixel count
+ * @details Crops <span class="param">arr</span> so that no rectangle holds
+ * more than <span class="param">size</span> pixels.  Unlike the halving
+ * croppers each slice takes as many full rows as fit, which produces the
+ * fewest slices for a given size.  Rectangles wider than
+ * <span class="param">size</span> are first cut into columns.
+ * @code
+ * leRectArray* arr;
+ * uint32_t size;
+ * leResult res = leRectArray_CropToSizeBands(arr, size);
+ * @endcode
+ * @param arr the array to modify.
+ * @param size the number of pixels to crop to.
+ * @returns LE_SUCCESS , otherwise LE_FAILURE.
+ */
+leResult leRectArray_CropToSizeBands(leRectArray* arr, uint32_t size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -68,17 +68,7 @@ static void drawGlyphRow1bpp(const uint8_t* data,
     }
     else
     {
-        for(i = colStart; i < colEnd; i++)
-        {
-            offs = (i % 8);
-            
-            val = data[i >> 3] & (0x80 >> offs);
-            
-            if(val > 0)
-            {
-                leRenderer_PutPixel(x + i, y, clr);
-            }
-        }
+        leRenderer_PutMaskRow(x, y, data, colStart, colEnd, clr);
     }
 }
                             
@@ -132,22 +122,9 @@ static void drawGlyphRow1bppMono(const uint8_t* data,
                                  leColor clr,
                                  uint32_t a)
 {
-    int32_t i;
-    uint32_t offs;
-    uint8_t val;
     (void)a; // unused
 
-    for(i = colStart; i < colEnd; i++)
-    {
-        offs = (i % 8);
-
-        val = data[i >> 3] & (0x80 >> offs);
-
-        if(val > 0)
-        {
-            leRenderer_PutPixel(x + i, y, clr);
-        }
-    }
+    leRenderer_PutMaskRow(x, y, data, colStart, colEnd, clr);
 }
 
 static void drawGlyphRow8bppMono(const uint8_t* data,
@@ -170,20 +147,153 @@ static void drawGlyphRow8bppMono(const uint8_t* data,
     }
 }
 
+#if LE_FONT_GLYPH_INDEX_ENABLED == 1
+#if LE_FONT_GLYPH_RECENT_COUNT > 0
+// the most recently found glyphs of fonts that aren't range indexed, most
+// recent first.  Fonts are only used from the Legato task.
+static struct
+{
+    const leRasterFont* font;
+    uint32_t pos;
+} recentGlyphs[LE_FONT_GLYPH_RECENT_COUNT];
+
+// moves a glyph to the front of the recent list
+static void touchRecent(const leRasterFont* rasFont, uint32_t pos)
+{
+    uint32_t i;
+
+    for(i = 0; i < LE_FONT_GLYPH_RECENT_COUNT - 1; i++)
+    {
+        if(recentGlyphs[i].font == rasFont && recentGlyphs[i].pos == pos)
+            break;
+    }
+
+    for(; i > 0; i--)
+    {
+        recentGlyphs[i] = recentGlyphs[i - 1];
+    }
+
+    recentGlyphs[0].font = rasFont;
+    recentGlyphs[0].pos = pos;
+}
+#endif
+
+// returns the table position of a code point, -1 if the font doesn't have it
+static int32_t findGlyph(const leRasterFont* rasFont,
+                         const leFontGlyph* glyphTable,
+                         uint32_t glyphCount,
+                         uint32_t codepoint)
+{
+    const leFontGlyphIndex* index = &rasFont->index;
+    uint32_t lo, hi, mid;
+    int32_t pos = -1;
+#if LE_FONT_GLYPH_RECENT_COUNT > 0
+    uint32_t i;
+#endif
+
+    // a range index left over from another glyph table is ignored
+    if(index->mode == LE_FONT_GLYPH_INDEX_RANGE &&
+       glyphCount > 0 &&
+       glyphTable[0].codePoint == index->first &&
+       glyphTable[glyphCount - 1].codePoint == index->first + glyphCount - 1)
+    {
+        if(codepoint - index->first < glyphCount)
+            return (int32_t)(codepoint - index->first);
+
+        return -1;
+    }
+
+#if LE_FONT_GLYPH_RECENT_COUNT > 0
+    for(i = 0; i < LE_FONT_GLYPH_RECENT_COUNT && recentGlyphs[i].font != NULL; i++)
+    {
+        if(recentGlyphs[i].font == rasFont &&
+           glyphTable[recentGlyphs[i].pos].codePoint == codepoint)
+        {
+            pos = (int32_t)recentGlyphs[i].pos;
+
+            touchRecent(rasFont, (uint32_t)pos);
+
+            return pos;
+        }
+    }
+#endif
+
+    if(index->mode == LE_FONT_GLYPH_INDEX_SORTED)
+    {
+        lo = 0;
+        hi = glyphCount;
+
+        while(lo < hi)
+        {
+            mid = lo + ((hi - lo) >> 1);
+
+            if(glyphTable[mid].codePoint < codepoint)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+
+        if(lo < glyphCount && glyphTable[lo].codePoint == codepoint)
+        {
+            pos = (int32_t)lo;
+        }
+    }
+    else
+    {
+        for(lo = 0; lo < glyphCount; lo++)
+        {
+            if(glyphTable[lo].codePoint == codepoint)
+            {
+                pos = (int32_t)lo;
+
+                break;
+            }
+        }
+    }
+
+#if LE_FONT_GLYPH_RECENT_COUNT > 0
+    if(pos >= 0)
+    {
+        touchRecent(rasFont, (uint32_t)pos);
+    }
+#endif
+
+    return pos;
+}
+#endif
+
 leResult leFont_GetGlyphInfo(const leFont* fnt,
                              uint32_t codepoint,
                              leFontGlyph* glyph)
 {
-    uint32_t idx = 0;
     uint32_t glyphCount;
     leFontGlyph* glyphTable;
     leRasterFont* rasFont = (leRasterFont*)fnt;
+#if LE_FONT_GLYPH_INDEX_ENABLED == 1
+    int32_t pos;
+#else
+    uint32_t idx = 0;
+#endif
     
     LE_ASSERT(glyph != NULL && fnt != NULL && rasFont->glyphTable != NULL);
         
     glyphCount = ((uint32_t*)rasFont->glyphTable)[0];
     glyphTable = (leFontGlyph*)(rasFont->glyphTable + sizeof(uint32_t));
     
+#if LE_FONT_GLYPH_INDEX_ENABLED == 1
+    pos = findGlyph(rasFont, glyphTable, glyphCount, codepoint);
+
+    if(pos >= 0)
+    {
+        memcpy(glyph, &glyphTable[pos], sizeof(leFontGlyph));
+
+        return LE_SUCCESS;
+    }
+#else
     // attempt to find the glyph in the range lookup tables
     for(idx = 0; idx < glyphCount; idx++)
     {
@@ -197,6 +307,7 @@ leResult leFont_GetGlyphInfo(const leFont* fnt,
             return LE_SUCCESS;
         }
     }
+#endif
     
     if(codepoint == 0x20)
     {
@@ -297,6 +408,83 @@ static void _drawUnknownGlyph(int32_t x,
                         a);     
 }
 
+leResult leFont_InitGlyphDecoder(leFontGlyphDecoder* dec,
+                                 const leFontGlyph* glyph,
+                                 const uint8_t* data)
+{
+    dec->data = data;
+    dec->rowWidth = glyph->dataRowWidth;
+
+#if LE_FONT_RLE_ENABLED == 1
+    dec->encoded = (glyph->flags & LE_FONT_GLYPH_RLE) > 0;
+    dec->runCount = 0;
+    dec->literalCount = 0;
+    dec->runValue = 0;
+
+    if(dec->encoded == LE_TRUE && dec->rowWidth > LE_FONT_RLE_ROW_SIZE)
+        return LE_FAILURE;
+#else
+    if((glyph->flags & LE_FONT_GLYPH_RLE) > 0)
+        return LE_FAILURE;
+#endif
+
+    return LE_SUCCESS;
+}
+
+const uint8_t* leFont_DecodeGlyphRow(leFontGlyphDecoder* dec)
+{
+    const uint8_t* row = dec->data;
+#if LE_FONT_RLE_ENABLED == 1
+    uint8_t* out;
+    uint8_t* end;
+    uint8_t ctrl;
+
+    if(dec->encoded == LE_TRUE)
+    {
+        out = dec->row;
+        end = dec->row + dec->rowWidth;
+
+        // packets are a few bytes long, byte loops beat memset and memcpy
+        while(out < end)
+        {
+            if(dec->runCount > 0)
+            {
+                *out++ = dec->runValue;
+                dec->runCount--;
+            }
+            else if(dec->literalCount > 0)
+            {
+                *out++ = *dec->data++;
+                dec->literalCount--;
+            }
+            else
+            {
+                ctrl = *dec->data++;
+
+                if(ctrl == 0)
+                {
+                    dec->runCount = (uint32_t)dec->data[0] + 1;
+                    dec->runValue = dec->data[1];
+                    dec->data += 2;
+                }
+                else
+                {
+                    dec->runCount = ctrl >> 4;
+                    dec->runValue = 0;
+                    dec->literalCount = ctrl & 0xF;
+                }
+            }
+        }
+
+        return dec->row;
+    }
+#endif
+
+    dec->data += dec->rowWidth;
+
+    return row;
+}
+
 leResult leFont_DrawGlyphData(const leFont* fnt,
                               const leFontGlyph* glyph,
                               const uint8_t* data,
@@ -305,7 +493,9 @@ leResult leFont_DrawGlyphData(const leFont* fnt,
                               leColor clr,
                               uint32_t a)
 {
-    int32_t row;
+    int32_t row, rowStart;
+    leFontGlyphDecoder dec;
+    const uint8_t* rowData;
     leRect glyphRect;
     leRect clippedGlyph;
     int32_t colStart, colEnd;
@@ -323,6 +513,9 @@ leResult leFont_DrawGlyphData(const leFont* fnt,
     if(leRenderer_CullDrawRect(&glyphRect) == LE_TRUE)
         return LE_SUCCESS;
 
+    if(leFont_InitGlyphDecoder(&dec, glyph, data) == LE_FAILURE)
+        return LE_FAILURE;
+
     if(leRenderer_CurrentColorMode() == LE_COLOR_MODE_MONOCHROME)
     {
         if(rasFnt->bpp == LE_FONT_BPP_1)
@@ -366,9 +559,16 @@ leResult leFont_DrawGlyphData(const leFont* fnt,
         colEnd = glyph->width + ((clippedGlyph.x + clippedGlyph.width) - (x + (int32_t)glyph->width));
     }
     
-    for(row = clippedGlyph.y - glyphRect.y; row < (clippedGlyph.y - glyphRect.y) + (clippedGlyph.height); row++)
+    rowStart = clippedGlyph.y - glyphRect.y;
+
+    for(row = 0; row < rowStart + clippedGlyph.height; row++)
     {
-        drawFn(data + (row * glyph->dataRowWidth),
+        rowData = leFont_DecodeGlyphRow(&dec);
+
+        if(row < rowStart)
+            continue;
+
+        drawFn(rowData,
                x,
                y + row,
                colStart,
@@ -391,6 +591,7 @@ leResult leFont_DrawGlyphData_Lookup(const leFont* fnt,
     leRect glyphRect;
     leRect clippedGlyph;
     int32_t colStart, colEnd;
+    leFontGlyphDecoder dec;
     uint32_t* colorData32;
     uint16_t* colorData16;
     uint8_t* colorData8;
@@ -407,6 +608,15 @@ leResult leFont_DrawGlyphData_Lookup(const leFont* fnt,
     if(leRenderer_CullDrawRect(&glyphRect) == LE_TRUE)
         return LE_SUCCESS;
 
+    if(leFont_InitGlyphDecoder(&dec, glyph, data) == LE_FAILURE)
+        return LE_FAILURE;
+
+    // the table takes a byte per pixel, an encoded 1bpp row is decoded into
+    // fewer bytes than the glyph is wide
+    if(((const leRasterFont*)fnt)->bpp == LE_FONT_BPP_1 &&
+       (glyph->flags & LE_FONT_GLYPH_RLE) > 0)
+        return LE_FAILURE;
+
     leRenderer_ClipDrawRect(&glyphRect, &clippedGlyph);
 
     if(x >= clippedGlyph.x)
@@ -427,13 +637,19 @@ leResult leFont_DrawGlyphData_Lookup(const leFont* fnt,
         colEnd = glyph->width + ((clippedGlyph.x + clippedGlyph.width) - (x + (int32_t)glyph->width));
     }
 
+    // rows above the clipped area
+    for(row = 0; row < clippedGlyph.y - glyphRect.y; row++)
+    {
+        leFont_DecodeGlyphRow(&dec);
+    }
+
     if(leColorInfoTable[tbl->mode].bpp == 32)
     {
         colorData32 = (uint32_t*)tbl->data;
 
         for(row = clippedGlyph.y - glyphRect.y; row < (clippedGlyph.y - glyphRect.y) + (clippedGlyph.height); row++)
         {
-            dataPtr = data + (row * glyph->dataRowWidth);
+            dataPtr = leFont_DecodeGlyphRow(&dec);
 
             for(col = colStart; col < colEnd; col++)
             {
@@ -447,7 +663,7 @@ leResult leFont_DrawGlyphData_Lookup(const leFont* fnt,
 
         for(row = clippedGlyph.y - glyphRect.y; row < (clippedGlyph.y - glyphRect.y) + (clippedGlyph.height); row++)
         {
-            dataPtr = data + (row * glyph->dataRowWidth);
+            dataPtr = leFont_DecodeGlyphRow(&dec);
 
             for(col = colStart; col < colEnd; col++)
             {
@@ -461,7 +677,7 @@ leResult leFont_DrawGlyphData_Lookup(const leFont* fnt,
 
         for(row = clippedGlyph.y - glyphRect.y; row < (clippedGlyph.y - glyphRect.y) + (clippedGlyph.height); row++)
         {
-            dataPtr = data + (row * glyph->dataRowWidth);
+            dataPtr = leFont_DecodeGlyphRow(&dec);
 
             for(col = colStart; col < colEnd; col++)
             {
@@ -80,7 +80,7 @@ typedef enum leFontBPP
                       render this glyph
     int16_t bearingX - the X offset from the advance
     int16_t bearingY - the Y offset from the string baseline
-    uint16_t flags - general purpose flags
+    uint16_t flags - general purpose flags, see leFontGlyphFlags
     uint16_t dataRowWidth - the width of one row of glyph data in bytes
     uint32_t dataOffset - the offset of this glyph in the font glyph table
 */
@@ -138,6 +138,22 @@ typedef enum leFontFlags
                                // to left
 } leFontFlags;
 
+// *****************************************************************************
+/* Enumeration:
+    enum leFontGlyphFlags
+
+  Summary:
+    Defines glyph attribute flags.
+*/
+/**
+ * @brief Defines glyph attribute flags.
+ */
+typedef enum leFontGlyphFlags
+{
+    LE_FONT_GLYPH_RLE = 0x1, // indicates that the glyph data is run length
+                             // encoded, see leFontGlyphDecoder
+} leFontGlyphFlags;
+
 // *****************************************************************************
 /* Structure:
     struct leFont
@@ -176,7 +192,32 @@ typedef struct leFont
     uint16_t baseline - the general font baseline in pixels;
     leFontBPP bpp - the bits per pixel value of this font.
     const uint8_t* glyphTable - pointer to the font's glyph data table
+    leFontGlyphIndex index - glyph lookup index
 */
+// *****************************************************************************
+/**
+ * @brief This enum represents how the glyphs of a raster font are looked up.
+ */
+typedef enum leFontGlyphIndexMode
+{
+    LE_FONT_GLYPH_INDEX_NONE,   /**< not indexed, linear search */
+    LE_FONT_GLYPH_INDEX_RANGE,  /**< one contiguous ascending range, direct index */
+    LE_FONT_GLYPH_INDEX_SORTED  /**< ascending with gaps, binary search */
+} leFontGlyphIndexMode;
+
+// *****************************************************************************
+/**
+ * @brief This struct represents the glyph lookup index of a raster font.
+ * @details Part of the font asset, written into le_gen_fonts.c by
+ * tools/le_font_rle.py from the order of the glyph table.  A font without
+ * an index is searched linearly.
+ */
+typedef struct leFontGlyphIndex
+{
+    leFontGlyphIndexMode mode;
+    uint32_t first;  /**< the code point of the first glyph */
+} leFontGlyphIndex;
+
 /**
  * @brief This struct represents a rasterized font object.
  * @details A raster font asset is a series of raster images that represent
@@ -192,8 +233,33 @@ typedef struct leRasterFont
     uint16_t baseline;
     leFontBPP bpp;
     const uint8_t* glyphTable;
+    leFontGlyphIndex index;
 } leRasterFont;
 
+// *****************************************************************************
+/**
+ * @brief This struct represents a glyph data row reader.
+ * @details Raw glyph rows are returned in place.  Run length encoded glyph
+ * data is a series of packets that may span rows.  A control byte other than
+ * zero stands for (control >> 4) zero bytes followed by (control & 0xF)
+ * literal bytes, which are stored after it.  A zero control byte is followed
+ * by a count and a value and stands for count + 1 copies of the value.
+ * Encoded rows are decoded one at a time into row, so no glyph sized buffer
+ * is needed.
+ */
+typedef struct leFontGlyphDecoder
+{
+    const uint8_t* data;    /**< the next data byte. */
+    uint32_t rowWidth;      /**< bytes per row. */
+#if LE_FONT_RLE_ENABLED == 1
+    leBool encoded;         /**< the data is run length encoded. */
+    uint32_t runCount;      /**< copies of runValue left in the current packet. */
+    uint32_t literalCount;  /**< literal bytes left in the current packet. */
+    uint8_t runValue;       /**< the repeated byte. */
+    uint8_t row[LE_FONT_RLE_ROW_SIZE]; /**< the last decoded row. */
+#endif
+} leFontGlyphDecoder;
+
 #if LE_STREAMING_ENABLED == 1
 // *****************************************************************************
 /**
@@ -337,6 +403,51 @@ leResult leFont_GetGlyphInfo(const leFont* fnt,
 leResult leFont_GetGlyphRect(const leFontGlyph* glyph,
                              leRect* rect);
 
+// *****************************************************************************
+/* Function:
+    leResult leFont_InitGlyphDecoder(leFontGlyphDecoder* dec,
+                                     const leFontGlyph* glyph,
+                                     const uint8_t* data)
+
+   Summary:
+    Prepares to read the rows of a glyph from the top
+
+   Parameters:
+    leFontGlyphDecoder* dec - the decoder
+    const leFontGlyph* glyph - the glyph kerning information
+    const uint8_t* data - the glyph data
+
+  Returns:
+    leResult - LE_FAILURE if the glyph is encoded and either run length
+               encoding is disabled or a row exceeds LE_FONT_RLE_ROW_SIZE
+
+  Remarks:
+*/
+leResult leFont_InitGlyphDecoder(leFontGlyphDecoder* dec,
+                                 const leFontGlyph* glyph,
+                                 const uint8_t* data);
+
+// *****************************************************************************
+/* Function:
+    const uint8_t* leFont_DecodeGlyphRow(leFontGlyphDecoder* dec)
+
+   Summary:
+    Returns the next row of glyph data
+
+   Description:
+    The row stays valid until the next call.  Rows above a clipped area must
+    still be read to reach the rows below them.
+
+   Parameters:
+    leFontGlyphDecoder* dec - the decoder
+
+  Returns:
+    const uint8_t* - the row data
+
+  Remarks:
+*/
+const uint8_t* leFont_DecodeGlyphRow(leFontGlyphDecoder* dec);
+
 // *****************************************************************************
 /* Function:
     leResult leFont_DrawGlyph(const leFont* fnt,
@@ -29,183 +29,178 @@ const uint8_t NotoSans_Bold_data[1904] =
 {
     0x5F,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x03,0x00,0x08,0x00,0x03,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x05,0x00,
-    0x03,0x00,0x05,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x08,0x00,0x00,0x00,
+    0x00,0x00,0x08,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x05,0x00,
+    0x03,0x00,0x05,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x05,0x00,0x00,0x00,
     0x23,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x0C,0x00,0x00,0x00,0x24,0x00,0x06,0x00,0x09,0x00,0x06,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x14,0x00,0x00,0x00,0x25,0x00,0x0A,0x00,0x08,0x00,0x0A,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x02,0x00,0x20,0x00,0x00,0x00,0x26,0x00,0x09,0x00,
-    0x08,0x00,0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x02,0x00,0x30,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x24,0x00,0x06,0x00,0x09,0x00,0x06,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x10,0x00,0x00,0x00,0x25,0x00,0x0A,0x00,0x08,0x00,0x0A,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x02,0x00,0x19,0x00,0x00,0x00,0x26,0x00,0x09,0x00,
+    0x08,0x00,0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x02,0x00,0x29,0x00,0x00,0x00,
     0x27,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x40,0x00,0x00,0x00,0x28,0x00,0x04,0x00,0x09,0x00,0x04,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x44,0x00,0x00,0x00,0x29,0x00,0x04,0x00,0x09,0x00,0x04,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x50,0x00,0x00,0x00,0x2A,0x00,0x06,0x00,
-    0x06,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x5C,0x00,0x00,0x00,
+    0x39,0x00,0x00,0x00,0x28,0x00,0x04,0x00,0x09,0x00,0x04,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x3C,0x00,0x00,0x00,0x29,0x00,0x04,0x00,0x09,0x00,0x04,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x45,0x00,0x00,0x00,0x2A,0x00,0x06,0x00,
+    0x06,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x4E,0x00,0x00,0x00,
     0x2B,0x00,0x06,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,
-    0x64,0x00,0x00,0x00,0x2C,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x02,0x00,
-    0x00,0x00,0x01,0x00,0x6C,0x00,0x00,0x00,0x2D,0x00,0x04,0x00,0x03,0x00,0x04,0x00,
-    0x00,0x00,0x05,0x00,0x00,0x00,0x01,0x00,0x70,0x00,0x00,0x00,0x2E,0x00,0x03,0x00,
-    0x02,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x74,0x00,0x00,0x00,
+    0x54,0x00,0x00,0x00,0x2C,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x00,0x00,0x02,0x00,
+    0x00,0x00,0x01,0x00,0x59,0x00,0x00,0x00,0x2D,0x00,0x04,0x00,0x03,0x00,0x04,0x00,
+    0x00,0x00,0x05,0x00,0x00,0x00,0x01,0x00,0x5C,0x00,0x00,0x00,0x2E,0x00,0x03,0x00,
+    0x02,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x5F,0x00,0x00,0x00,
     0x2F,0x00,0x05,0x00,0x08,0x00,0x05,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x78,0x00,0x00,0x00,0x30,0x00,0x06,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x80,0x00,0x00,0x00,0x31,0x00,0x05,0x00,0x08,0x00,0x06,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x88,0x00,0x00,0x00,0x32,0x00,0x06,0x00,
-    0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x90,0x00,0x00,0x00,
+    0x61,0x00,0x00,0x00,0x30,0x00,0x06,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x69,0x00,0x00,0x00,0x31,0x00,0x05,0x00,0x08,0x00,0x06,0x00,
+    0x00,0x00,0x08,0x00,0x01,0x00,0x01,0x00,0x71,0x00,0x00,0x00,0x32,0x00,0x06,0x00,
+    0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x78,0x00,0x00,0x00,
     0x33,0x00,0x06,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x98,0x00,0x00,0x00,0x34,0x00,0x07,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0xA0,0x00,0x00,0x00,0x35,0x00,0x06,0x00,0x08,0x00,0x06,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xA8,0x00,0x00,0x00,0x36,0x00,0x06,0x00,
-    0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xB0,0x00,0x00,0x00,
+    0x80,0x00,0x00,0x00,0x34,0x00,0x07,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x88,0x00,0x00,0x00,0x35,0x00,0x06,0x00,0x08,0x00,0x06,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x90,0x00,0x00,0x00,0x36,0x00,0x06,0x00,
+    0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x98,0x00,0x00,0x00,
     0x37,0x00,0x06,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0xB8,0x00,0x00,0x00,0x38,0x00,0x06,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0xC0,0x00,0x00,0x00,0x39,0x00,0x06,0x00,0x08,0x00,0x06,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xC8,0x00,0x00,0x00,0x3A,0x00,0x03,0x00,
-    0x06,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xD0,0x00,0x00,0x00,
-    0x3B,0x00,0x03,0x00,0x07,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,
-    0xD8,0x00,0x00,0x00,0x3C,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x07,0x00,
-    0x00,0x00,0x01,0x00,0xE0,0x00,0x00,0x00,0x3D,0x00,0x06,0x00,0x05,0x00,0x06,0x00,
-    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xE8,0x00,0x00,0x00,0x3E,0x00,0x06,0x00,
-    0x06,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x01,0x00,0xF0,0x00,0x00,0x00,
+    0xA0,0x00,0x00,0x00,0x38,0x00,0x06,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0xA8,0x00,0x00,0x00,0x39,0x00,0x06,0x00,0x08,0x00,0x06,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xB0,0x00,0x00,0x00,0x3A,0x00,0x03,0x00,
+    0x06,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x01,0x00,0x01,0x00,0xB8,0x00,0x00,0x00,
+    0x3B,0x00,0x03,0x00,0x07,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x01,0x00,0x01,0x00,
+    0xBC,0x00,0x00,0x00,0x3C,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x07,0x00,
+    0x00,0x00,0x01,0x00,0xC2,0x00,0x00,0x00,0x3D,0x00,0x06,0x00,0x05,0x00,0x06,0x00,
+    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xC8,0x00,0x00,0x00,0x3E,0x00,0x06,0x00,
+    0x06,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x01,0x00,0xCD,0x00,0x00,0x00,
     0x3F,0x00,0x05,0x00,0x08,0x00,0x05,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0xF8,0x00,0x00,0x00,0x40,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x02,0x00,0x00,0x01,0x00,0x00,0x41,0x00,0x08,0x00,0x08,0x00,0x08,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x14,0x01,0x00,0x00,0x42,0x00,0x07,0x00,
-    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x1C,0x01,0x00,0x00,
+    0xD3,0x00,0x00,0x00,0x40,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x00,0x00,0x08,0x00,
+    0x01,0x00,0x02,0x00,0xDB,0x00,0x00,0x00,0x41,0x00,0x08,0x00,0x08,0x00,0x08,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xEE,0x00,0x00,0x00,0x42,0x00,0x07,0x00,
+    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xF6,0x00,0x00,0x00,
     0x43,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x24,0x01,0x00,0x00,0x44,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x2C,0x01,0x00,0x00,0x45,0x00,0x06,0x00,0x08,0x00,0x06,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x34,0x01,0x00,0x00,0x46,0x00,0x06,0x00,
-    0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x3C,0x01,0x00,0x00,
+    0xFE,0x00,0x00,0x00,0x44,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x06,0x01,0x00,0x00,0x45,0x00,0x06,0x00,0x08,0x00,0x06,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x0E,0x01,0x00,0x00,0x46,0x00,0x06,0x00,
+    0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x16,0x01,0x00,0x00,
     0x47,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x44,0x01,0x00,0x00,0x48,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x4C,0x01,0x00,0x00,0x49,0x00,0x04,0x00,0x08,0x00,0x04,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x54,0x01,0x00,0x00,0x4A,0x00,0x04,0x00,
-    0x0B,0x00,0x04,0x00,0xFF,0xFF,0x08,0x00,0x00,0x00,0x01,0x00,0x5C,0x01,0x00,0x00,
+    0x1E,0x01,0x00,0x00,0x48,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x26,0x01,0x00,0x00,0x49,0x00,0x04,0x00,0x08,0x00,0x04,0x00,
+    0x00,0x00,0x08,0x00,0x01,0x00,0x01,0x00,0x2E,0x01,0x00,0x00,0x4A,0x00,0x04,0x00,
+    0x0B,0x00,0x04,0x00,0xFF,0xFF,0x08,0x00,0x01,0x00,0x01,0x00,0x35,0x01,0x00,0x00,
     0x4B,0x00,0x08,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x68,0x01,0x00,0x00,0x4C,0x00,0x06,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x70,0x01,0x00,0x00,0x4D,0x00,0x0A,0x00,0x08,0x00,0x0A,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x02,0x00,0x78,0x01,0x00,0x00,0x4E,0x00,0x08,0x00,
-    0x08,0x00,0x09,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x88,0x01,0x00,0x00,
+    0x3B,0x01,0x00,0x00,0x4C,0x00,0x06,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,
+    0x01,0x00,0x01,0x00,0x43,0x01,0x00,0x00,0x4D,0x00,0x0A,0x00,0x08,0x00,0x0A,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x02,0x00,0x48,0x01,0x00,0x00,0x4E,0x00,0x08,0x00,
+    0x08,0x00,0x09,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x58,0x01,0x00,0x00,
     0x4F,0x00,0x09,0x00,0x08,0x00,0x09,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x02,0x00,
-    0x90,0x01,0x00,0x00,0x50,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0xA0,0x01,0x00,0x00,0x51,0x00,0x09,0x00,0x0A,0x00,0x09,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x02,0x00,0xA8,0x01,0x00,0x00,0x52,0x00,0x08,0x00,
-    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xBC,0x01,0x00,0x00,
+    0x60,0x01,0x00,0x00,0x50,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x70,0x01,0x00,0x00,0x51,0x00,0x09,0x00,0x0A,0x00,0x09,0x00,
+    0x00,0x00,0x08,0x00,0x01,0x00,0x02,0x00,0x78,0x01,0x00,0x00,0x52,0x00,0x08,0x00,
+    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x8B,0x01,0x00,0x00,
     0x53,0x00,0x06,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0xC4,0x01,0x00,0x00,0x54,0x00,0x07,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0xCC,0x01,0x00,0x00,0x55,0x00,0x08,0x00,0x08,0x00,0x08,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xD4,0x01,0x00,0x00,0x56,0x00,0x08,0x00,
-    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xDC,0x01,0x00,0x00,
+    0x93,0x01,0x00,0x00,0x54,0x00,0x07,0x00,0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,
+    0x01,0x00,0x01,0x00,0x9B,0x01,0x00,0x00,0x55,0x00,0x08,0x00,0x08,0x00,0x08,0x00,
+    0x00,0x00,0x08,0x00,0x01,0x00,0x01,0x00,0xA0,0x01,0x00,0x00,0x56,0x00,0x08,0x00,
+    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xA6,0x01,0x00,0x00,
     0x57,0x00,0x0B,0x00,0x08,0x00,0x0B,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x02,0x00,
-    0xE4,0x01,0x00,0x00,0x58,0x00,0x08,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0xF4,0x01,0x00,0x00,0x59,0x00,0x07,0x00,0x08,0x00,0x07,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xFC,0x01,0x00,0x00,0x5A,0x00,0x07,0x00,
-    0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x04,0x02,0x00,0x00,
-    0x5B,0x00,0x04,0x00,0x0A,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x0C,0x02,0x00,0x00,0x5C,0x00,0x05,0x00,0x08,0x00,0x05,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x18,0x02,0x00,0x00,0x5D,0x00,0x03,0x00,0x0A,0x00,0x04,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x20,0x02,0x00,0x00,0x5E,0x00,0x07,0x00,
-    0x05,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x2C,0x02,0x00,0x00,
+    0xAE,0x01,0x00,0x00,0x58,0x00,0x08,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0xBE,0x01,0x00,0x00,0x59,0x00,0x07,0x00,0x08,0x00,0x07,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xC6,0x01,0x00,0x00,0x5A,0x00,0x07,0x00,
+    0x08,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xCE,0x01,0x00,0x00,
+    0x5B,0x00,0x04,0x00,0x0A,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0x01,0x00,0x01,0x00,
+    0xD6,0x01,0x00,0x00,0x5C,0x00,0x05,0x00,0x08,0x00,0x05,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0xDE,0x01,0x00,0x00,0x5D,0x00,0x03,0x00,0x0A,0x00,0x04,0x00,
+    0x00,0x00,0x08,0x00,0x01,0x00,0x01,0x00,0xE6,0x01,0x00,0x00,0x5E,0x00,0x07,0x00,
+    0x05,0x00,0x06,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xEE,0x01,0x00,0x00,
     0x5F,0x00,0x06,0x00,0x03,0x00,0x05,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x01,0x00,
-    0x34,0x02,0x00,0x00,0x60,0x00,0x04,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x09,0x00,
-    0x00,0x00,0x01,0x00,0x38,0x02,0x00,0x00,0x61,0x00,0x06,0x00,0x06,0x00,0x07,0x00,
-    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x3C,0x02,0x00,0x00,0x62,0x00,0x07,0x00,
-    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x44,0x02,0x00,0x00,
+    0xF3,0x01,0x00,0x00,0x60,0x00,0x04,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x09,0x00,
+    0x00,0x00,0x01,0x00,0xF6,0x01,0x00,0x00,0x61,0x00,0x06,0x00,0x06,0x00,0x07,0x00,
+    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xF8,0x01,0x00,0x00,0x62,0x00,0x07,0x00,
+    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xFE,0x01,0x00,0x00,
     0x63,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,
-    0x4C,0x02,0x00,0x00,0x64,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x54,0x02,0x00,0x00,0x65,0x00,0x07,0x00,0x06,0x00,0x07,0x00,
-    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x5C,0x02,0x00,0x00,0x66,0x00,0x05,0x00,
-    0x08,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x64,0x02,0x00,0x00,
+    0x06,0x02,0x00,0x00,0x64,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x0C,0x02,0x00,0x00,0x65,0x00,0x07,0x00,0x06,0x00,0x07,0x00,
+    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x14,0x02,0x00,0x00,0x66,0x00,0x05,0x00,
+    0x08,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0x01,0x00,0x01,0x00,0x1A,0x02,0x00,0x00,
     0x67,0x00,0x07,0x00,0x09,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,
-    0x6C,0x02,0x00,0x00,0x68,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x78,0x02,0x00,0x00,0x69,0x00,0x03,0x00,0x08,0x00,0x03,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x80,0x02,0x00,0x00,0x6A,0x00,0x04,0x00,
-    0x0B,0x00,0x03,0x00,0xFF,0xFF,0x08,0x00,0x00,0x00,0x01,0x00,0x88,0x02,0x00,0x00,
+    0x21,0x02,0x00,0x00,0x68,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x2A,0x02,0x00,0x00,0x69,0x00,0x03,0x00,0x08,0x00,0x03,0x00,
+    0x00,0x00,0x08,0x00,0x01,0x00,0x01,0x00,0x32,0x02,0x00,0x00,0x6A,0x00,0x04,0x00,
+    0x0B,0x00,0x03,0x00,0xFF,0xFF,0x08,0x00,0x01,0x00,0x01,0x00,0x38,0x02,0x00,0x00,
     0x6B,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x94,0x02,0x00,0x00,0x6C,0x00,0x03,0x00,0x08,0x00,0x03,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x9C,0x02,0x00,0x00,0x6D,0x00,0x0A,0x00,0x06,0x00,0x0B,0x00,
-    0x00,0x00,0x06,0x00,0x00,0x00,0x02,0x00,0xA4,0x02,0x00,0x00,0x6E,0x00,0x07,0x00,
-    0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xB0,0x02,0x00,0x00,
+    0x41,0x02,0x00,0x00,0x6C,0x00,0x03,0x00,0x08,0x00,0x03,0x00,0x00,0x00,0x08,0x00,
+    0x01,0x00,0x01,0x00,0x49,0x02,0x00,0x00,0x6D,0x00,0x0A,0x00,0x06,0x00,0x0B,0x00,
+    0x00,0x00,0x06,0x00,0x00,0x00,0x02,0x00,0x4C,0x02,0x00,0x00,0x6E,0x00,0x07,0x00,
+    0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x58,0x02,0x00,0x00,
     0x6F,0x00,0x07,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,
-    0xB8,0x02,0x00,0x00,0x70,0x00,0x07,0x00,0x09,0x00,0x07,0x00,0x00,0x00,0x06,0x00,
-    0x00,0x00,0x01,0x00,0xC0,0x02,0x00,0x00,0x71,0x00,0x07,0x00,0x09,0x00,0x07,0x00,
-    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xCC,0x02,0x00,0x00,0x72,0x00,0x05,0x00,
-    0x06,0x00,0x05,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xD8,0x02,0x00,0x00,
+    0x5E,0x02,0x00,0x00,0x70,0x00,0x07,0x00,0x09,0x00,0x07,0x00,0x00,0x00,0x06,0x00,
+    0x00,0x00,0x01,0x00,0x64,0x02,0x00,0x00,0x71,0x00,0x07,0x00,0x09,0x00,0x07,0x00,
+    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x6D,0x02,0x00,0x00,0x72,0x00,0x05,0x00,
+    0x06,0x00,0x05,0x00,0x00,0x00,0x06,0x00,0x01,0x00,0x01,0x00,0x76,0x02,0x00,0x00,
     0x73,0x00,0x06,0x00,0x06,0x00,0x05,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,
-    0xE0,0x02,0x00,0x00,0x74,0x00,0x05,0x00,0x08,0x00,0x05,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0xE8,0x02,0x00,0x00,0x75,0x00,0x07,0x00,0x06,0x00,0x07,0x00,
-    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xF0,0x02,0x00,0x00,0x76,0x00,0x07,0x00,
-    0x06,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xF8,0x02,0x00,0x00,
+    0x7B,0x02,0x00,0x00,0x74,0x00,0x05,0x00,0x08,0x00,0x05,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x81,0x02,0x00,0x00,0x75,0x00,0x07,0x00,0x06,0x00,0x07,0x00,
+    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x89,0x02,0x00,0x00,0x76,0x00,0x07,0x00,
+    0x06,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x8F,0x02,0x00,0x00,
     0x77,0x00,0x0A,0x00,0x06,0x00,0x09,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x02,0x00,
-    0x00,0x03,0x00,0x00,0x78,0x00,0x07,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x06,0x00,
-    0x00,0x00,0x01,0x00,0x0C,0x03,0x00,0x00,0x79,0x00,0x07,0x00,0x09,0x00,0x06,0x00,
-    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x14,0x03,0x00,0x00,0x7A,0x00,0x06,0x00,
-    0x06,0x00,0x05,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x20,0x03,0x00,0x00,
+    0x95,0x02,0x00,0x00,0x78,0x00,0x07,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x06,0x00,
+    0x00,0x00,0x01,0x00,0xA1,0x02,0x00,0x00,0x79,0x00,0x07,0x00,0x09,0x00,0x06,0x00,
+    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xA7,0x02,0x00,0x00,0x7A,0x00,0x06,0x00,
+    0x06,0x00,0x05,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xB0,0x02,0x00,0x00,
     0x7B,0x00,0x04,0x00,0x0A,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x28,0x03,0x00,0x00,0x7C,0x00,0x02,0x00,0x0B,0x00,0x06,0x00,0x02,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x34,0x03,0x00,0x00,0x7D,0x00,0x05,0x00,0x0A,0x00,0x04,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x40,0x03,0x00,0x00,0x7E,0x00,0x06,0x00,
-    0x04,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x4C,0x03,0x00,0x00,
+    0xB6,0x02,0x00,0x00,0x7C,0x00,0x02,0x00,0x0B,0x00,0x06,0x00,0x02,0x00,0x08,0x00,
+    0x01,0x00,0x01,0x00,0xC0,0x02,0x00,0x00,0x7D,0x00,0x05,0x00,0x0A,0x00,0x04,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xC3,0x02,0x00,0x00,0x7E,0x00,0x06,0x00,
+    0x04,0x00,0x06,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xCD,0x02,0x00,0x00,
 };
 
 /*********************************
- * raw font glyph data
+ * run length encoded font glyph data
+ * written by tools/le_font_rle.py, regenerating the fonts in MHC
+ * writes raw glyphs again, so run it afterwards
  ********************************/
-const uint8_t NotoSans_Bold_glyphs[848] =
+const uint8_t NotoSans_Bold_glyphs[721] =
 {
-    0x40,0x40,0x40,0x40,0x40,0x00,0x00,0x40,0x50,0x50,0x50,0x00,0x34,0x24,0x7E,0x28,
-    0x28,0xFE,0x78,0x58,0x10,0x78,0x70,0x70,0x78,0x1C,0x1C,0x78,0x10,0x00,0x00,0x00,
-    0x62,0x00,0xF2,0x00,0xD4,0x00,0xD5,0x80,0x7A,0x80,0x1A,0xC0,0x13,0x80,0x31,0x80,
-    0x38,0x00,0x6C,0x00,0x68,0x00,0x38,0x00,0x73,0x00,0x4E,0x00,0x6E,0x00,0x7F,0x00,
-    0x40,0x40,0x40,0x00,0x20,0x60,0x40,0x40,0xC0,0x40,0x40,0x60,0x20,0x00,0x00,0x00,
-    0x40,0x60,0x20,0x20,0x20,0x20,0x20,0x60,0x40,0x00,0x00,0x00,0x30,0x30,0x78,0x30,
-    0x48,0x00,0x00,0x00,0x10,0x10,0xFC,0x30,0x10,0x00,0x00,0x00,0x40,0x40,0xC0,0x00,
-    0x00,0xE0,0x00,0x00,0x00,0x40,0x00,0x00,0x10,0x30,0x30,0x20,0x60,0x40,0x40,0xC0,
-    0x38,0x78,0x4C,0xCC,0xCC,0x4C,0x68,0x38,0x18,0x78,0x58,0x18,0x18,0x18,0x18,0x18,
-    0x78,0x4C,0x0C,0x08,0x18,0x30,0x60,0xFC,0x78,0x4C,0x08,0x38,0x0C,0x0C,0x1C,0x78,
-    0x18,0x18,0x38,0x68,0x48,0xFC,0x18,0x08,0x78,0x60,0x40,0x78,0x0C,0x0C,0x18,0x78,
-    0x38,0x60,0x40,0xF8,0xEC,0xCC,0x6C,0x38,0xFC,0x0C,0x08,0x18,0x10,0x30,0x30,0x60,
-    0x78,0x6C,0x4C,0x78,0x78,0xCC,0x4C,0x78,0x78,0x78,0xCC,0xCC,0x7C,0x0C,0x18,0x70,
-    0x40,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x00,0x40,0x40,0xC0,0x00,
-    0x04,0x18,0x60,0x60,0x18,0x04,0x00,0x00,0x00,0xFC,0x00,0xFC,0x00,0x00,0x00,0x00,
-    0x00,0x60,0x18,0x1C,0x70,0x00,0x00,0x00,0x70,0xD8,0x18,0x30,0x20,0x20,0x00,0x60,
-    0x1E,0x00,0x33,0x00,0x6E,0x80,0x5A,0x80,0x52,0x80,0x56,0x80,0x5F,0x80,0x60,0x00,
-    0x3E,0x00,0x00,0x00,0x18,0x38,0x2C,0x2C,0x64,0x7E,0x46,0xC2,0x7C,0x6E,0x64,0x7C,
-    0x66,0x66,0x6E,0x7C,0x3C,0x74,0x60,0x40,0x40,0x60,0x70,0x3C,0x7C,0x6E,0x66,0x62,
-    0x62,0x66,0x6E,0x7C,0x7C,0x60,0x60,0x78,0x60,0x60,0x60,0x7C,0x78,0x60,0x60,0x60,
-    0x78,0x60,0x60,0x60,0x1E,0x72,0x60,0x40,0x4E,0x66,0x76,0x3E,0x62,0x62,0x62,0x7E,
-    0x62,0x62,0x62,0x62,0xF0,0x60,0x60,0x60,0x60,0x60,0x60,0xF0,0x30,0x30,0x30,0x30,
-    0x30,0x30,0x30,0x30,0x30,0xE0,0x00,0x00,0x66,0x6C,0x78,0x78,0x78,0x6C,0x6C,0x66,
-    0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x7C,0x61,0x80,0x71,0x80,0x73,0x80,0x72,0x80,
+    0x00,0x04,0x40,0x21,0x40,0x50,0x50,0x50,0x34,0x24,0x7E,0x28,0x28,0xFE,0x78,0x58,
+    0x10,0x78,0x70,0x70,0x78,0x1C,0x1C,0x78,0x10,0x62,0x00,0xF2,0x00,0xD4,0x00,0xD5,
+    0x80,0x7A,0x80,0x1A,0xC0,0x13,0x80,0x31,0x80,0x38,0x00,0x6C,0x00,0x68,0x00,0x38,
+    0x00,0x73,0x00,0x4E,0x00,0x6E,0x00,0x7F,0x00,0x40,0x40,0x40,0x20,0x60,0x40,0x40,
+    0xC0,0x40,0x40,0x60,0x20,0x40,0x60,0x20,0x20,0x20,0x20,0x20,0x60,0x40,0x30,0x30,
+    0x78,0x30,0x48,0x00,0x10,0x10,0xFC,0x30,0x10,0x40,0x40,0xC0,0x00,0xE0,0x00,0x00,
+    0x40,0x10,0x30,0x30,0x20,0x60,0x40,0x40,0xC0,0x38,0x78,0x4C,0xCC,0xCC,0x4C,0x68,
+    0x38,0x03,0x18,0x78,0x58,0x00,0x04,0x18,0x78,0x4C,0x0C,0x08,0x18,0x30,0x60,0xFC,
+    0x78,0x4C,0x08,0x38,0x0C,0x0C,0x1C,0x78,0x18,0x18,0x38,0x68,0x48,0xFC,0x18,0x08,
+    0x78,0x60,0x40,0x78,0x0C,0x0C,0x18,0x78,0x38,0x60,0x40,0xF8,0xEC,0xCC,0x6C,0x38,
+    0xFC,0x0C,0x08,0x18,0x10,0x30,0x30,0x60,0x78,0x6C,0x4C,0x78,0x78,0xCC,0x4C,0x78,
+    0x78,0x78,0xCC,0xCC,0x7C,0x0C,0x18,0x70,0x01,0x40,0x41,0x40,0x01,0x40,0x33,0x40,
+    0x40,0xC0,0x04,0x18,0x60,0x60,0x18,0x04,0x00,0xFC,0x00,0xFC,0x00,0x00,0x60,0x18,
+    0x1C,0x70,0x00,0x70,0xD8,0x18,0x30,0x20,0x20,0x00,0x60,0x0F,0x1E,0x00,0x33,0x00,
+    0x6E,0x80,0x5A,0x80,0x52,0x80,0x56,0x80,0x5F,0x80,0x60,0x11,0x3E,0x30,0x18,0x38,
+    0x2C,0x2C,0x64,0x7E,0x46,0xC2,0x7C,0x6E,0x64,0x7C,0x66,0x66,0x6E,0x7C,0x3C,0x74,
+    0x60,0x40,0x40,0x60,0x70,0x3C,0x7C,0x6E,0x66,0x62,0x62,0x66,0x6E,0x7C,0x7C,0x60,
+    0x60,0x78,0x60,0x60,0x60,0x7C,0x78,0x60,0x60,0x60,0x78,0x60,0x60,0x60,0x1E,0x72,
+    0x60,0x40,0x4E,0x66,0x76,0x3E,0x62,0x62,0x62,0x7E,0x62,0x62,0x62,0x62,0x01,0xF0,
+    0x00,0x05,0x60,0x01,0xF0,0x00,0x08,0x30,0x01,0xE0,0x10,0x66,0x6C,0x78,0x78,0x78,
+    0x6C,0x6C,0x66,0x00,0x06,0x60,0x01,0x7C,0x61,0x80,0x71,0x80,0x73,0x80,0x72,0x80,
     0x5A,0x80,0x4E,0x80,0x4C,0x80,0x4C,0x80,0x63,0x73,0x7B,0x5B,0x4F,0x4F,0x47,0x43,
     0x3C,0x00,0x76,0x00,0x63,0x00,0x43,0x00,0x43,0x00,0x63,0x00,0x76,0x00,0x3C,0x00,
-    0x78,0x6C,0x64,0x6C,0x7C,0x60,0x60,0x60,0x3C,0x00,0x76,0x00,0x63,0x00,0x43,0x00,
-    0x43,0x00,0x63,0x00,0x76,0x00,0x3E,0x00,0x06,0x00,0x00,0x00,0x78,0x6C,0x64,0x6C,
-    0x78,0x68,0x6C,0x66,0x38,0x68,0x40,0x70,0x38,0x0C,0x48,0x78,0xFC,0x30,0x30,0x30,
-    0x30,0x30,0x30,0x30,0x62,0x62,0x62,0x62,0x62,0x62,0x76,0x3C,0xC6,0xC6,0x44,0x6C,
-    0x6C,0x38,0x38,0x38,0xCC,0x60,0xCC,0x40,0x4E,0xC0,0x4A,0xC0,0x7A,0xC0,0x7B,0x80,
-    0x33,0x80,0x31,0x80,0xC6,0x6C,0x3C,0x38,0x38,0x2C,0x64,0xC6,0xC6,0x6C,0x6C,0x38,
-    0x30,0x10,0x10,0x10,0xFC,0x0C,0x18,0x10,0x30,0x60,0x60,0xFC,0x60,0x40,0x40,0x40,
-    0x40,0x40,0x40,0x40,0x60,0x00,0x00,0x00,0xC0,0x40,0x40,0x60,0x20,0x30,0x30,0x10,
-    0xE0,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0xE0,0x00,0x00,0x00,0x30,0x30,0x78,0x48,
-    0xCC,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x40,0x20,0x00,0x00,0x78,0x0C,0x7C,0x6C,
-    0x6C,0x7C,0x00,0x00,0x60,0x60,0x78,0x6C,0x64,0x64,0x6C,0x58,0x38,0x60,0x40,0x40,
-    0x68,0x38,0x00,0x00,0x0C,0x0C,0x7C,0x6C,0x44,0x44,0x6C,0x7C,0x38,0x6C,0x7C,0x40,
-    0x60,0x38,0x00,0x00,0x38,0x60,0xF0,0x60,0x60,0x60,0x60,0x60,0x7C,0x6C,0x44,0x44,
-    0x6C,0x7C,0x0C,0x4C,0x78,0x00,0x00,0x00,0x60,0x40,0x7C,0x6C,0x64,0x64,0x64,0x64,
-    0x40,0x00,0x60,0x60,0x60,0x60,0x60,0x60,0x20,0x00,0x30,0x30,0x30,0x30,0x30,0x30,
-    0x30,0x60,0xE0,0x00,0x60,0x60,0x6C,0x58,0x78,0x78,0x6C,0x64,0x60,0x60,0x60,0x60,
-    0x60,0x60,0x60,0x60,0x5D,0x80,0x6E,0xC0,0x64,0xC0,0x64,0xC0,0x64,0xC0,0x64,0xC0,
-    0x5C,0x6C,0x64,0x64,0x64,0x64,0x00,0x00,0x38,0x6C,0x44,0x44,0x6C,0x38,0x00,0x00,
-    0x78,0x6C,0x64,0x64,0x6C,0x78,0x60,0x60,0x60,0x00,0x00,0x00,0x7C,0x6C,0x44,0x44,
-    0x6C,0x7C,0x0C,0x0C,0x0C,0x00,0x00,0x00,0x58,0x60,0x60,0x60,0x60,0x60,0x00,0x00,
-    0x78,0x40,0x60,0x18,0x18,0x70,0x00,0x00,0x00,0x60,0xF0,0x60,0x60,0x60,0x60,0x30,
-    0x44,0x44,0x44,0x44,0x6C,0x3C,0x00,0x00,0xCC,0x4C,0x68,0x78,0x38,0x30,0x00,0x00,
-    0xCC,0x80,0x5D,0x80,0x55,0x80,0x77,0x00,0x77,0x00,0x33,0x00,0xCC,0x78,0x38,0x38,
-    0x78,0xCC,0x00,0x00,0xCC,0x4C,0x68,0x78,0x38,0x30,0x30,0x20,0xE0,0x00,0x00,0x00,
-    0xF8,0x18,0x30,0x60,0x60,0xF8,0x00,0x00,0x30,0x20,0x20,0x60,0xC0,0x60,0x20,0x20,
-    0x30,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,
-    0xC0,0x60,0x60,0x60,0x30,0x60,0x60,0x60,0xE0,0x00,0x00,0x00,0x00,0x60,0x1C,0x00,
+    0x78,0x6C,0x64,0x6C,0x7C,0x60,0x60,0x60,0x0F,0x3C,0x00,0x76,0x00,0x63,0x00,0x43,
+    0x00,0x43,0x00,0x63,0x00,0x76,0x00,0x3E,0x11,0x06,0x30,0x78,0x6C,0x64,0x6C,0x78,
+    0x68,0x6C,0x66,0x38,0x68,0x40,0x70,0x38,0x0C,0x48,0x78,0x01,0xFC,0x00,0x06,0x30,
+    0x00,0x05,0x62,0x02,0x76,0x3C,0xC6,0xC6,0x44,0x6C,0x6C,0x38,0x38,0x38,0xCC,0x60,
+    0xCC,0x40,0x4E,0xC0,0x4A,0xC0,0x7A,0xC0,0x7B,0x80,0x33,0x80,0x31,0x80,0xC6,0x6C,
+    0x3C,0x38,0x38,0x2C,0x64,0xC6,0xC6,0x6C,0x6C,0x38,0x30,0x10,0x10,0x10,0xFC,0x0C,
+    0x18,0x10,0x30,0x60,0x60,0xFC,0x01,0x60,0x00,0x06,0x40,0x01,0x60,0x10,0xC0,0x40,
+    0x40,0x60,0x20,0x30,0x30,0x10,0x01,0xE0,0x00,0x06,0x60,0x01,0xE0,0x10,0x30,0x30,
+    0x78,0x48,0xCC,0x00,0x7C,0x00,0x40,0x20,0x78,0x0C,0x7C,0x6C,0x6C,0x7C,0x60,0x60,
+    0x78,0x6C,0x64,0x64,0x6C,0x58,0x38,0x60,0x40,0x40,0x68,0x38,0x0C,0x0C,0x7C,0x6C,
+    0x44,0x44,0x6C,0x7C,0x38,0x6C,0x7C,0x40,0x60,0x38,0x03,0x38,0x60,0xF0,0x00,0x04,
+    0x60,0x7C,0x6C,0x44,0x44,0x6C,0x7C,0x0C,0x4C,0x78,0x60,0x40,0x7C,0x6C,0x64,0x64,
+    0x64,0x64,0x02,0x40,0x00,0x00,0x05,0x60,0x02,0x20,0x00,0x00,0x06,0x30,0x02,0x60,
+    0xE0,0x60,0x60,0x6C,0x58,0x78,0x78,0x6C,0x64,0x00,0x07,0x60,0x5D,0x80,0x6E,0xC0,
+    0x64,0xC0,0x64,0xC0,0x64,0xC0,0x64,0xC0,0x5C,0x6C,0x64,0x64,0x64,0x64,0x38,0x6C,
+    0x44,0x44,0x6C,0x38,0x78,0x6C,0x64,0x64,0x6C,0x78,0x60,0x60,0x60,0x7C,0x6C,0x44,
+    0x44,0x6C,0x7C,0x0C,0x0C,0x0C,0x01,0x58,0x00,0x04,0x60,0x78,0x40,0x60,0x18,0x18,
+    0x70,0x00,0x60,0xF0,0x60,0x60,0x60,0x60,0x30,0x44,0x44,0x44,0x44,0x6C,0x3C,0xCC,
+    0x4C,0x68,0x78,0x38,0x30,0xCC,0x80,0x5D,0x80,0x55,0x80,0x77,0x00,0x77,0x00,0x33,
+    0x00,0xCC,0x78,0x38,0x38,0x78,0xCC,0xCC,0x4C,0x68,0x78,0x38,0x30,0x30,0x20,0xE0,
+    0xF8,0x18,0x30,0x60,0x60,0xF8,0x30,0x20,0x20,0x60,0xC0,0x60,0x20,0x20,0x30,0x00,
+    0x00,0x0A,0xC0,0xC0,0x60,0x60,0x60,0x30,0x60,0x60,0x60,0xE0,0x00,0x00,0x60,0x1C,
+    0x00,
 };
 
 leRasterFont NotoSans_Bold =
@@ -214,7 +209,7 @@ leRasterFont NotoSans_Bold =
         {
             LE_STREAM_LOCATION_ID_INTERNAL, // data location id
             (void*)NotoSans_Bold_glyphs, // glyph table variable pointer
-            848, // data size
+            721, // data size
         },
         LE_RASTER_FONT,
         0,
@@ -223,6 +218,10 @@ leRasterFont NotoSans_Bold =
     9,
     LE_FONT_BPP_1, // bits per pixel
     NotoSans_Bold_data, // kerning table
+    {
+        LE_FONT_GLYPH_INDEX_RANGE, // glyph lookup index
+        0x20, // first code point
+    },
 };
 
 /*********************************
@@ -254,179 +253,173 @@ const uint8_t NotoMono_Regular_data[1904] =
 {
     0x5F,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x02,0x00,0x08,0x00,0x07,0x00,
-    0x02,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x05,0x00,
-    0x03,0x00,0x07,0x00,0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x08,0x00,0x00,0x00,
+    0x02,0x00,0x08,0x00,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x22,0x00,0x05,0x00,
+    0x03,0x00,0x07,0x00,0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x05,0x00,0x00,0x00,
     0x23,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x0C,0x00,0x00,0x00,0x24,0x00,0x06,0x00,0x0A,0x00,0x07,0x00,0x00,0x00,0x09,0x00,
-    0x00,0x00,0x01,0x00,0x14,0x00,0x00,0x00,0x25,0x00,0x07,0x00,0x08,0x00,0x07,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x20,0x00,0x00,0x00,0x26,0x00,0x07,0x00,
-    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x28,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,0x24,0x00,0x06,0x00,0x0A,0x00,0x07,0x00,0x00,0x00,0x09,0x00,
+    0x00,0x00,0x01,0x00,0x10,0x00,0x00,0x00,0x25,0x00,0x07,0x00,0x08,0x00,0x07,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x1A,0x00,0x00,0x00,0x26,0x00,0x07,0x00,
+    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x22,0x00,0x00,0x00,
     0x27,0x00,0x02,0x00,0x03,0x00,0x07,0x00,0x02,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x30,0x00,0x00,0x00,0x28,0x00,0x04,0x00,0x0A,0x00,0x07,0x00,0x01,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x34,0x00,0x00,0x00,0x29,0x00,0x05,0x00,0x0A,0x00,0x07,0x00,
-    0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x40,0x00,0x00,0x00,0x2A,0x00,0x06,0x00,
-    0x05,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x4C,0x00,0x00,0x00,
+    0x2A,0x00,0x00,0x00,0x28,0x00,0x04,0x00,0x0A,0x00,0x07,0x00,0x01,0x00,0x08,0x00,
+    0x01,0x00,0x01,0x00,0x2D,0x00,0x00,0x00,0x29,0x00,0x05,0x00,0x0A,0x00,0x07,0x00,
+    0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x36,0x00,0x00,0x00,0x2A,0x00,0x06,0x00,
+    0x05,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x40,0x00,0x00,0x00,
     0x2B,0x00,0x06,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x01,0x00,
-    0x54,0x00,0x00,0x00,0x2C,0x00,0x03,0x00,0x03,0x00,0x07,0x00,0x02,0x00,0x02,0x00,
-    0x00,0x00,0x01,0x00,0x5C,0x00,0x00,0x00,0x2D,0x00,0x05,0x00,0x01,0x00,0x07,0x00,
-    0x01,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x60,0x00,0x00,0x00,0x2E,0x00,0x03,0x00,
-    0x02,0x00,0x07,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x64,0x00,0x00,0x00,
+    0x45,0x00,0x00,0x00,0x2C,0x00,0x03,0x00,0x03,0x00,0x07,0x00,0x02,0x00,0x02,0x00,
+    0x00,0x00,0x01,0x00,0x4B,0x00,0x00,0x00,0x2D,0x00,0x05,0x00,0x01,0x00,0x07,0x00,
+    0x01,0x00,0x03,0x00,0x00,0x00,0x01,0x00,0x4E,0x00,0x00,0x00,0x2E,0x00,0x03,0x00,
+    0x02,0x00,0x07,0x00,0x02,0x00,0x02,0x00,0x00,0x00,0x01,0x00,0x4F,0x00,0x00,0x00,
     0x2F,0x00,0x05,0x00,0x08,0x00,0x07,0x00,0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x68,0x00,0x00,0x00,0x30,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x70,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x08,0x00,0x07,0x00,
-    0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x78,0x00,0x00,0x00,0x32,0x00,0x06,0x00,
-    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x80,0x00,0x00,0x00,
+    0x51,0x00,0x00,0x00,0x30,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x59,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x08,0x00,0x07,0x00,
+    0x01,0x00,0x08,0x00,0x01,0x00,0x01,0x00,0x61,0x00,0x00,0x00,0x32,0x00,0x06,0x00,
+    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x64,0x00,0x00,0x00,
     0x33,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x88,0x00,0x00,0x00,0x34,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x90,0x00,0x00,0x00,0x35,0x00,0x06,0x00,0x08,0x00,0x07,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x98,0x00,0x00,0x00,0x36,0x00,0x06,0x00,
-    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xA0,0x00,0x00,0x00,
+    0x6C,0x00,0x00,0x00,0x34,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x74,0x00,0x00,0x00,0x35,0x00,0x06,0x00,0x08,0x00,0x07,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x7C,0x00,0x00,0x00,0x36,0x00,0x06,0x00,
+    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x84,0x00,0x00,0x00,
     0x37,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0xA8,0x00,0x00,0x00,0x38,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0xB0,0x00,0x00,0x00,0x39,0x00,0x06,0x00,0x08,0x00,0x07,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xB8,0x00,0x00,0x00,0x3A,0x00,0x02,0x00,
-    0x06,0x00,0x07,0x00,0x02,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xC0,0x00,0x00,0x00,
+    0x8C,0x00,0x00,0x00,0x38,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x94,0x00,0x00,0x00,0x39,0x00,0x06,0x00,0x08,0x00,0x07,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x9C,0x00,0x00,0x00,0x3A,0x00,0x02,0x00,
+    0x06,0x00,0x07,0x00,0x02,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xA4,0x00,0x00,0x00,
     0x3B,0x00,0x03,0x00,0x07,0x00,0x07,0x00,0x02,0x00,0x06,0x00,0x00,0x00,0x01,0x00,
-    0xC8,0x00,0x00,0x00,0x3C,0x00,0x06,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x06,0x00,
-    0x00,0x00,0x01,0x00,0xD0,0x00,0x00,0x00,0x3D,0x00,0x06,0x00,0x03,0x00,0x07,0x00,
-    0x00,0x00,0x05,0x00,0x00,0x00,0x01,0x00,0xD8,0x00,0x00,0x00,0x3E,0x00,0x06,0x00,
-    0x05,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xDC,0x00,0x00,0x00,
-    0x3F,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0xE4,0x00,0x00,0x00,0x40,0x00,0x07,0x00,0x09,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0xEC,0x00,0x00,0x00,0x41,0x00,0x07,0x00,0x08,0x00,0x07,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xF8,0x00,0x00,0x00,0x42,0x00,0x07,0x00,
-    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,
+    0xAA,0x00,0x00,0x00,0x3C,0x00,0x06,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x06,0x00,
+    0x00,0x00,0x01,0x00,0xB1,0x00,0x00,0x00,0x3D,0x00,0x06,0x00,0x03,0x00,0x07,0x00,
+    0x00,0x00,0x05,0x00,0x00,0x00,0x01,0x00,0xB6,0x00,0x00,0x00,0x3E,0x00,0x06,0x00,
+    0x05,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xB9,0x00,0x00,0x00,
+    0x3F,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x01,0x00,0x01,0x00,
+    0xBE,0x00,0x00,0x00,0x40,0x00,0x07,0x00,0x09,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0xC5,0x00,0x00,0x00,0x41,0x00,0x07,0x00,0x08,0x00,0x07,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xCE,0x00,0x00,0x00,0x42,0x00,0x07,0x00,
+    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xD6,0x00,0x00,0x00,
     0x43,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x08,0x01,0x00,0x00,0x44,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x10,0x01,0x00,0x00,0x45,0x00,0x05,0x00,0x08,0x00,0x07,0x00,
-    0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x18,0x01,0x00,0x00,0x46,0x00,0x05,0x00,
-    0x08,0x00,0x07,0x00,0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x20,0x01,0x00,0x00,
+    0xDE,0x00,0x00,0x00,0x44,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0xE6,0x00,0x00,0x00,0x45,0x00,0x05,0x00,0x08,0x00,0x07,0x00,
+    0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xEE,0x00,0x00,0x00,0x46,0x00,0x05,0x00,
+    0x08,0x00,0x07,0x00,0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xF6,0x00,0x00,0x00,
     0x47,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x28,0x01,0x00,0x00,0x48,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x30,0x01,0x00,0x00,0x49,0x00,0x05,0x00,0x08,0x00,0x07,0x00,
-    0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x38,0x01,0x00,0x00,0x4A,0x00,0x06,0x00,
-    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x40,0x01,0x00,0x00,
+    0xFE,0x00,0x00,0x00,0x48,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x06,0x01,0x00,0x00,0x49,0x00,0x05,0x00,0x08,0x00,0x07,0x00,
+    0x01,0x00,0x08,0x00,0x01,0x00,0x01,0x00,0x0E,0x01,0x00,0x00,0x4A,0x00,0x06,0x00,
+    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x01,0x00,0x01,0x00,0x15,0x01,0x00,0x00,
     0x4B,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x48,0x01,0x00,0x00,0x4C,0x00,0x05,0x00,0x08,0x00,0x07,0x00,0x01,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x50,0x01,0x00,0x00,0x4D,0x00,0x06,0x00,0x08,0x00,0x07,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x58,0x01,0x00,0x00,0x4E,0x00,0x06,0x00,
-    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x60,0x01,0x00,0x00,
+    0x1A,0x01,0x00,0x00,0x4C,0x00,0x05,0x00,0x08,0x00,0x07,0x00,0x01,0x00,0x08,0x00,
+    0x01,0x00,0x01,0x00,0x22,0x01,0x00,0x00,0x4D,0x00,0x06,0x00,0x08,0x00,0x07,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x27,0x01,0x00,0x00,0x4E,0x00,0x06,0x00,
+    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x2F,0x01,0x00,0x00,
     0x4F,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x68,0x01,0x00,0x00,0x50,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x70,0x01,0x00,0x00,0x51,0x00,0x07,0x00,0x0A,0x00,0x07,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x78,0x01,0x00,0x00,0x52,0x00,0x06,0x00,
-    0x08,0x00,0x07,0x00,0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x84,0x01,0x00,0x00,
+    0x37,0x01,0x00,0x00,0x50,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x3F,0x01,0x00,0x00,0x51,0x00,0x07,0x00,0x0A,0x00,0x07,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x47,0x01,0x00,0x00,0x52,0x00,0x06,0x00,
+    0x08,0x00,0x07,0x00,0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x51,0x01,0x00,0x00,
     0x53,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x8C,0x01,0x00,0x00,0x54,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x94,0x01,0x00,0x00,0x55,0x00,0x06,0x00,0x08,0x00,0x07,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x9C,0x01,0x00,0x00,0x56,0x00,0x07,0x00,
-    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xA4,0x01,0x00,0x00,
+    0x59,0x01,0x00,0x00,0x54,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x01,0x00,0x01,0x00,0x61,0x01,0x00,0x00,0x55,0x00,0x06,0x00,0x08,0x00,0x07,0x00,
+    0x00,0x00,0x08,0x00,0x01,0x00,0x01,0x00,0x66,0x01,0x00,0x00,0x56,0x00,0x07,0x00,
+    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x6C,0x01,0x00,0x00,
     0x57,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0xAC,0x01,0x00,0x00,0x58,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0xB4,0x01,0x00,0x00,0x59,0x00,0x07,0x00,0x08,0x00,0x07,0x00,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xBC,0x01,0x00,0x00,0x5A,0x00,0x07,0x00,
-    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xC4,0x01,0x00,0x00,
-    0x5B,0x00,0x04,0x00,0x0A,0x00,0x07,0x00,0x02,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0xCC,0x01,0x00,0x00,0x5C,0x00,0x05,0x00,0x08,0x00,0x07,0x00,0x01,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0xD8,0x01,0x00,0x00,0x5D,0x00,0x04,0x00,0x0A,0x00,0x07,0x00,
-    0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xE0,0x01,0x00,0x00,0x5E,0x00,0x06,0x00,
-    0x05,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xEC,0x01,0x00,0x00,
+    0x74,0x01,0x00,0x00,0x58,0x00,0x07,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x7C,0x01,0x00,0x00,0x59,0x00,0x07,0x00,0x08,0x00,0x07,0x00,
+    0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x84,0x01,0x00,0x00,0x5A,0x00,0x07,0x00,
+    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x8C,0x01,0x00,0x00,
+    0x5B,0x00,0x04,0x00,0x0A,0x00,0x07,0x00,0x02,0x00,0x08,0x00,0x01,0x00,0x01,0x00,
+    0x94,0x01,0x00,0x00,0x5C,0x00,0x05,0x00,0x08,0x00,0x07,0x00,0x01,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x9B,0x01,0x00,0x00,0x5D,0x00,0x04,0x00,0x0A,0x00,0x07,0x00,
+    0x01,0x00,0x08,0x00,0x01,0x00,0x01,0x00,0xA3,0x01,0x00,0x00,0x5E,0x00,0x06,0x00,
+    0x05,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xAA,0x01,0x00,0x00,
     0x5F,0x00,0x08,0x00,0x01,0x00,0x07,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x01,0x00,
-    0xF4,0x01,0x00,0x00,0x60,0x00,0x03,0x00,0x02,0x00,0x07,0x00,0x02,0x00,0x09,0x00,
-    0x00,0x00,0x01,0x00,0xF8,0x01,0x00,0x00,0x61,0x00,0x06,0x00,0x06,0x00,0x07,0x00,
-    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xFC,0x01,0x00,0x00,0x62,0x00,0x06,0x00,
-    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x04,0x02,0x00,0x00,
+    0xAF,0x01,0x00,0x00,0x60,0x00,0x03,0x00,0x02,0x00,0x07,0x00,0x02,0x00,0x09,0x00,
+    0x00,0x00,0x01,0x00,0xB0,0x01,0x00,0x00,0x61,0x00,0x06,0x00,0x06,0x00,0x07,0x00,
+    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xB2,0x01,0x00,0x00,0x62,0x00,0x06,0x00,
+    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xB8,0x01,0x00,0x00,
     0x63,0x00,0x06,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,
-    0x0C,0x02,0x00,0x00,0x64,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x14,0x02,0x00,0x00,0x65,0x00,0x06,0x00,0x06,0x00,0x07,0x00,
-    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x1C,0x02,0x00,0x00,0x66,0x00,0x06,0x00,
-    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x24,0x02,0x00,0x00,
+    0xC0,0x01,0x00,0x00,0x64,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0xC6,0x01,0x00,0x00,0x65,0x00,0x06,0x00,0x06,0x00,0x07,0x00,
+    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xCE,0x01,0x00,0x00,0x66,0x00,0x06,0x00,
+    0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x01,0x00,0x01,0x00,0xD4,0x01,0x00,0x00,
     0x67,0x00,0x07,0x00,0x09,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,
-    0x2C,0x02,0x00,0x00,0x68,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x38,0x02,0x00,0x00,0x69,0x00,0x05,0x00,0x08,0x00,0x07,0x00,
-    0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x40,0x02,0x00,0x00,0x6A,0x00,0x05,0x00,
-    0x0B,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x48,0x02,0x00,0x00,
+    0xDB,0x01,0x00,0x00,0x68,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x01,0x00,0x01,0x00,0xE4,0x01,0x00,0x00,0x69,0x00,0x05,0x00,0x08,0x00,0x07,0x00,
+    0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xEB,0x01,0x00,0x00,0x6A,0x00,0x05,0x00,
+    0x0B,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x01,0x00,0x01,0x00,0xF3,0x01,0x00,0x00,
     0x6B,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0x54,0x02,0x00,0x00,0x6C,0x00,0x05,0x00,0x08,0x00,0x07,0x00,0x01,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0x5C,0x02,0x00,0x00,0x6D,0x00,0x07,0x00,0x06,0x00,0x07,0x00,
-    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x64,0x02,0x00,0x00,0x6E,0x00,0x06,0x00,
-    0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x6C,0x02,0x00,0x00,
+    0xFB,0x01,0x00,0x00,0x6C,0x00,0x05,0x00,0x08,0x00,0x07,0x00,0x01,0x00,0x08,0x00,
+    0x01,0x00,0x01,0x00,0x03,0x02,0x00,0x00,0x6D,0x00,0x07,0x00,0x06,0x00,0x07,0x00,
+    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x0A,0x02,0x00,0x00,0x6E,0x00,0x06,0x00,
+    0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x01,0x00,0x01,0x00,0x10,0x02,0x00,0x00,
     0x6F,0x00,0x06,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,
-    0x74,0x02,0x00,0x00,0x70,0x00,0x06,0x00,0x09,0x00,0x07,0x00,0x00,0x00,0x06,0x00,
-    0x00,0x00,0x01,0x00,0x7C,0x02,0x00,0x00,0x71,0x00,0x06,0x00,0x09,0x00,0x07,0x00,
-    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x88,0x02,0x00,0x00,0x72,0x00,0x05,0x00,
-    0x06,0x00,0x07,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x94,0x02,0x00,0x00,
+    0x15,0x02,0x00,0x00,0x70,0x00,0x06,0x00,0x09,0x00,0x07,0x00,0x00,0x00,0x06,0x00,
+    0x00,0x00,0x01,0x00,0x1B,0x02,0x00,0x00,0x71,0x00,0x06,0x00,0x09,0x00,0x07,0x00,
+    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x24,0x02,0x00,0x00,0x72,0x00,0x05,0x00,
+    0x06,0x00,0x07,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x2D,0x02,0x00,0x00,
     0x73,0x00,0x05,0x00,0x06,0x00,0x07,0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x01,0x00,
-    0x9C,0x02,0x00,0x00,0x74,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0xA4,0x02,0x00,0x00,0x75,0x00,0x06,0x00,0x06,0x00,0x07,0x00,
-    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xAC,0x02,0x00,0x00,0x76,0x00,0x07,0x00,
-    0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xB4,0x02,0x00,0x00,
+    0x33,0x02,0x00,0x00,0x74,0x00,0x06,0x00,0x08,0x00,0x07,0x00,0x00,0x00,0x08,0x00,
+    0x00,0x00,0x01,0x00,0x39,0x02,0x00,0x00,0x75,0x00,0x06,0x00,0x06,0x00,0x07,0x00,
+    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x41,0x02,0x00,0x00,0x76,0x00,0x07,0x00,
+    0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x47,0x02,0x00,0x00,
     0x77,0x00,0x08,0x00,0x06,0x00,0x07,0x00,0xFF,0xFF,0x06,0x00,0x00,0x00,0x01,0x00,
-    0xBC,0x02,0x00,0x00,0x78,0x00,0x07,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x00,
-    0x00,0x00,0x01,0x00,0xC4,0x02,0x00,0x00,0x79,0x00,0x07,0x00,0x09,0x00,0x07,0x00,
-    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xCC,0x02,0x00,0x00,0x7A,0x00,0x06,0x00,
-    0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0xD8,0x02,0x00,0x00,
+    0x4D,0x02,0x00,0x00,0x78,0x00,0x07,0x00,0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x00,
+    0x00,0x00,0x01,0x00,0x53,0x02,0x00,0x00,0x79,0x00,0x07,0x00,0x09,0x00,0x07,0x00,
+    0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x59,0x02,0x00,0x00,0x7A,0x00,0x06,0x00,
+    0x06,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x62,0x02,0x00,0x00,
     0x7B,0x00,0x05,0x00,0x0A,0x00,0x07,0x00,0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,
-    0xE0,0x02,0x00,0x00,0x7C,0x00,0x02,0x00,0x0B,0x00,0x07,0x00,0x02,0x00,0x08,0x00,
-    0x00,0x00,0x01,0x00,0xEC,0x02,0x00,0x00,0x7D,0x00,0x05,0x00,0x0A,0x00,0x07,0x00,
-    0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0xF8,0x02,0x00,0x00,0x7E,0x00,0x06,0x00,
-    0x04,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x04,0x03,0x00,0x00,
+    0x68,0x02,0x00,0x00,0x7C,0x00,0x02,0x00,0x0B,0x00,0x07,0x00,0x02,0x00,0x08,0x00,
+    0x01,0x00,0x01,0x00,0x72,0x02,0x00,0x00,0x7D,0x00,0x05,0x00,0x0A,0x00,0x07,0x00,
+    0x01,0x00,0x08,0x00,0x00,0x00,0x01,0x00,0x75,0x02,0x00,0x00,0x7E,0x00,0x06,0x00,
+    0x04,0x00,0x07,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x01,0x00,0x7F,0x02,0x00,0x00,
 };
 
 /*********************************
- * raw font glyph data
+ * run length encoded font glyph data
+ * written by tools/le_font_rle.py, regenerating the fonts in MHC
+ * writes raw glyphs again, so run it afterwards
  ********************************/
-const uint8_t NotoMono_Regular_glyphs[776] =
+const uint8_t NotoMono_Regular_glyphs[643] =
 {
-    0x40,0x40,0x40,0x40,0x40,0x00,0x00,0x40,0x50,0x50,0x50,0x00,0x24,0x20,0x7C,0x28,
-    0x08,0xFC,0x40,0x50,0x10,0x38,0x50,0x50,0x30,0x18,0x14,0x18,0x78,0x10,0x00,0x00,
-    0x60,0xA8,0xA0,0x70,0x1C,0x32,0x02,0x4C,0x30,0x48,0x48,0x30,0x54,0x9C,0xCC,0x74,
-    0x40,0x40,0x40,0x00,0x30,0x20,0x40,0x40,0x40,0x40,0x40,0x40,0x20,0x30,0x00,0x00,
-    0x40,0x20,0x20,0x10,0x10,0x10,0x10,0x30,0x20,0x40,0x00,0x00,0x10,0x10,0x7C,0x30,
-    0x28,0x00,0x00,0x00,0x00,0x10,0x10,0x7C,0x10,0x10,0x00,0x00,0x40,0x40,0x80,0x00,
-    0x70,0x00,0x00,0x00,0x40,0x40,0x00,0x00,0x10,0x10,0x20,0x20,0x20,0x40,0x40,0x80,
-    0x38,0x48,0x44,0x44,0x44,0x44,0x48,0x38,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x38,0x08,0x08,0x08,0x10,0x30,0x60,0x7C,0x78,0x08,0x08,0x30,0x08,0x04,0x08,0x78,
-    0x08,0x18,0x28,0x48,0x48,0xFC,0x08,0x08,0x78,0x40,0x40,0x78,0x08,0x04,0x08,0x78,
-    0x38,0x60,0x40,0x78,0x44,0x44,0x44,0x38,0x7C,0x00,0x08,0x08,0x10,0x10,0x20,0x20,
-    0x38,0x48,0x48,0x38,0x48,0x44,0x44,0x38,0x38,0x48,0x44,0x44,0x3C,0x04,0x08,0x30,
-    0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x40,0x00,0x00,0x40,0x80,0x80,0x00,
-    0x04,0x30,0x60,0x30,0x04,0x00,0x00,0x00,0x7C,0x00,0x7C,0x00,0x40,0x30,0x0C,0x30,
-    0x40,0x00,0x00,0x00,0x78,0x04,0x08,0x10,0x00,0x00,0x00,0x30,0x38,0x44,0x3C,0xA8,
-    0xA8,0xA8,0xBC,0x40,0x38,0x00,0x00,0x00,0x10,0x30,0x28,0x28,0x48,0x7C,0x44,0x84,
-    0x78,0x44,0x44,0x78,0x44,0x44,0x44,0x78,0x3C,0x60,0x40,0x40,0x40,0x40,0x60,0x3C,
-    0x78,0x48,0x44,0x44,0x44,0x44,0x48,0x70,0xF8,0x80,0x80,0xF0,0x80,0x80,0x80,0xF8,
-    0xF8,0x80,0x80,0xF8,0x80,0x80,0x80,0x80,0x38,0x60,0x40,0x4C,0x44,0x44,0x44,0x3C,
-    0x44,0x44,0x44,0x7C,0x44,0x44,0x44,0x44,0xF0,0x20,0x20,0x20,0x20,0x20,0x20,0xF0,
-    0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x70,0x88,0x90,0xA0,0xE0,0xE0,0x90,0x90,0x88,
-    0x80,0x80,0x80,0x80,0x80,0x80,0x80,0xF8,0x44,0x4C,0x4C,0x6C,0x24,0x34,0x14,0x14,
-    0x44,0x64,0x64,0x54,0x54,0x44,0x4C,0x4C,0x38,0x4C,0x44,0xC4,0xC4,0x44,0x4C,0x38,
-    0x78,0x44,0x44,0x4C,0x78,0x40,0x40,0x40,0x38,0x4C,0x44,0xC4,0xC4,0x44,0x4C,0x38,
-    0x08,0x04,0x00,0x00,0xF0,0x98,0x88,0x90,0xF0,0x90,0x90,0x88,0x38,0x40,0x40,0x20,
-    0x18,0x04,0x04,0x78,0x7C,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x44,0x44,0x44,0x44,
-    0x44,0x44,0x4C,0x38,0x84,0x44,0x44,0x48,0x28,0x28,0x30,0x10,0x82,0x80,0x94,0xB4,
-    0x24,0x6C,0x4C,0x4C,0x44,0x48,0x28,0x10,0x30,0x28,0x48,0x44,0xC4,0x44,0x48,0x28,
-    0x10,0x10,0x10,0x10,0x7C,0x08,0x08,0x10,0x20,0x20,0x40,0x7C,0xE0,0x80,0x80,0x80,
-    0x80,0x80,0x80,0x80,0x80,0xE0,0x00,0x00,0x80,0x40,0x40,0x20,0x20,0x20,0x10,0x10,
-    0x60,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x60,0x00,0x00,0x10,0x30,0x28,0x48,
-    0x44,0x00,0x00,0x00,0x7F,0x00,0x00,0x00,0xC0,0x40,0x00,0x00,0x78,0x08,0x3C,0x44,
-    0x4C,0x7C,0x00,0x00,0x40,0x40,0x78,0x4C,0x44,0x44,0x4C,0x78,0x38,0x40,0x40,0x40,
-    0x40,0x38,0x00,0x00,0x04,0x04,0x3C,0x4C,0x44,0x44,0x4C,0x34,0x38,0x44,0x7C,0x40,
-    0x40,0x38,0x00,0x00,0x1C,0x10,0x78,0x10,0x10,0x10,0x10,0x10,0x3C,0x48,0x48,0x38,
-    0x40,0x78,0x44,0x44,0x78,0x00,0x00,0x00,0x40,0x40,0x78,0x44,0x44,0x44,0x44,0x44,
-    0x20,0x00,0x60,0x20,0x20,0x20,0x20,0xF8,0x00,0x00,0x38,0x08,0x08,0x08,0x08,0x08,
-    0x08,0x10,0x70,0x00,0x80,0x80,0x98,0xB0,0xE0,0xE0,0x90,0x88,0x60,0x20,0x20,0x20,
-    0x20,0x20,0x20,0xF8,0xEC,0xD4,0x94,0x94,0x94,0x94,0x00,0x00,0x78,0x44,0x44,0x44,
-    0x44,0x44,0x00,0x00,0x38,0x44,0x44,0x44,0x44,0x38,0x00,0x00,0x78,0x4C,0x44,0x44,
-    0x4C,0x78,0x40,0x40,0x40,0x00,0x00,0x00,0x34,0x4C,0x44,0x44,0x4C,0x3C,0x04,0x04,
-    0x04,0x00,0x00,0x00,0xB0,0xC0,0x80,0x80,0x80,0x80,0x00,0x00,0x70,0x80,0x60,0x10,
-    0x10,0xF0,0x00,0x00,0x00,0x20,0x78,0x20,0x20,0x20,0x20,0x18,0x44,0x44,0x44,0x44,
-    0x4C,0x34,0x00,0x00,0x44,0x44,0x48,0x28,0x30,0x30,0x00,0x00,0x49,0x5A,0x52,0x16,
-    0x36,0x26,0x00,0x00,0x44,0x28,0x30,0x30,0x28,0x44,0x00,0x00,0x44,0x44,0x48,0x28,
-    0x38,0x10,0x10,0x20,0x60,0x00,0x00,0x00,0x7C,0x08,0x10,0x20,0x20,0x78,0x00,0x00,
-    0x10,0x20,0x20,0x20,0xC0,0x20,0x20,0x20,0x20,0x10,0x00,0x00,0x40,0x40,0x40,0x40,
-    0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x00,0xC0,0x20,0x20,0x20,0x30,0x20,0x20,0x20,
-    0x60,0xC0,0x00,0x00,0x00,0x60,0x18,0x00,
+    0x00,0x04,0x40,0x21,0x40,0x50,0x50,0x50,0x24,0x20,0x7C,0x28,0x08,0xFC,0x40,0x50,
+    0x10,0x38,0x50,0x50,0x30,0x18,0x14,0x18,0x78,0x10,0x60,0xA8,0xA0,0x70,0x1C,0x32,
+    0x02,0x4C,0x30,0x48,0x48,0x30,0x54,0x9C,0xCC,0x74,0x40,0x40,0x40,0x02,0x30,0x20,
+    0x00,0x05,0x40,0x02,0x20,0x30,0x40,0x20,0x20,0x10,0x10,0x10,0x10,0x30,0x20,0x40,
+    0x10,0x10,0x7C,0x30,0x28,0x00,0x10,0x10,0x7C,0x10,0x10,0x40,0x40,0x80,0x70,0x40,
+    0x40,0x10,0x10,0x20,0x20,0x20,0x40,0x40,0x80,0x38,0x48,0x44,0x44,0x44,0x44,0x48,
+    0x38,0x00,0x07,0x20,0x38,0x08,0x08,0x08,0x10,0x30,0x60,0x7C,0x78,0x08,0x08,0x30,
+    0x08,0x04,0x08,0x78,0x08,0x18,0x28,0x48,0x48,0xFC,0x08,0x08,0x78,0x40,0x40,0x78,
+    0x08,0x04,0x08,0x78,0x38,0x60,0x40,0x78,0x44,0x44,0x44,0x38,0x7C,0x00,0x08,0x08,
+    0x10,0x10,0x20,0x20,0x38,0x48,0x48,0x38,0x48,0x44,0x44,0x38,0x38,0x48,0x44,0x44,
+    0x3C,0x04,0x08,0x30,0x40,0x40,0x00,0x00,0x40,0x40,0x40,0x40,0x00,0x00,0x40,0x80,
+    0x80,0x04,0x30,0x60,0x30,0x04,0x7C,0x00,0x7C,0x40,0x30,0x0C,0x30,0x40,0x04,0x78,
+    0x04,0x08,0x10,0x31,0x30,0x38,0x44,0x3C,0xA8,0xA8,0xA8,0xBC,0x40,0x38,0x10,0x30,
+    0x28,0x28,0x48,0x7C,0x44,0x84,0x78,0x44,0x44,0x78,0x44,0x44,0x44,0x78,0x3C,0x60,
+    0x40,0x40,0x40,0x40,0x60,0x3C,0x78,0x48,0x44,0x44,0x44,0x44,0x48,0x70,0xF8,0x80,
+    0x80,0xF0,0x80,0x80,0x80,0xF8,0xF8,0x80,0x80,0xF8,0x80,0x80,0x80,0x80,0x38,0x60,
+    0x40,0x4C,0x44,0x44,0x44,0x3C,0x44,0x44,0x44,0x7C,0x44,0x44,0x44,0x44,0x01,0xF0,
+    0x00,0x05,0x20,0x01,0xF0,0x00,0x06,0x08,0x01,0x70,0x88,0x90,0xA0,0xE0,0xE0,0x90,
+    0x90,0x88,0x00,0x06,0x80,0x01,0xF8,0x44,0x4C,0x4C,0x6C,0x24,0x34,0x14,0x14,0x44,
+    0x64,0x64,0x54,0x54,0x44,0x4C,0x4C,0x38,0x4C,0x44,0xC4,0xC4,0x44,0x4C,0x38,0x78,
+    0x44,0x44,0x4C,0x78,0x40,0x40,0x40,0x38,0x4C,0x44,0xC4,0xC4,0x44,0x4C,0x38,0x08,
+    0x04,0xF0,0x98,0x88,0x90,0xF0,0x90,0x90,0x88,0x38,0x40,0x40,0x20,0x18,0x04,0x04,
+    0x78,0x01,0x7C,0x00,0x06,0x10,0x00,0x05,0x44,0x02,0x4C,0x38,0x84,0x44,0x44,0x48,
+    0x28,0x28,0x30,0x10,0x82,0x80,0x94,0xB4,0x24,0x6C,0x4C,0x4C,0x44,0x48,0x28,0x10,
+    0x30,0x28,0x48,0x44,0xC4,0x44,0x48,0x28,0x10,0x10,0x10,0x10,0x7C,0x08,0x08,0x10,
+    0x20,0x20,0x40,0x7C,0x01,0xE0,0x00,0x07,0x80,0x01,0xE0,0x80,0x40,0x40,0x20,0x20,
+    0x20,0x10,0x10,0x01,0x60,0x00,0x07,0x20,0x01,0x60,0x10,0x30,0x28,0x48,0x44,0x7F,
+    0xC0,0x40,0x78,0x08,0x3C,0x44,0x4C,0x7C,0x40,0x40,0x78,0x4C,0x44,0x44,0x4C,0x78,
+    0x38,0x40,0x40,0x40,0x40,0x38,0x04,0x04,0x3C,0x4C,0x44,0x44,0x4C,0x34,0x38,0x44,
+    0x7C,0x40,0x40,0x38,0x03,0x1C,0x10,0x78,0x00,0x04,0x10,0x3C,0x48,0x48,0x38,0x40,
+    0x78,0x44,0x44,0x78,0x03,0x40,0x40,0x78,0x00,0x04,0x44,0x20,0x00,0x60,0x20,0x20,
+    0x20,0x20,0xF8,0x21,0x38,0x00,0x05,0x08,0x02,0x10,0x70,0x80,0x80,0x98,0xB0,0xE0,
+    0xE0,0x90,0x88,0x01,0x60,0x00,0x05,0x20,0x01,0xF8,0xEC,0xD4,0x94,0x94,0x94,0x94,
+    0x01,0x78,0x00,0x04,0x44,0x38,0x44,0x44,0x44,0x44,0x38,0x78,0x4C,0x44,0x44,0x4C,
+    0x78,0x40,0x40,0x40,0x34,0x4C,0x44,0x44,0x4C,0x3C,0x04,0x04,0x04,0xB0,0xC0,0x80,
+    0x80,0x80,0x80,0x70,0x80,0x60,0x10,0x10,0xF0,0x00,0x20,0x78,0x20,0x20,0x20,0x20,
+    0x18,0x44,0x44,0x44,0x44,0x4C,0x34,0x44,0x44,0x48,0x28,0x30,0x30,0x49,0x5A,0x52,
+    0x16,0x36,0x26,0x44,0x28,0x30,0x30,0x28,0x44,0x44,0x44,0x48,0x28,0x38,0x10,0x10,
+    0x20,0x60,0x7C,0x08,0x10,0x20,0x20,0x78,0x10,0x20,0x20,0x20,0xC0,0x20,0x20,0x20,
+    0x20,0x10,0x00,0x0A,0x40,0xC0,0x20,0x20,0x20,0x30,0x20,0x20,0x20,0x60,0xC0,0x00,
+    0x60,0x18,0x00,
 };
 
 leRasterFont NotoMono_Regular =
@@ -435,7 +428,7 @@ leRasterFont NotoMono_Regular =
         {
             LE_STREAM_LOCATION_ID_INTERNAL, // data location id
             (void*)NotoMono_Regular_glyphs, // glyph table variable pointer
-            776, // data size
+            643, // data size
         },
         LE_RASTER_FONT,
         0,
@@ -444,5 +437,9 @@ leRasterFont NotoMono_Regular =
     9,
     LE_FONT_BPP_1, // bits per pixel
     NotoMono_Regular_data, // kerning table
+    {
+        LE_FONT_GLYPH_INDEX_RANGE, // glyph lookup index
+        0x20, // first code point
+    },
 };
 
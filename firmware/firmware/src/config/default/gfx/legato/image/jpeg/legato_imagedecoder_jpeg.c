@@ -101,14 +101,22 @@ static void blitToFrameBuffer(JPEGDECODER* state,
 {
     int32_t row, col;
     uint32_t color;
-    (void)state; // unused
     (void)src_width; // unused
     (void)src_height; // unused
 
     for(row = 0; row < buffer->size.height; ++row)
     {
+        // the last block row and column are padded past the image
+        if(dest_y + row < state->clipRect.y ||
+           dest_y + row >= state->clipRect.y + state->clipRect.height)
+            continue;
+
         for(col = 0; col < buffer->size.width; ++col)
         {
+            if(dest_x + col < state->clipRect.x ||
+               dest_x + col >= state->clipRect.x + state->clipRect.width)
+                continue;
+
             color = lePixelBufferGet_Unsafe(buffer,
                                             src_x + col,
                                             src_y + row);
@@ -151,15 +159,22 @@ static void blitToImage(JPEGDECODER* state,
 
     for(row = 0; row < buffer->size.height; ++row)
     {
+        // the last block row is padded past the bottom of the image
+        if(dest_y + row < 0 || dest_y + row >= state->imageWriteBuffer->size.height)
+            continue;
+
         for(col = 0; col < buffer->size.width; ++col)
         {
+            if(dest_x + col < 0 || dest_x + col >= state->imageWriteBuffer->size.width)
+                continue;
+
             color = lePixelBufferGet_Unsafe(buffer,
                                             src_x + col,
                                             src_y + row);
 
-            color = leColorConvert(color, buffer->mode, state->imageWriteBuffer->mode);
+            color = leColorConvert(buffer->mode, state->imageWriteBuffer->mode, color);
 
-            lePixelBufferSet(state->imageWriteBuffer,
+            lePixelBufferSet_Unsafe(state->imageWriteBuffer,
                              dest_x + col,
                              dest_y + row,
                              color);
@@ -178,6 +193,7 @@ static leResult _draw(const leImage* img,
     static uint16_t whblocks, wvblocks;
     static uint16_t wi, wj;
     static JPEGDECODER JPEG_JpegDecoder;
+    leRect imgRect, clipRect;
     (void)srcRect; // unused
 
     memset(&JPEG_JpegDecoder, 0, sizeof(JPEG_JpegDecoder));
@@ -216,7 +232,15 @@ static leResult _draw(const leImage* img,
 
     JPEG_JpegDecoder.blitPtr = blitToFrameBuffer;
     JPEG_JpegDecoder.globalAlpha = a;
-    leRenderer_GetClipRect(&JPEG_JpegDecoder.clipRect);
+
+    imgRect.x = x;
+    imgRect.y = y;
+    imgRect.width = img->buffer.size.width;
+    imgRect.height = img->buffer.size.height;
+
+    leRenderer_GetClipRect(&clipRect);
+    leRectClip(&imgRect, &clipRect, &JPEG_JpegDecoder.clipRect);
+
     JPEG_JpegDecoder.wStartY = 0;
     JPEG_JpegDecoder.wStartX = 0;
     JPEG_JpegDecoder.wDrawWidth = img->buffer.size.width;
@@ -333,7 +357,10 @@ static leResult _render(const leImage* src,
     JPEG_JpegDecoder.imageWriteBuffer = &dst->buffer;
     JPEG_JpegDecoder.readPtr = &internalMemoryRead;
     JPEG_JpegDecoder.blitPtr = blitToImage;
-    leRenderer_GetClipRect(&JPEG_JpegDecoder.clipRect);
+    JPEG_JpegDecoder.clipRect.x = 0;
+    JPEG_JpegDecoder.clipRect.y = 0;
+    JPEG_JpegDecoder.clipRect.width = dst->buffer.size.width;
+    JPEG_JpegDecoder.clipRect.height = dst->buffer.size.height;
     JPEG_JpegDecoder.wStartY = 0;
     JPEG_JpegDecoder.wStartX = 0;
     JPEG_JpegDecoder.wDrawWidth = src->buffer.size.width;
@@ -339,7 +339,7 @@ leResult leImage_Render(const leImage* src,
             {
                 decoders[decIdx]->exec();
 
-                break;
+                return LE_SUCCESS;
             }
         }
     }
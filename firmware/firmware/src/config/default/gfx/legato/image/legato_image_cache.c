@@ -0,0 +1,208 @@
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2020 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+#include "gfx/legato/image/legato_image_cache.h"
+
+#if LE_IMAGE_CACHE_ENABLED == 1
+
+#include "gfx/legato/renderer/legato_renderer.h"
+
+typedef struct leImageCacheEntry
+{
+    const void* owner;     // NULL for a free entry
+    const leImage* source; // the image the copy was decoded from
+    leImage* copy;         // the raw copy
+    uint32_t size;         // pixel bytes of the copy
+    uint32_t lastUse;      // use counter value of the last hit
+} leImageCacheEntry;
+
+static leImageCacheEntry _entries[LE_IMAGE_CACHE_ENTRIES];
+static leImageCacheStats _stats;
+static uint32_t _useCount;
+
+static leImageCacheEntry* findEntry(const void* owner)
+{
+    uint32_t i;
+
+    for(i = 0; i < LE_IMAGE_CACHE_ENTRIES; i++)
+    {
+        if(_entries[i].owner == owner)
+            return &_entries[i];
+    }
+
+    return NULL;
+}
+
+static void freeEntry(leImageCacheEntry* entry)
+{
+    leImage_Free(entry->copy);
+
+    _stats.bytes -= entry->size;
+
+    entry->owner = NULL;
+    entry->source = NULL;
+    entry->copy = NULL;
+    entry->size = 0;
+}
+
+// frees least recently used copies until size bytes and an entry are free
+static leImageCacheEntry* makeRoom(uint32_t size)
+{
+    leImageCacheEntry* lru;
+    uint32_t i;
+
+    while(1)
+    {
+        if(_stats.bytes + size <= LE_IMAGE_CACHE_BUDGET)
+        {
+            lru = findEntry(NULL);
+
+            if(lru != NULL)
+                return lru;
+        }
+
+        lru = NULL;
+
+        for(i = 0; i < LE_IMAGE_CACHE_ENTRIES; i++)
+        {
+            if(_entries[i].owner != NULL &&
+               (lru == NULL || _entries[i].lastUse < lru->lastUse))
+            {
+                lru = &_entries[i];
+            }
+        }
+
+        if(lru == NULL)
+            return NULL;
+
+        freeEntry(lru);
+
+        _stats.evictions++;
+    }
+}
+
+static leBool isCacheable(const leImage* img)
+{
+    return img->format != LE_IMAGE_FORMAT_RAW &&
+           (img->flags & (LE_IMAGE_USE_MASK_COLOR | LE_IMAGE_USE_MASK_MAP)) == 0 &&
+           img->alphaMap == NULL;
+}
+
+const leImage* leImageCache_Get(const void* owner, const leImage* img)
+{
+    leImageCacheEntry* entry;
+    leColorMode mode;
+    leRect srcRect;
+    uint32_t size;
+
+    if(owner == NULL || img == NULL)
+        return NULL;
+
+    entry = findEntry(owner);
+
+    if(entry != NULL)
+    {
+        if(entry->source == img)
+        {
+            entry->lastUse = ++_useCount;
+
+            _stats.hits++;
+
+            return entry->copy;
+        }
+
+        // the owner shows something else now
+        freeEntry(entry);
+    }
+
+    if(isCacheable(img) == LE_FALSE)
+        return NULL;
+
+    mode = leRenderer_CurrentColorMode();
+
+    size = (uint32_t)img->buffer.size.width *
+           (uint32_t)img->buffer.size.height *
+           leColorInfoTable[mode].size;
+
+    if(size == 0 || size > LE_IMAGE_CACHE_BUDGET)
+        return NULL;
+
+    entry = makeRoom(size);
+
+    if(entry == NULL)
+        return NULL;
+
+    entry->copy = leImage_Allocate(img->buffer.size.width,
+                                   img->buffer.size.height,
+                                   mode);
+
+    if(entry->copy == NULL)
+        return NULL;
+
+    srcRect.x = 0;
+    srcRect.y = 0;
+    srcRect.width = img->buffer.size.width;
+    srcRect.height = img->buffer.size.height;
+
+    if(leImage_Render(img, &srcRect, 0, 0, LE_TRUE, LE_TRUE, entry->copy) == LE_FAILURE)
+    {
+        leImage_Free(entry->copy);
+        entry->copy = NULL;
+
+        return NULL;
+    }
+
+    entry->owner = owner;
+    entry->source = img;
+    entry->size = size;
+    entry->lastUse = ++_useCount;
+
+    _stats.bytes += size;
+    _stats.misses++;
+
+    return entry->copy;
+}
+
+void leImageCache_Release(const void* owner)
+{
+    leImageCacheEntry* entry;
+
+    if(owner == NULL)
+        return;
+
+    entry = findEntry(owner);
+
+    if(entry != NULL)
+    {
+        freeEntry(entry);
+    }
+}
+
+void leImageCache_GetStats(leImageCacheStats* stats)
+{
+    *stats = _stats;
+}
+
+#endif /* LE_IMAGE_CACHE_ENABLED */
@@ -0,0 +1,141 @@
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2020 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+/*******************************************************************************
+ Module for Microchip Graphics Library - Legato User Interface Library
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    legato_image_cache.h
+
+  Summary:
+    Decoded copies of compressed images, kept per owner
+
+  Description:
+    A widget that draws a JPEG, PNG or RLE image asks the cache for a raw
+    copy in the render color mode and draws that instead, so the image is
+    only decoded once.  The copies are allocated with LE_MALLOC and the least
+    recently used ones are evicted to stay within LE_IMAGE_CACHE_BUDGET
+    bytes of pixel data.
+*******************************************************************************/
+
+/** \file legato_image_cache.h
+* @brief Decoded image cache
+*
+* @details Keeps decoded raw copies of compressed images per owner.
+*/
+
+#ifndef LE_IMAGE_CACHE_H
+#define LE_IMAGE_CACHE_H
+
+#include "gfx/legato/image/legato_image.h"
+
+#if LE_IMAGE_CACHE_ENABLED == 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+/* Structure:
+    leImageCacheStats
+
+  Summary:
+    Image cache statistics
+
+  Description:
+    hits - draws served from a cached copy
+    misses - copies decoded
+    evictions - copies freed to make room for another one
+    bytes - pixel bytes currently cached
+*/
+typedef struct leImageCacheStats
+{
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t bytes;
+} leImageCacheStats;
+
+// *****************************************************************************
+/* Function:
+    const leImage* leImageCache_Get(const void* owner, const leImage* img)
+
+  Summary:
+    Returns a decoded copy of an image, decoding it if needed
+
+  Description:
+    Each owner has at most one copy.  Asking for a different image replaces
+    the owner's copy.  Raw images, images with a mask or an alpha map and
+    images larger than the budget are not cached.
+
+  Parameters:
+    const void* owner - the owner, typically the drawing widget
+    const leImage* img - the source image
+
+  Returns:
+    const leImage* - the copy, NULL if the image should be drawn directly
+*/
+const leImage* leImageCache_Get(const void* owner, const leImage* img);
+
+// *****************************************************************************
+/* Function:
+    void leImageCache_Release(const void* owner)
+
+  Summary:
+    Frees the copy of an owner
+
+  Parameters:
+    const void* owner - the owner
+
+  Returns:
+    void
+*/
+void leImageCache_Release(const void* owner);
+
+// *****************************************************************************
+/* Function:
+    void leImageCache_GetStats(leImageCacheStats* stats)
+
+  Summary:
+    Copies out the cache statistics
+
+  Parameters:
+    leImageCacheStats* stats - the destination
+
+  Returns:
+    void
+*/
+void leImageCache_GetStats(leImageCacheStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LE_IMAGE_CACHE_ENABLED */
+
+#endif /* LE_IMAGE_CACHE_H */
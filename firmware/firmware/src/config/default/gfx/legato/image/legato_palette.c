@@ -38,7 +38,7 @@ leColor lePalette_GetColor(lePalette* pal, uint32_t idx)
 
     size = leColorInfoTable[pal->colorMode].size;
 
-    ptr = ((uint8_t*)pal->header.address) + idx;
+    ptr = ((uint8_t*)pal->header.address) + idx * size;
 
     memcpy(&clr, ptr, size);
     
@@ -207,6 +207,7 @@ static leResult _initBlendStage(leRawDecodeState* state)
     return LE_SUCCESS;
 }
 
+#if LE_SCRATCH_BIG_ENDIAN == 0
 static void _directBlit(const lePixelBuffer* src,
                         const leRect* srcRect,
                         const leRect* destRect)
@@ -236,6 +237,7 @@ static void _directBlit(const lePixelBuffer* src,
         memcpy(destPtr, srcPtr, rowSize);
     }
 }
+#endif
 
 static leResult _draw(const leImage* img,
                       const leRect* srcRect,
@@ -292,14 +294,18 @@ static leResult _draw(const leImage* img,
     _state.destRect = clipRect;
 
     _state.globalAlpha = a;
+    _state.pixelAlpha = 255;
 
     _state.targetMode = leRenderer_CurrentColorMode();
 
     if(img->header.location == LE_STREAM_LOCATION_ID_INTERNAL &&
        img->format == LE_IMAGE_FORMAT_RAW)
     {
+        // a raw copy would bypass the scratch byte order conversion
+#if LE_SCRATCH_BIG_ENDIAN == 0
         if((img->flags & LE_IMAGE_DIRECT_BLIT) > 0 &&
-           img->buffer.mode == _state.targetMode)
+           img->buffer.mode == _state.targetMode &&
+           leGetRenderBuffer()->mode == _state.targetMode)
         {
             _directBlit(&_state.source->buffer,
                         &_state.sourceRect,
@@ -309,8 +315,13 @@ static leResult _draw(const leImage* img,
             // failure indicates to the exe loop that there are no stages to run
             return LE_FAILURE;
         }
+#endif
 
-        if(leGPU_BlitBuffer(&_state.source->buffer,
+        // the GPU copies pixels as they are, masked images need the stages
+        if((img->flags & (LE_IMAGE_USE_MASK_COLOR |
+                          LE_IMAGE_USE_MASK_MAP |
+                          LE_IMAGE_USE_ALPHA_MAP)) == 0 &&
+           leGPU_BlitBuffer(&_state.source->buffer,
                             &_state.sourceRect,
                             &_state.destRect,
                             a) == LE_SUCCESS)
@@ -539,6 +550,7 @@ static leResult _resizeDraw(const leImage* src,
     _state.targetMode = leRenderer_CurrentColorMode();
 
     _state.globalAlpha = a;
+    _state.pixelAlpha = 255;
 
 
     if(src->header.location == LE_STREAM_LOCATION_ID_INTERNAL &&
@@ -1056,6 +1068,7 @@ static leResult _rotateDraw(const leImage* src,
     _state.targetMode = leRenderer_CurrentColorMode();
 
     _state.globalAlpha = a;
+    _state.pixelAlpha = 255;
 
     _state.randomRLE = LE_TRUE;
 
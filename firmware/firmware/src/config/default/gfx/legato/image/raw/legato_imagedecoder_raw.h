@@ -172,7 +172,7 @@ typedef struct leRawDecodeState
     leColor writeColor;
 
     uint32_t globalAlpha; // a global alpha state
-    uint32_t pixelAlpha; // a pixel alpha state (not used yet)
+    uint32_t pixelAlpha; // alpha of the current pixel left to the write stage
 
     const lePixelBuffer* palette; // pointer to a lookup table if needed
 
@@ -102,6 +102,39 @@ static leResult stage_BlendARGB8888(leRawDecodeStage* stage)
     return LE_SUCCESS;
 }
 
+#if LE_ALPHA_BLENDING_ENABLED == 1
+// RGB565 frame buffer targets are blended by the renderer, which does it on
+// the packed pixels.  these stages only pass the pixel alpha on to the write
+// stage
+static leResult stage_PassAlphaRGBA8888(leRawDecodeStage* stage)
+{
+    stage->state->pixelAlpha = stage->state->writeColor & RGBA_8888_ALPHA_MASK;
+
+    // completely transparent, discard
+    if(stage->state->pixelAlpha == 0)
+    {
+        // reset stage index
+        stage->state->currentStage = -1;
+    }
+
+    return LE_SUCCESS;
+}
+
+static leResult stage_PassAlphaARGB8888(leRawDecodeStage* stage)
+{
+    stage->state->pixelAlpha = (stage->state->writeColor & ARGB_8888_ALPHA_MASK) >> 24;
+
+    // completely transparent, discard
+    if(stage->state->pixelAlpha == 0)
+    {
+        // reset stage index
+        stage->state->currentStage = -1;
+    }
+
+    return LE_SUCCESS;
+}
+#endif
+
 leResult _leRawImageDecoder_BlendStage_Internal(leRawDecodeState* state)
 {
     memset(&blendStage, 0, sizeof(blendStage));
@@ -117,11 +150,29 @@ leResult _leRawImageDecoder_BlendStage_Internal(leRawDecodeState* state)
     }
     else if(state->source->buffer.mode == LE_COLOR_MODE_RGBA_8888)
     {
-        blendStage.base.exec = stage_BlendRGBA8888;
+#if LE_ALPHA_BLENDING_ENABLED == 1
+        if(state->target == NULL && state->targetMode == LE_COLOR_MODE_RGB_565)
+        {
+            blendStage.base.exec = stage_PassAlphaRGBA8888;
+        }
+        else
+#endif
+        {
+            blendStage.base.exec = stage_BlendRGBA8888;
+        }
     }
     else if(state->source->buffer.mode == LE_COLOR_MODE_ARGB_8888)
     {
-        blendStage.base.exec = stage_BlendARGB8888;
+#if LE_ALPHA_BLENDING_ENABLED == 1
+        if(state->target == NULL && state->targetMode == LE_COLOR_MODE_RGB_565)
+        {
+            blendStage.base.exec = stage_PassAlphaARGB8888;
+        }
+        else
+#endif
+        {
+            blendStage.base.exec = stage_BlendARGB8888;
+        }
     }
     else
     {
@@ -43,11 +43,19 @@ static struct FrameBufferWriteStage
 #if LE_ALPHA_BLENDING_ENABLED == 1
 static leResult stage_FrameBufferWrite(leRawDecodeStage* stage)
 {
+    uint32_t a = stage->state->globalAlpha;
+
+    // apply the pixel alpha the blend stage passed on
+    if(stage->state->pixelAlpha < 255)
+    {
+        a = (a * stage->state->pixelAlpha + 127) / 255;
+    }
+
     // write color
     leRenderer_BlendPixel(stage->state->targetX,
                           stage->state->targetY,
                           stage->state->writeColor,
-                          stage->state->globalAlpha);
+                          a);
 
     /*printf("%i, %i, %u\n", stage->state->targetX,
                            stage->state->targetY,
@@ -56,12 +56,14 @@
 
 #include "gfx/legato/common/legato_color.h"
 #include "gfx/legato/common/legato_math.h"
+#include "gfx/legato/core/legato_command.h"
 #include "gfx/legato/core/legato_input.h"
 #include "gfx/legato/core/legato_scheme.h"
 #include "gfx/legato/core/legato_state.h"
 #include "gfx/legato/core/legato_stream.h"
 #include "gfx/legato/font/legato_font.h"
 #include "gfx/legato/image/legato_image.h"
+#include "gfx/legato/image/legato_image_cache.h"
 #include "gfx/legato/image/legato_palette.h"
 #include "gfx/legato/memory/legato_memory.h"
 #include "gfx/driver/gfx_driver.h"
@@ -69,6 +71,7 @@
 #include "gfx/legato/string/legato_dynamicstring.h"
 #include "gfx/legato/string/legato_fixedstring.h"
 #include "gfx/legato/string/legato_tablestring.h"
+#include "gfx/legato/string/legato_string_cache.h"
 #include "gfx/legato/common/legato_utils.h"
 
 #include "gfx/legato/widget/legato_editwidget.h"
@@ -89,6 +89,11 @@ extern "C" {
 #define LE_INCLUDE_DEFAULT_1BPP_FONT         0
 #define LE_INCLUDE_DEFAULT_8BPP_FONT         0
 
+// run length encoded glyph support, the row size bounds the decoded row of an
+// encoded glyph in bytes
+#define LE_FONT_RLE_ENABLED                  1
+#define LE_FONT_RLE_ROW_SIZE                 64
+
 // widget inclusion
 #define LE_ARC_WIDGET_ENABLED              0
 #define LE_BARGRAPH_WIDGET_ENABLED         0
@@ -128,9 +133,21 @@ extern "C" {
 
 #define LE_USE_ALLOCATION_TRACKING         0
 
+// decoded image cache configuration, the budget is in bytes of pixel data
+// and comes out of the variable heap
+#define LE_IMAGE_CACHE_ENABLED             1
+#define LE_IMAGE_CACHE_BUDGET              4608
+#define LE_IMAGE_CACHE_ENTRIES             4
+
+// rendered string cache configuration, the budget is in bytes of text and
+// 1bpp mask data
+#define LE_STRING_CACHE_ENABLED            1
+#define LE_STRING_CACHE_BUDGET             1024
+#define LE_STRING_CACHE_ENTRIES            8
+
 // variable heap configuration
 #define LE_VARIABLEHEAP_DEBUGLEVEL         0
-#define LE_VARIABLEHEAP_SIZE               1024
+#define LE_VARIABLEHEAP_SIZE               7168 // 1024 + image and string cache budgets + headers
 #define LE_VARIABLEHEAP_MINALLOCSIZE       32
 #define LE_VARIABLEHEAP_ALIGNMENT          4
 #define LE_VARIABLEHEAP_BESTFIT            1
@@ -154,10 +171,21 @@ extern "C" {
 
 // renderer config
 #define LE_ALPHA_BLENDING_ENABLED          1
-#define LE_SCRATCH_BUFFER_COUNT            1
+#define LE_SCRATCH_BUFFER_COUNT            2
 #define LE_SCRATCH_BUFFER_SIZE_KB          2
 #define LE_SCRATCH_BUFFER_PADDING          0
-#define LE_SCRATCH_BIG_ENDIAN              0
+#define LE_SCRATCH_BIG_ENDIAN              1
+#define LE_RENDERER_DAMAGE_STATS           1
+#define LE_INDEXED_SCRATCH                 1
+#define LE_RENDERER_PROFILE                0
+#define LE_RENDERER_OCCLUSION              1
+#define LE_STRING_LAYOUT_CACHE_ENABLED     1
+#define LE_STRING_LAYOUT_CACHE_LINES       4
+#define LE_FONT_GLYPH_INDEX_ENABLED        1
+#define LE_FONT_GLYPH_RECENT_COUNT         0
+#define LE_COMMAND_QUEUE_SIZE              8
+#define LE_COMMAND_TEXT_SIZE               32
+#define LE_COMMAND_MAX_FPS                 30
 #define LE_USE_ARC_SCAN_FILL               1
 #define LE_ARC_SMOOTH_EDGE                 LE_FALSE
 
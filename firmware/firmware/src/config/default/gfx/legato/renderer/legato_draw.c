@@ -45,8 +45,154 @@ static struct DrawFunctionState
     leResult (*blendPixel)(int32_t x, int32_t y, leColor clr, uint32_t a);
     leResult (*fill)(int32_t x, int32_t y, uint32_t width, uint32_t height, leColor clr, uint32_t a);
     leResult (*blendFill)(int32_t x, int32_t y, uint32_t width, uint32_t height, leColor clr, uint32_t a);
+    leResult (*maskRow)(int32_t x, int32_t y, const uint8_t* mask, int32_t colStart, int32_t colEnd, leColor clr);
 } _drawFunction;
 
+#if LE_SCRATCH_BIG_ENDIAN == 1
+// scratch buffers hold pixels in the byte order the display expects on the
+// wire so the driver can transmit them without a per-pixel swap.  all reads
+// and writes of the scratch buffer in this file go through this conversion,
+// which is its own inverse.
+static leColor _scratchOrder(leColor clr)
+{
+    switch(leColorInfoTable[_currentMode].size)
+    {
+        case 2:
+            return ((clr & 0xFF) << 8) | ((clr >> 8) & 0xFF);
+        case 3:
+            return ((clr & 0xFF) << 16) | (clr & 0xFF00) | ((clr >> 16) & 0xFF);
+        case 4:
+            return ((clr & 0xFF) << 24) | ((clr & 0xFF00) << 8) |
+                   ((clr >> 8) & 0xFF00) | ((clr >> 24) & 0xFF);
+        default:
+            return clr;
+    }
+}
+#else
+#define _scratchOrder(clr) (clr)
+#endif
+
+#if LE_INDEXED_SCRATCH == 1
+#define INDEX_CACHE_SIZE 16
+
+// indexed scratch buffers store palette indices packed most significant bit
+// first, continuously across rows.  colors are matched to the nearest
+// palette entry, the last few matches are cached since widgets draw with
+// few distinct colors.
+static struct IndexedScratchState
+{
+    lePalette* palette;                     // NULL when not drawing indexed
+    uint32_t bpp;                           // bits per index, 1, 4 or 8
+    leColor cacheColor[INDEX_CACHE_SIZE];
+    int32_t cacheIndex[INDEX_CACHE_SIZE];   // -1 for an empty slot
+} _indexed;
+
+static uint32_t _indexGet(const lePixelBuffer* buf,
+                          int32_t x,
+                          int32_t y)
+{
+    const uint8_t* ptr = (const uint8_t*)buf->pixels;
+    uint32_t idx = x + y * buf->size.width;
+
+    switch(_indexed.bpp)
+    {
+        case 1:
+            return (ptr[idx >> 3] >> (7 - (idx & 0x7))) & 0x1;
+        case 4:
+            return (ptr[idx >> 1] >> ((idx & 0x1) ? 0 : 4)) & 0xF;
+        default:
+            return ptr[idx];
+    }
+}
+
+static void _indexSet(lePixelBuffer* buf,
+                      int32_t x,
+                      int32_t y,
+                      uint32_t val)
+{
+    uint8_t* ptr = (uint8_t*)buf->pixels;
+    uint32_t idx = x + y * buf->size.width;
+    uint32_t shift;
+
+    switch(_indexed.bpp)
+    {
+        case 1:
+        {
+            shift = 7 - (idx & 0x7);
+            ptr[idx >> 3] = (ptr[idx >> 3] & ~(0x1 << shift)) | (val << shift);
+
+            break;
+        }
+        case 4:
+        {
+            shift = (idx & 0x1) ? 0 : 4;
+            ptr[idx >> 1] = (ptr[idx >> 1] & ~(0xF << shift)) | (val << shift);
+
+            break;
+        }
+        default:
+        {
+            ptr[idx] = val;
+        }
+    }
+}
+
+// the palette color of an index, in the current color mode
+static leColor _indexColor(uint32_t idx)
+{
+    if(idx >= _indexed.palette->colorCount)
+    {
+        idx = 0;
+    }
+
+    return leColorConvert(_indexed.palette->colorMode,
+                          _currentMode,
+                          lePalette_GetColor(_indexed.palette, idx));
+}
+
+// the palette index closest to a color in the current color mode
+static uint32_t _indexNearest(leColor clr)
+{
+    uint32_t slot = (clr ^ (clr >> 5) ^ (clr >> 11)) % INDEX_CACHE_SIZE;
+    uint32_t i, best = 0;
+    uint32_t dist, bestDist = UINT32_MAX;
+    int32_t dr, dg, db;
+    leColor rgb, entry;
+
+    if(_indexed.cacheIndex[slot] >= 0 && _indexed.cacheColor[slot] == clr)
+        return _indexed.cacheIndex[slot];
+
+    rgb = leColorConvert(_currentMode, LE_COLOR_MODE_RGB_888, clr);
+
+    for(i = 0; i < _indexed.palette->colorCount; i++)
+    {
+        entry = leColorConvert(_indexed.palette->colorMode,
+                               LE_COLOR_MODE_RGB_888,
+                               lePalette_GetColor(_indexed.palette, i));
+
+        dr = (int32_t)((rgb >> 16) & 0xFF) - (int32_t)((entry >> 16) & 0xFF);
+        dg = (int32_t)((rgb >> 8) & 0xFF) - (int32_t)((entry >> 8) & 0xFF);
+        db = (int32_t)(rgb & 0xFF) - (int32_t)(entry & 0xFF);
+
+        dist = dr * dr + dg * dg + db * db;
+
+        if(dist < bestDist)
+        {
+            bestDist = dist;
+            best = i;
+
+            if(dist == 0)
+                break;
+        }
+    }
+
+    _indexed.cacheColor[slot] = clr;
+    _indexed.cacheIndex[slot] = best;
+
+    return best;
+}
+#endif
+
 static leResult _RGBPutPixel(int32_t x,
                              int32_t y,
                              leColor clr,
@@ -61,50 +207,29 @@ static leResult _RGBPutPixel(int32_t x,
     lePixelBufferSet_Unsafe(leGetRenderBuffer(),
                             x,
                             y,
-                            clr);
+                            _scratchOrder(clr));
 
     return LE_SUCCESS;
 }
 
 #if LE_ALPHA_BLENDING_ENABLED == 1
-static leResult _RGBBlendPixel(int32_t x,
-                               int32_t y,
-                               leColor clr,
-                               uint32_t a)
+// blends clr over dest, both in the current color mode.  returns LE_FAILURE
+// when the source is fully transparent and dest is left as is.
+static leResult _blendColor(leColor clr,
+                            leColor dest,
+                            uint32_t a,
+                            leColor* result)
 {
-    leColor nativeSource;
     leColor rgbaSource;
     leColor rgbaDest;
     leColor resultClr;
-    uint32_t currentAlpha = 0xFF;
+    uint32_t currentAlpha;
     uint32_t alphaPercent;
 
-    if(a == 0)
-        return LE_SUCCESS;
-
-    if(_alphaColorMode == LE_TRUE)
-    {
-        currentAlpha = leColorChannelAlpha(clr, _currentMode);
-    }
-
-    if(currentAlpha == 0)
-        return LE_SUCCESS;
-
-    if(a == 0xFF && currentAlpha == 0xFF)
-    {
-        return _RGBPutPixel(x, y, clr, 0);
-    }
-
-#if LE_RENDER_ORIENTATION != 0
-    leUtils_PointLogicalToScratch((int16_t*)&x, (int16_t*)&y);
-#endif
-
     // upscale to alpha channel type
-    nativeSource = lePixelBufferGet_Unsafe(leGetRenderBuffer(), x, y);
-
     rgbaDest = leColorConvert(leRenderer_CurrentColorMode(),
                               LE_COLOR_MODE_RGBA_8888,
-                              nativeSource);
+                              dest);
 
     rgbaSource = leColorConvert(leRenderer_CurrentColorMode(),
                                 LE_COLOR_MODE_RGBA_8888,
@@ -135,19 +260,64 @@ static leResult _RGBBlendPixel(int32_t x,
     }
 
     if((rgbaSource & RGBA_8888_ALPHA_MASK) == 0)
-        return LE_SUCCESS;
+        return LE_FAILURE;
 
     resultClr = leColorBlend_RGBA_8888(rgbaSource, rgbaDest);
 
     // convert to destination format
-    clr = leColorConvert(LE_COLOR_MODE_RGBA_8888,
-                         leRenderer_CurrentColorMode(),
-                         resultClr);
+    *result = leColorConvert(LE_COLOR_MODE_RGBA_8888,
+                             leRenderer_CurrentColorMode(),
+                             resultClr);
+
+    return LE_SUCCESS;
+}
+
+static leResult _RGBBlendPixel(int32_t x,
+                               int32_t y,
+                               leColor clr,
+                               uint32_t a)
+{
+    uint32_t currentAlpha = 0xFF;
+
+    if(a == 0)
+        return LE_SUCCESS;
+
+    if(_alphaColorMode == LE_TRUE)
+    {
+        currentAlpha = leColorChannelAlpha(clr, _currentMode);
+    }
+
+    if(currentAlpha == 0)
+        return LE_SUCCESS;
+
+    if(a == 0xFF && currentAlpha == 0xFF)
+    {
+        return _RGBPutPixel(x, y, clr, 0);
+    }
+
+#if LE_RENDER_ORIENTATION != 0
+    leUtils_PointLogicalToScratch((int16_t*)&x, (int16_t*)&y);
+#endif
+
+    if(_currentMode == LE_COLOR_MODE_RGB_565)
+    {
+        uint16_t* dst = (uint16_t*)lePixelBufferOffsetGet_Unsafe(leGetRenderBuffer(), x, y);
+
+        *dst = (uint16_t)_scratchOrder(leColorBlend_RGB_565(clr, _scratchOrder(*dst), a));
+
+        return LE_SUCCESS;
+    }
+
+    if(_blendColor(clr,
+                   _scratchOrder(lePixelBufferGet_Unsafe(leGetRenderBuffer(), x, y)),
+                   a,
+                   &clr) == LE_FAILURE)
+        return LE_SUCCESS;
 
     lePixelBufferSet_Unsafe(leGetRenderBuffer(),
                             x,
                             y,
-                            clr);
+                            _scratchOrder(clr));
 
     return LE_SUCCESS;
 }
@@ -217,12 +387,74 @@ static leResult _RGBFill(int32_t x,
                           pnt.y,
                           width,
                           height,
-                          clr);
+                          _scratchOrder(clr));
 
     return LE_SUCCESS;
 }
 
 #if LE_ALPHA_BLENDING_ENABLED == 1
+#if LE_RENDER_ORIENTATION == 0
+// blends clr over a run of RGB565 scratch pixels two at a time.  a pixel pair
+// is split into one word with the red and blue of the first pixel and the
+// green of the second and one word with the rest, so that every field has
+// five spare bits above it for the multiply
+static void _blendSpan565(uint16_t* dst,
+                          uint32_t count,
+                          leColor clr,
+                          uint32_t a)
+{
+    uint32_t* pair;
+    uint32_t fx, fy;
+    uint32_t bx, by;
+    uint32_t w;
+
+    if(count > 0 && ((uintptr_t)dst & 0x2) != 0)
+    {
+        *dst = (uint16_t)_scratchOrder(leColorBlend_RGB_565(clr, _scratchOrder(*dst), a));
+
+        dst++;
+        count--;
+    }
+
+    a = (a + 4) >> 3;
+
+    w = clr | (clr << 16);
+
+    fx = w & 0x07E0F81F;
+    fy = (w >> 5) & 0x07C0F83F;
+
+    for(pair = (uint32_t*)dst; count >= 2; pair++, count -= 2)
+    {
+        w = *pair;
+
+#if LE_SCRATCH_BIG_ENDIAN == 1
+        w = ((w & 0x00FF00FF) << 8) | ((w >> 8) & 0x00FF00FF);
+#endif
+
+        bx = w & 0x07E0F81F;
+        by = (w >> 5) & 0x07C0F83F;
+
+        bx = (bx + (((fx - bx) * a) >> 5)) & 0x07E0F81F;
+        by = (by + (((fy - by) * a) >> 5)) & 0x07C0F83F;
+
+        w = bx | (by << 5);
+
+#if LE_SCRATCH_BIG_ENDIAN == 1
+        w = ((w & 0x00FF00FF) << 8) | ((w >> 8) & 0x00FF00FF);
+#endif
+
+        *pair = w;
+    }
+
+    if(count > 0)
+    {
+        dst = (uint16_t*)pair;
+
+        *dst = (uint16_t)_scratchOrder(leColorBlend_RGB_565(clr, _scratchOrder(*dst), a << 3));
+    }
+}
+#endif
+
 static leResult _RGBBlendFill(int32_t x,
                               int32_t y,
                               uint32_t width,
@@ -266,6 +498,31 @@ static leResult _RGBBlendFill(int32_t x,
     if(leGPU_FillRect(&fillRect, clr, a) == LE_SUCCESS)
         return LE_SUCCESS;
 
+#if LE_RENDER_ORIENTATION == 0
+    if(_currentMode == LE_COLOR_MODE_RGB_565)
+    {
+        fillRect.x = x;
+        fillRect.y = y;
+
+        leRenderer_ClipDrawRect(&fillRect, &fillRect);
+
+        if(fillRect.width <= 0 || fillRect.height <= 0)
+            return LE_SUCCESS;
+
+        for(h = 0; h < (uint32_t)fillRect.height; h++)
+        {
+            _blendSpan565((uint16_t*)lePixelBufferOffsetGet_Unsafe(leGetRenderBuffer(),
+                                                                   fillRect.x - frameRect.x,
+                                                                   fillRect.y - frameRect.y + h),
+                          fillRect.width,
+                          clr,
+                          a);
+        }
+
+        return LE_SUCCESS;
+    }
+#endif
+
     for(h = 0; h < height; h++)
     {
         for(w = 0; w < width; w++)
@@ -324,6 +581,300 @@ static leResult _MonoFill(int32_t x,
     return LE_SUCCESS;
 }
 
+#if LE_INDEXED_SCRATCH == 1
+static leResult _IndexPutPixel(int32_t x,
+                               int32_t y,
+                               leColor clr,
+                               uint32_t a)
+{
+    (void)a; // unused
+
+#if LE_RENDER_ORIENTATION != 0
+    leUtils_PointLogicalToScratch((int16_t*)&x, (int16_t*)&y);
+#endif
+
+    _indexSet(leGetRenderBuffer(), x, y, _indexNearest(clr));
+
+    return LE_SUCCESS;
+}
+
+#if LE_ALPHA_BLENDING_ENABLED == 1
+static leResult _IndexBlendPixel(int32_t x,
+                                 int32_t y,
+                                 leColor clr,
+                                 uint32_t a)
+{
+    uint32_t currentAlpha = 0xFF;
+
+    if(a == 0)
+        return LE_SUCCESS;
+
+    if(_alphaColorMode == LE_TRUE)
+    {
+        currentAlpha = leColorChannelAlpha(clr, _currentMode);
+    }
+
+    if(currentAlpha == 0)
+        return LE_SUCCESS;
+
+    if(a == 0xFF && currentAlpha == 0xFF)
+    {
+        return _IndexPutPixel(x, y, clr, 0);
+    }
+
+#if LE_RENDER_ORIENTATION != 0
+    leUtils_PointLogicalToScratch((int16_t*)&x, (int16_t*)&y);
+#endif
+
+    // blend against the palette color and match the result again
+    if(_blendColor(clr,
+                   _indexColor(_indexGet(leGetRenderBuffer(), x, y)),
+                   a,
+                   &clr) == LE_FAILURE)
+        return LE_SUCCESS;
+
+    _indexSet(leGetRenderBuffer(), x, y, _indexNearest(clr));
+
+    return LE_SUCCESS;
+}
+#endif
+
+static leResult _IndexFill(int32_t x,
+                           int32_t y,
+                           uint32_t width,
+                           uint32_t height,
+                           leColor clr,
+                           uint32_t a)
+{
+    lePixelBuffer* buf = leGetRenderBuffer();
+    leRect fillRect, bufRect, frameRect;
+    int32_t row, col;
+    uint32_t idx;
+    (void)a; // unused
+
+    // adjust for rectangle position
+    leRenderer_GetFrameRect(&frameRect);
+
+    fillRect.x = x - frameRect.x;
+    fillRect.y = y - frameRect.y;
+    fillRect.width = width;
+    fillRect.height = height;
+
+#if LE_RENDER_ORIENTATION != 0
+    leUtils_RectLogicalToScratch(&fillRect);
+#endif
+
+    bufRect.x = 0;
+    bufRect.y = 0;
+    bufRect.width = buf->size.width;
+    bufRect.height = buf->size.height;
+
+    if(leRectIntersects(&bufRect, &fillRect) == LE_FALSE)
+        return LE_SUCCESS;
+
+    leRectClip(&bufRect, &fillRect, &fillRect);
+
+    idx = _indexNearest(clr);
+
+    for(row = 0; row < fillRect.height; row++)
+    {
+        for(col = 0; col < fillRect.width; col++)
+        {
+            _indexSet(buf, fillRect.x + col, fillRect.y + row, idx);
+        }
+    }
+
+    return LE_SUCCESS;
+}
+
+#if LE_ALPHA_BLENDING_ENABLED == 1
+static leResult _IndexBlendFill(int32_t x,
+                                int32_t y,
+                                uint32_t width,
+                                uint32_t height,
+                                leColor clr,
+                                uint32_t a)
+{
+    uint32_t w, h;
+    uint32_t alphaChannel = 0xFF;
+
+    if(a == 0)
+        return LE_SUCCESS;
+
+    if(_alphaColorMode == LE_TRUE)
+    {
+        alphaChannel = leColorChannelAlpha(clr, _currentMode);
+    }
+
+    if(alphaChannel == 0)
+        return LE_SUCCESS;
+
+    if(a == 0xFF && alphaChannel == 0xFF)
+    {
+        return _IndexFill(x, y, width, height, clr, 0);
+    }
+
+    for(h = 0; h < height; h++)
+    {
+        for(w = 0; w < width; w++)
+        {
+            // blend pixel will adjust for the rectangle
+            leRenderer_BlendPixel_Safe(x + w,
+                                       y + h,
+                                       clr,
+                                       a);
+        }
+    }
+
+    return LE_SUCCESS;
+}
+#endif
+#endif
+
+// writes clr where the bits of a mask row are set, one pixel at a time
+static leResult _maskRowPixels(int32_t x,
+                               int32_t y,
+                               const uint8_t* mask,
+                               int32_t colStart,
+                               int32_t colEnd,
+                               leColor clr)
+{
+    int32_t col;
+
+    for(col = colStart; col < colEnd; col++)
+    {
+        if((mask[col >> 3] & (0x80 >> (col & 0x7))) != 0)
+        {
+            _drawFunction.putPixel(x + col, y, clr, 0);
+        }
+    }
+
+    return LE_SUCCESS;
+}
+
+// writes clr where the bits of a mask row are set straight into the scratch
+// buffer, a mask byte at a time.  empty bytes are skipped and full bytes
+// become a run of eight pixels
+static leResult _RGBMaskRow(int32_t x,
+                            int32_t y,
+                            const uint8_t* mask,
+                            int32_t colStart,
+                            int32_t colEnd,
+                            leColor clr)
+{
+#if LE_RENDER_ORIENTATION != 0
+    return _maskRowPixels(x, y, mask, colStart, colEnd, clr);
+#else
+    const lePixelBuffer* buf = leGetRenderBuffer();
+    uint32_t size = leColorInfoTable[_currentMode].size;
+    uint32_t bits;
+    int32_t col;
+    int32_t idx;
+    int32_t i;
+
+    // packed index pixels and unaligned three byte pixels are left to the
+    // pixel buffer
+    if(leColorInfoTable[_currentMode].bpp < 8 || size == 3)
+        return _maskRowPixels(x, y, mask, colStart, colEnd, clr);
+
+    clr = _scratchOrder(clr);
+
+    for(col = colStart & ~0x7; col < colEnd; col += 8)
+    {
+        bits = mask[col >> 3];
+
+        if(col < colStart)
+        {
+            bits &= 0xFF >> (colStart - col);
+        }
+
+        if(col + 8 > colEnd)
+        {
+            bits &= 0xFF << (col + 8 - colEnd);
+        }
+
+        if(bits == 0)
+            continue;
+
+        // buffer index of the first pixel of this mask byte, only pixels
+        // of set bits are written so it is never used below zero
+        idx = x + col + y * buf->size.width;
+
+        switch(size)
+        {
+            case 2:
+            {
+                uint16_t* dst = (uint16_t*)buf->pixels;
+
+                if(bits == 0xFF)
+                {
+                    for(i = 0; i < 8; i++)
+                    {
+                        dst[idx + i] = (uint16_t)clr;
+                    }
+                }
+                else
+                {
+                    for(i = 0; bits != 0; i++, bits = (bits << 1) & 0xFF)
+                    {
+                        if((bits & 0x80) != 0)
+                        {
+                            dst[idx + i] = (uint16_t)clr;
+                        }
+                    }
+                }
+
+                break;
+            }
+            case 4:
+            {
+                uint32_t* dst = (uint32_t*)buf->pixels;
+
+                for(i = 0; bits != 0; i++, bits = (bits << 1) & 0xFF)
+                {
+                    if((bits & 0x80) != 0)
+                    {
+                        dst[idx + i] = clr;
+                    }
+                }
+
+                break;
+            }
+            default:
+            {
+                uint8_t* dst = (uint8_t*)buf->pixels;
+
+                for(i = 0; bits != 0; i++, bits = (bits << 1) & 0xFF)
+                {
+                    if((bits & 0x80) != 0)
+                    {
+                        dst[idx + i] = (uint8_t)clr;
+                    }
+                }
+
+                break;
+            }
+        }
+    }
+
+    return LE_SUCCESS;
+#endif
+}
+
+// reads a scratch buffer pixel in the current color mode
+static leColor _scratchGet(int32_t x,
+                           int32_t y)
+{
+#if LE_INDEXED_SCRATCH == 1
+    if(_indexed.palette != NULL)
+        return _indexColor(_indexGet(leGetRenderBuffer(), x, y));
+#endif
+
+    return _scratchOrder(lePixelBufferGet_Unsafe(leGetRenderBuffer(),
+                                                 x,
+                                                 y));
+}
+
 leColor leRenderer_GetPixel(int32_t x,
                             int32_t y)
 {
@@ -339,9 +890,7 @@ leColor leRenderer_GetPixel(int32_t x,
     leUtils_PointLogicalToScratch((int16_t*)&x, (int16_t*)&y);
 #endif
 
-    return lePixelBufferGet_Unsafe(leGetRenderBuffer(),
-                                   x,
-                                   y);
+    return _scratchGet(x, y);
 }
 
 leResult leRenderer_GetPixel_Safe(int32_t x,
@@ -363,9 +912,7 @@ leResult leRenderer_GetPixel_Safe(int32_t x,
     leUtils_PointLogicalToScratch((int16_t*)&x, (int16_t*)&y);
 #endif
 
-    *clr = lePixelBufferGet_Unsafe(leGetRenderBuffer(),
-                                   x,
-                                   y);
+    *clr = _scratchGet(x, y);
 
     return LE_SUCCESS;
 }
@@ -404,6 +951,24 @@ leResult leRenderer_PutPixel_Safe(int32_t x,
     return _drawFunction.putPixel(x, y, clr, 0);
 }
 
+leResult leRenderer_PutMaskRow(int32_t x,
+                               int32_t y,
+                               const uint8_t* mask,
+                               int32_t colStart,
+                               int32_t colEnd,
+                               leColor clr)
+{
+    leRect frameRect;
+
+    // adjust for rectangle position
+    leRenderer_GetFrameRect(&frameRect);
+
+    x -= frameRect.x;
+    y -= frameRect.y;
+
+    return _drawFunction.maskRow(x, y, mask, colStart, colEnd, clr);
+}
+
 leResult leRenderer_BlendPixel(int32_t x,
                                int32_t y,
                                leColor clr,
@@ -453,6 +1018,10 @@ void _leRenderer_InitDrawForMode(leColorMode mode)
 {
     _currentMode = mode;
 
+#if LE_INDEXED_SCRATCH == 1
+    _indexed.palette = NULL;
+#endif
+
     switch(mode)
     {
         case LE_COLOR_MODE_GS_8:
@@ -471,6 +1040,7 @@ void _leRenderer_InitDrawForMode(leColorMode mode)
             _drawFunction.blendPixel = _RGBBlendPixel;
             _drawFunction.fill = _RGBFill;
             _drawFunction.blendFill = _RGBBlendFill;
+            _drawFunction.maskRow = _RGBMaskRow;
 
             _alphaColorMode = LE_COLOR_MODE_IS_ALPHA(mode);
 #else
@@ -478,6 +1048,7 @@ void _leRenderer_InitDrawForMode(leColorMode mode)
             _drawFunction.blendPixel = _RGBPutPixel;
             _drawFunction.fill = _RGBFill;
             _drawFunction.blendFill = _RGBFill;
+            _drawFunction.maskRow = _RGBMaskRow;
 #endif
 
             break;
@@ -488,6 +1059,7 @@ void _leRenderer_InitDrawForMode(leColorMode mode)
             _drawFunction.blendPixel = _MonoPutPixel;
             _drawFunction.fill = _MonoFill;
             _drawFunction.blendFill = _MonoFill;
+            _drawFunction.maskRow = _maskRowPixels;
 
             break;
         }
@@ -496,4 +1068,35 @@ void _leRenderer_InitDrawForMode(leColorMode mode)
     }
 }
 
+#if LE_INDEXED_SCRATCH == 1
+// switches to drawing into indexed scratch buffers, colors passed to the
+// draw functions stay in the mode set by _leRenderer_InitDrawForMode
+void _leRenderer_InitDrawForIndexed(const lePalette* pal, leColorMode mode)
+{
+    uint32_t i;
+
+    _indexed.palette = (lePalette*)pal;
+    _indexed.bpp = leColorInfoTable[mode].bpp;
+
+    for(i = 0; i < INDEX_CACHE_SIZE; i++)
+    {
+        _indexed.cacheIndex[i] = -1;
+    }
+
+#if LE_ALPHA_BLENDING_ENABLED == 1
+    _drawFunction.putPixel = _IndexPutPixel;
+    _drawFunction.blendPixel = _IndexBlendPixel;
+    _drawFunction.fill = _IndexFill;
+    _drawFunction.blendFill = _IndexBlendFill;
+    _drawFunction.maskRow = _maskRowPixels;
+#else
+    _drawFunction.putPixel = _IndexPutPixel;
+    _drawFunction.blendPixel = _IndexPutPixel;
+    _drawFunction.fill = _IndexFill;
+    _drawFunction.blendFill = _IndexFill;
+    _drawFunction.maskRow = _maskRowPixels;
+#endif
+}
+#endif
+
 #endif // LE_DEBUG_RENDERER
@@ -60,7 +60,7 @@ leResult leGPU_DrawLine(int32_t x0,
     buf.size.height = leBuf->size.height;
     buf.mode = _convertColorMode(leBuf->mode);
     buf.buffer_length = leBuf->buffer_length;
-    buf.flags = 0;
+    buf.flags = LE_SCRATCH_BUFFER_FLAGS;
     buf.pixels = (gfxBuffer)leBuf->pixels;
     buf.orientation = GFX_ORIENT_0;
 
@@ -146,7 +146,7 @@ leResult leGPU_ClearBuffer(lePixelBuffer* leBuf)
     buf.size.height = leBuf->size.height;
     buf.mode = _convertColorMode(leBuf->mode);
     buf.buffer_length = leBuf->buffer_length;
-    buf.flags = 0;
+    buf.flags = LE_SCRATCH_BUFFER_FLAGS;
     buf.pixels = (gfxBuffer)leBuf->pixels;
     buf.orientation = GFX_ORIENT_0;
 
@@ -184,7 +184,7 @@ leResult leGPU_FillRect(const leRect* rect,
     buf.size.height = leBuf->size.height;
     buf.mode = _convertColorMode(leBuf->mode);
     buf.buffer_length = leBuf->buffer_length;
-    buf.flags = 0;
+    buf.flags = LE_SCRATCH_BUFFER_FLAGS;
     buf.pixels = (gfxBuffer)leBuf->pixels;
     buf.orientation = GFX_ORIENT_0;
 
@@ -280,7 +280,7 @@ leResult leGPU_BlitBuffer(const lePixelBuffer* sourceBuffer,
     destBuf.size.height = leBuf->size.height;
     destBuf.mode = _convertColorMode(leBuf->mode);
     destBuf.buffer_length = leBuf->buffer_length;
-    destBuf.flags = 0;
+    destBuf.flags = LE_SCRATCH_BUFFER_FLAGS;
     destBuf.pixels = (gfxBuffer)leBuf->pixels;
     destBuf.orientation = GPU_ORIENTATION;
 
@@ -362,7 +362,7 @@ leResult leGPU_BlitStretchBuffer(const lePixelBuffer* sourceBuffer,
     destBuf.size.height = leBuf->size.height;
     destBuf.mode = _convertColorMode(leBuf->mode);
     destBuf.buffer_length = leBuf->buffer_length;
-    destBuf.flags = 0;
+    destBuf.flags = LE_SCRATCH_BUFFER_FLAGS;
     destBuf.pixels = (gfxBuffer)leBuf->pixels;
     destBuf.orientation = GPU_ORIENTATION;
 
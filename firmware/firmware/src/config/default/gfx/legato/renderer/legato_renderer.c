@@ -94,6 +94,17 @@ typedef struct leRenderState
     uint32_t frameRectIdx;       // the current frame draw rectangle index
     leWidget* currentWidget;     // the widget that is currently drawing
 
+    leArray paintList;           // widgets invalidated for the current frame
+                                 // rectangle, in paint order
+    uint32_t paintIdx;           // the next paint list entry to look at
+    leBool paintListValid;       // LE_FALSE if the list ran out of memory
+
+#if LE_RENDERER_OCCLUSION == 1
+    leRectArray paintRects;      // part of each paint list widget not covered
+                                 // by opaque widgets above it, empty if the
+                                 // list couldn't be culled
+#endif
+
     leRect drawRect;              // the current damage rectangle clipped
                                   // to the currently rendering widget
 
@@ -119,6 +130,19 @@ typedef struct leRenderState
 
     int32_t currentScratchBuffer; // the index of the current scratch buffer
 
+    uint32_t scratchSize;         // usable scratch buffer size in bytes
+    leScratchSplit scratchSplit;  // damage rectangle split strategy
+
+#if LE_INDEXED_SCRATCH == 1
+    const lePalette* scratchPalette;   // palette of indexed scratch buffers
+    const lePalette* pendingPalette;   // palette to switch to once idle
+    volatile leBool palettePending;    // a palette switch was requested
+#endif
+
+    leRendererWakeCallback wakeCallback; // signals that a frame is pending
+
+    int32_t scrollRows;           // display scroll applied by the next frame
+
     gfxIOCTLArg_Value val;
 } leRenderState;
 
@@ -137,8 +161,13 @@ leRenderState _rendererState;
 #endif
 
 void _leRenderer_InitDrawForMode(leColorMode mode);
+#if LE_INDEXED_SCRATCH == 1
+void _leRenderer_InitDrawForIndexed(const lePalette* pal, leColorMode mode);
+#endif
 
-static uint8_t LE_COHERENT_ATTR LE_NO_CACHE_ATTR __ALIGNED(64) _dataBuffers[SCRATCH_BUFFER_SZ];
+// one backing store per scratch buffer so a buffer can be rendered while
+// another one is still owned (locked) by the display driver
+static uint8_t LE_COHERENT_ATTR LE_NO_CACHE_ATTR __ALIGNED(64) _dataBuffers[LE_SCRATCH_BUFFER_COUNT][SCRATCH_BUFFER_SZ];
 
 
 struct leScratchBuffer
@@ -151,6 +180,24 @@ static uint32_t maxScratchPixels;
 
 static LE_COHERENT_ATTR struct leScratchBuffer _scratchBuffers[LE_SCRATCH_BUFFER_COUNT];
 
+#if LE_RENDERER_DAMAGE_STATS == 1
+static leDamageStats _damageStats;
+static uint32_t _frameDamagePixels;
+static uint32_t _framePaintPixels;
+#endif
+
+#if LE_RENDERER_OCCLUSION == 1
+#define OCCLUSION_COVER_COUNT   8 // opaque rectangles tracked per frame rect
+#define OCCLUSION_PIECE_COUNT   8 // pieces a covered rectangle is cut into
+#endif
+
+#if LE_RENDERER_PROFILE == 1
+static leProfileClock _profileClock;
+static leProfileStats _profileStats[LE_PROFILE_BUCKET_COUNT];
+static uint32_t _profileFrameStart;
+static uint32_t _profileDamageStart;
+#endif
+
 static leEvent paintEvt = { LE_WIDGET_EVENT_PAINT };
 
 static gfxColorMode _convertColorMode(leColorMode mode)
@@ -175,6 +222,12 @@ static gfxColorMode _convertColorMode(leColorMode mode)
 
 leBool leRenderer_IsIdle(void)
 {
+#if LE_INDEXED_SCRATCH == 1
+    // a palette switch waits for the driver to finish its last blit
+    if(_rendererState.palettePending == LE_TRUE)
+        return LE_FALSE;
+#endif
+
     return _rendererState.frameState == LE_FRAME_READY;
 }
 
@@ -183,6 +236,290 @@ size_t leRenderer_GetDrawCount(void)
     return _rendererState.drawCount;
 }
 
+leResult leRenderer_SetScratchPolicy(uint32_t size, leScratchSplit split)
+{
+    if(size > SCRATCH_BUFFER_SZ)
+        return LE_FAILURE;
+
+    if(size == 0)
+    {
+        size = SCRATCH_BUFFER_SZ;
+    }
+
+    _rendererState.scratchSize = size;
+    _rendererState.scratchSplit = split;
+
+    return LE_SUCCESS;
+}
+
+leResult leRenderer_SetScratchPalette(const lePalette* pal)
+{
+#if LE_INDEXED_SCRATCH == 1
+    if(pal != NULL &&
+       (pal->header.location != LE_STREAM_LOCATION_ID_INTERNAL ||
+        pal->colorCount < 2 ||
+        pal->colorCount > 256))
+        return LE_FAILURE;
+
+    _rendererState.pendingPalette = pal;
+    _rendererState.palettePending = LE_TRUE;
+
+    _leRenderer_Wake();
+
+    return LE_SUCCESS;
+#else
+    (void)pal;
+
+    return LE_FAILURE;
+#endif
+}
+
+// the color mode pixels are stored in in the scratch buffers
+static leColorMode scratchColorMode(void)
+{
+#if LE_INDEXED_SCRATCH == 1
+    if(_rendererState.scratchPalette != NULL)
+    {
+        if(_rendererState.scratchPalette->colorCount <= 2)
+            return LE_COLOR_MODE_INDEX_1;
+
+        if(_rendererState.scratchPalette->colorCount <= 16)
+            return LE_COLOR_MODE_INDEX_4;
+
+        return LE_COLOR_MODE_INDEX_8;
+    }
+#endif
+
+    return leGetLayerColorMode(_rendererState.layerIdx);
+}
+
+#if LE_INDEXED_SCRATCH == 1
+// switches to the requested scratch palette, only while no frame is in
+// progress since the driver expands buffers it is still sending with it
+static void applyScratchPalette(void)
+{
+    const lePalette* pal = _rendererState.pendingPalette;
+    gfxIOCTLArg_Palette arg;
+    gfxDriverIOCTLResponse res;
+    uint32_t i;
+
+    if(pal != NULL)
+    {
+        arg.palette = pal->header.address;
+        arg.mode = (int)pal->colorMode;
+        arg.colorCount = pal->colorCount;
+
+        res = _rendererState.dispDriver->ioctl(GFX_IOCTL_SET_PALETTE, &arg);
+
+        // the driver is still sending the last blit, try again next time
+        if(res >= GFX_IOCTL_ERROR_UNKNOWN)
+            return;
+
+        // the driver can't expand indexed buffers
+        if(res == GFX_IOCTL_UNSUPPORTED)
+        {
+            pal = NULL;
+        }
+    }
+
+    _rendererState.palettePending = LE_FALSE;
+
+    if(pal == _rendererState.scratchPalette)
+        return;
+
+    _rendererState.scratchPalette = pal;
+
+    // colors are matched differently now, repaint everything
+    for(i = 0; i < _state->layerList.size; i++)
+    {
+        leRenderer_DamageArea(&leGetLayerState(i)->root.rect, i);
+    }
+}
+#endif
+
+leResult leRenderer_GetDamageStats(leDamageStats* stats)
+{
+#if LE_RENDERER_DAMAGE_STATS == 1
+    if(stats == NULL)
+        return LE_FAILURE;
+
+    *stats = _damageStats;
+
+    return LE_SUCCESS;
+#else
+    (void)stats;
+
+    return LE_FAILURE;
+#endif
+}
+
+void leRenderer_ResetDamageStats(void)
+{
+#if LE_RENDERER_DAMAGE_STATS == 1
+    uint32_t i;
+
+    memset(&_damageStats, 0, sizeof(leDamageStats));
+
+    for(i = 0; i < LE_DAMAGE_CANDIDATE_COUNT; i++)
+    {
+        _damageStats.candidateSize[i] = 512u << i;
+    }
+#endif
+}
+
+void leRenderer_SetWakeCallback(leRendererWakeCallback cb)
+{
+    _rendererState.wakeCallback = cb;
+}
+
+void _leRenderer_Wake(void)
+{
+    if(_rendererState.wakeCallback != NULL)
+    {
+        _rendererState.wakeCallback();
+    }
+}
+
+void leRenderer_SetProfileClock(leProfileClock clock)
+{
+#if LE_RENDERER_PROFILE == 1
+    _profileClock = clock;
+#else
+    (void)clock;
+#endif
+}
+
+leResult leRenderer_GetProfileStats(leProfileBucket bucket,
+                                    leProfileStats* stats)
+{
+#if LE_RENDERER_PROFILE == 1
+    if(bucket >= LE_PROFILE_BUCKET_COUNT || stats == NULL)
+        return LE_FAILURE;
+
+    *stats = _profileStats[bucket];
+
+    return LE_SUCCESS;
+#else
+    (void)bucket;
+    (void)stats;
+
+    return LE_FAILURE;
+#endif
+}
+
+uint32_t leRenderer_ProfilePercentile(const leProfileStats* stats,
+                                      uint32_t pct)
+{
+    uint32_t sorted[LE_PROFILE_RING_SIZE];
+    uint32_t size, rank;
+    uint32_t i, j, val;
+
+    if(stats == NULL || stats->count == 0)
+        return 0;
+
+    size = stats->count < LE_PROFILE_RING_SIZE ? stats->count : LE_PROFILE_RING_SIZE;
+
+    // insertion sort, the ring is small
+    for(i = 0; i < size; i++)
+    {
+        val = stats->samples[i];
+
+        for(j = i; j > 0 && sorted[j - 1] > val; j--)
+        {
+            sorted[j] = sorted[j - 1];
+        }
+
+        sorted[j] = val;
+    }
+
+    if(pct > 100)
+    {
+        pct = 100;
+    }
+
+    // nearest rank
+    rank = (size * pct + 99) / 100;
+
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+void leRenderer_ResetProfileStats(void)
+{
+#if LE_RENDERER_PROFILE == 1
+    memset(_profileStats, 0, sizeof(_profileStats));
+#endif
+}
+
+#if LE_RENDERER_PROFILE == 1
+static uint32_t profileStart(void)
+{
+    return _profileClock != NULL ? _profileClock() : 0;
+}
+
+static void profileRecord(uint32_t bucket, uint32_t start)
+{
+    leProfileStats* stats;
+    uint32_t ticks;
+
+    if(_profileClock == NULL)
+        return;
+
+    ticks = _profileClock() - start;
+
+    stats = &_profileStats[bucket];
+
+    if(stats->count == 0 || ticks < stats->min)
+    {
+        stats->min = ticks;
+    }
+
+    if(ticks > stats->max)
+    {
+        stats->max = ticks;
+    }
+
+    stats->count++;
+    stats->total += ticks;
+
+    stats->samples[stats->next] = ticks;
+    stats->next = (stats->next + 1) % LE_PROFILE_RING_SIZE;
+}
+#endif
+
+#if LE_RENDERER_DAMAGE_STATS == 1
+static void recordDamageRects(const leRectArray* arr, uint32_t pixelSize)
+{
+    uint32_t i, j;
+    uint32_t area;
+    uint32_t candidatePixels;
+
+    for(i = 0; i < arr->size; i++)
+    {
+        area = (uint32_t)arr->rects[i].width * (uint32_t)arr->rects[i].height;
+
+        _damageStats.damageRectCount++;
+        _damageStats.pixelCount += area;
+
+        _frameDamagePixels += area;
+
+        for(j = 0; j < LE_DAMAGE_HISTOGRAM_SIZE - 1; j++)
+        {
+            if(area <= (64u << j))
+                break;
+        }
+
+        _damageStats.histogram[j]++;
+
+        for(j = 0; j < LE_DAMAGE_CANDIDATE_COUNT; j++)
+        {
+            candidatePixels = _damageStats.candidateSize[j] / pixelSize;
+
+            _damageStats.candidateBlitCount[j] += (area + candidatePixels - 1) / candidatePixels;
+        }
+    }
+}
+#endif
+
 lePixelBuffer* leGetRenderBuffer(void)
 {
     if(_rendererState.currentScratchBuffer == -1)
@@ -193,6 +530,12 @@ lePixelBuffer* leGetRenderBuffer(void)
 
 leColorMode leRenderer_CurrentColorMode()
 {
+#if LE_INDEXED_SCRATCH == 1
+    // indexed scratch buffers are drawn to with colors of the layer
+    if(_rendererState.scratchPalette != NULL)
+        return leGetLayerColorMode(_rendererState.layerIdx);
+#endif
+
     return _scratchBuffers[_rendererState.currentScratchBuffer].renderBuffer.mode;
 }
 
@@ -289,12 +632,33 @@ leResult leRenderer_Initialize(const gfxDisplayDriver* dispDriver,
 
     _rendererState.bufferCount = val.value.v_uint;
     _rendererState.frameState = LE_FRAME_READY;
+
+    _rendererState.scratchSize = SCRATCH_BUFFER_SZ;
+    _rendererState.scratchSplit = LE_SCRATCH_SPLIT_DEFAULT;
+
+    leArray_Create(&_rendererState.paintList);
+
+#if LE_RENDERER_OCCLUSION == 1
+    leRectArray_Create(&_rendererState.paintRects);
+#endif
+
+#if LE_INDEXED_SCRATCH == 1
+    _rendererState.scratchPalette = NULL;
+    _rendererState.palettePending = LE_FALSE;
+#endif
+
+    leRenderer_ResetDamageStats();
     
     return LE_SUCCESS;
 }
 
 void leRenderer_Shutdown()
 {
+    leArray_Clear(&_rendererState.paintList);
+
+#if LE_RENDERER_OCCLUSION == 1
+    leRectArray_Destroy(&_rendererState.paintRects);
+#endif
 }
 
 const gfxDisplayDriver* leRenderer_DisplayInterface(void)
@@ -307,6 +671,11 @@ const gfxGraphicsProcessor* leRenderer_GPUInterface(void)
     return _rendererState.gpuDriver;
 }
 
+void leRenderer_SetGPUInterface(const gfxGraphicsProcessor* gpuDriver)
+{
+    _rendererState.gpuDriver = gpuDriver;
+}
+
 static void addDamageRectToList(leRectArray* arr, const leRect* rect)
 {
     uint32_t i;
@@ -405,7 +774,16 @@ leResult leRenderer_DamageArea(const leRect* rect,
     // initiate a new render frame if necessary
     if(_rendererState.frameState <= LE_FRAME_PREFRAME)
     {
-        _rendererState.frameState = LE_FRAME_PREFRAME;
+        if(_rendererState.frameState == LE_FRAME_READY)
+        {
+#if LE_RENDERER_PROFILE == 1
+            _profileDamageStart = profileStart();
+#endif
+
+            _rendererState.frameState = LE_FRAME_PREFRAME;
+
+            _leRenderer_Wake();
+        }
 
         // drawing not in progress, add the rectangle to the current list
         addDamageRectToList(&renderLayerState->currentDamageRects, &clipRect);
@@ -422,10 +800,83 @@ leResult leRenderer_DamageArea(const leRect* rect,
     return LE_SUCCESS;
 }
 
+leResult leRenderer_ScrollDisplay(int32_t rows)
+{
+    if(_state->layerList.size == 0)
+        return LE_FAILURE;
+
+    _rendererState.scrollRows += rows;
+
+    // the scroll needs a frame to happen in
+    if(_rendererState.frameState == LE_FRAME_READY)
+    {
+#if LE_RENDERER_PROFILE == 1
+        _profileDamageStart = profileStart();
+#endif
+
+        _rendererState.frameState = LE_FRAME_PREFRAME;
+
+        _leRenderer_Wake();
+    }
+
+    return LE_SUCCESS;
+}
+
+// hands the requested scroll to the driver before the first blit of the
+// frame and damages the rows it brings into view
+static void applyScroll(void)
+{
+    gfxIOCTLArg_Value arg;
+    leSize disp;
+    leRect band;
+    int32_t rows = _rendererState.scrollRows;
+    uint32_t i;
+
+    _rendererState.scrollRows = 0;
+
+    if(rows == 0)
+        return;
+
+    leRenderer_DisplaySize(&disp);
+
+    band.x = 0;
+    band.y = 0;
+    band.width = disp.width;
+    band.height = disp.height;
+
+    arg.value.v_int = rows;
+
+    if(_rendererState.dispDriver->ioctl(GFX_IOCTL_SET_VERTICAL_SCROLL, &arg) == GFX_IOCTL_OK)
+    {
+        if(rows > 0 && rows < disp.height)
+        {
+            band.y = disp.height - rows;
+            band.height = rows;
+        }
+        else if(rows < 0 && -rows < disp.height)
+        {
+            band.height = -rows;
+        }
+    }
+
+    for(i = 0; i < _state->layerList.size; i++)
+    {
+        leRenderer_DamageArea(&band, i);
+    }
+}
+
 static leResult preFrame(void)
 {
     _rendererState.layerIdx = 0;
 
+    // still in LE_FRAME_PREFRAME, the exposed rows join this frame
+    applyScroll();
+
+#if LE_RENDERER_DAMAGE_STATS == 1
+    _frameDamagePixels = 0;
+    _framePaintPixels = 0;
+#endif
+
     /*if(_rendererState.renderBuffer != NULL)
     {
         _rendererState.renderBuffer->mode = -1;
@@ -453,7 +904,7 @@ static void preLayer(void)
     leRectArray_Clear(&_rendererState.currentRenderLayer->scratchRectList);
     leRectArray_Clear(&_rendererState.currentRenderLayer->frameRectList);
 
-    maxScratchPixels = SCRATCH_BUFFER_SZ / leColorInfoTable[leGetLayerColorMode(_rendererState.layerIdx)].size;
+    maxScratchPixels = (_rendererState.scratchSize * 8) / leColorInfoTable[scratchColorMode()].bpp;
 
     // merge rectangle lists
     if(_rendererState.bufferCount > 1)
@@ -478,17 +929,30 @@ static void preLayer(void)
         return;
     }
 
-    // remove duplicate rectangles from combined list
-    leRectArray_RemoveDuplicates(&_rendererState.currentRenderLayer->scratchRectList);
+    // replace the combined list with non-overlapping bands of its union
+    if(leRectArray_Union(&_rendererState.currentRenderLayer->scratchRectList) == LE_FAILURE)
+    {
+        // remove duplicate rectangles from combined list
+        leRectArray_RemoveDuplicates(&_rendererState.currentRenderLayer->scratchRectList);
+
+        // combine any adjacent rectangles
+        leRectArray_MergeSimilar(&_rendererState.currentRenderLayer->scratchRectList);
 
-    // combine any adjacent rectangles
-    leRectArray_MergeSimilar(&_rendererState.currentRenderLayer->scratchRectList);
+        // remove overlapping space
+        leRectArray_RemoveOverlapping(&_rendererState.currentRenderLayer->scratchRectList);
+    }
 
-    // remove overlapping space
-    leRectArray_RemoveOverlapping(&_rendererState.currentRenderLayer->scratchRectList);
+#if LE_RENDERER_DAMAGE_STATS == 1
+    recordDamageRects(&_rendererState.currentRenderLayer->scratchRectList,
+                      leColorInfoTable[leGetLayerColorMode(_rendererState.layerIdx)].size);
+#endif
 
     // crop to scratch buffer size limit
-    if(leGetLayerRenderHorizontal(_rendererState.layerIdx) == LE_TRUE)
+    if(_rendererState.scratchSplit == LE_SCRATCH_SPLIT_BANDS)
+    {
+        leRectArray_CropToSizeBands(&_rendererState.currentRenderLayer->scratchRectList, maxScratchPixels);
+    }
+    else if(leGetLayerRenderHorizontal(_rendererState.layerIdx) == LE_TRUE)
     {
         // sort frame rects by X
         leRectArray_CropToSizeX(&_rendererState.currentRenderLayer->scratchRectList, maxScratchPixels);
@@ -539,6 +1003,10 @@ static void preLayer(void)
     _rendererState.frameRectIdx = 0;
     _rendererState.frameDrawCount = 0;
 
+#if LE_RENDERER_DAMAGE_STATS == 1
+    _damageStats.blitCount += _rendererState.currentRenderLayer->frameRectList.size;
+#endif
+
     if(_rendererState.currentRenderLayer->frameRectList.size == 0)
     {
         _rendererState.frameState = LE_FRAME_POSTLAYER;
@@ -547,6 +1015,14 @@ static void preLayer(void)
     {
         _leRenderer_InitDrawForMode(leGetLayerColorMode(_rendererState.layerIdx));
 
+#if LE_INDEXED_SCRATCH == 1
+        if(_rendererState.scratchPalette != NULL)
+        {
+            _leRenderer_InitDrawForIndexed(_rendererState.scratchPalette,
+                                           scratchColorMode());
+        }
+#endif
+
         _rendererState.frameState = LE_FRAME_PRERECT;
     }
 }
@@ -569,6 +1045,14 @@ static void invalidateWidget(leWidget* wgt, leRect* rect)
     if(leRectIntersects(&localRect, rect) == LE_TRUE)
     {
         wgt->fn->_setDirtyState(wgt, LE_WIDGET_DIRTY_STATE_DIRTY);
+
+        // parents are added before their children, the order they paint in.
+        // the layer root itself is never painted
+        if(wgt != &_rendererState.currentLayerState->root &&
+           leArray_PushBack(&_rendererState.paintList, wgt) == LE_FAILURE)
+        {
+            _rendererState.paintListValid = LE_FALSE;
+        }
         
         for(idx = 0; idx < wgt->children.size; idx++)
         {
@@ -586,6 +1070,137 @@ static void invalidateWidget(leWidget* wgt, leRect* rect)
     }
 }
 
+#if LE_RENDERER_OCCLUSION == 1
+// cuts the covers out of rect and shrinks rect to the bounds of what is left,
+// LE_FALSE if nothing is left.  a piece that would need more room than there
+// is stays whole, which costs pixels but never leaves a hole
+static leBool subtractCovers(leRect* rect,
+                             const leRect* covers,
+                             uint32_t coverCount)
+{
+    leRect pieces[OCCLUSION_PIECE_COUNT];
+    leRect split[4];
+    uint32_t pieceCount = 1;
+    uint32_t splitCount;
+    uint32_t i, j, k;
+
+    pieces[0] = *rect;
+
+    for(i = 0; i < coverCount && pieceCount > 0; i++)
+    {
+        j = 0;
+
+        while(j < pieceCount)
+        {
+            if(leRectIntersects(&pieces[j], &covers[i]) == LE_FALSE)
+            {
+                j++;
+
+                continue;
+            }
+
+            splitCount = leRectSplit(&pieces[j], &covers[i], split);
+
+            if(pieceCount - 1 + splitCount > OCCLUSION_PIECE_COUNT)
+            {
+                j++;
+
+                continue;
+            }
+
+            // the last piece takes this one's place, the split pieces are
+            // clear of this cover and go to the end
+            pieces[j] = pieces[pieceCount - 1];
+            pieceCount--;
+
+            for(k = 0; k < splitCount; k++)
+            {
+                pieces[pieceCount++] = split[k];
+            }
+        }
+    }
+
+    if(pieceCount == 0)
+        return LE_FALSE;
+
+    *rect = pieces[0];
+
+    for(i = 1; i < pieceCount; i++)
+    {
+        leRectCombine(rect, &pieces[i], rect);
+    }
+
+    return LE_TRUE;
+}
+
+// widgets that fill every pixel of their rectangle
+static leBool isOpaqueCover(const leWidget* wgt)
+{
+    return wgt->style.backgroundType != LE_WIDGET_BACKGROUND_NONE &&
+           wgt->style.cornerRadius == 0 &&
+           wgt->fn->isOpaque(wgt) == LE_TRUE;
+}
+
+// walks the paint list from the top down and records for each widget the
+// part of the frame rect it is visible in.  every widget later in the list
+// paints over the earlier ones, so the opaque ones seen so far are the covers
+static void cullPaintList(void)
+{
+    leRect covers[OCCLUSION_COVER_COUNT];
+    uint32_t coverCount = 0;
+    const leRect* frameRect;
+    leRect visRect, paintRect;
+    leWidget* wgt;
+    int32_t idx;
+
+    _rendererState.paintRects.size = 0;
+
+    if(_rendererState.paintListValid == LE_FALSE)
+        return;
+
+    if(_rendererState.paintRects.capacity < _rendererState.paintList.size &&
+       leRectArray_Resize(&_rendererState.paintRects,
+                          _rendererState.paintList.size) == LE_FAILURE)
+        return;
+
+    frameRect = &_rendererState.currentRenderLayer->frameRectList.rects[_rendererState.frameRectIdx];
+
+    for(idx = (int32_t)_rendererState.paintList.size - 1; idx >= 0; idx--)
+    {
+        wgt = _rendererState.paintList.values[idx];
+
+        leUtils_ClipRectToAncestors(wgt, &visRect);
+
+        if(leRectIntersects(&visRect, frameRect) == LE_FALSE)
+        {
+            // paintWidget skips it on its own
+            _rendererState.paintRects.rects[idx] = *frameRect;
+
+            continue;
+        }
+
+        leRectClip(frameRect, &visRect, &visRect);
+
+        paintRect = visRect;
+
+        if(subtractCovers(&paintRect, covers, coverCount) == LE_FALSE)
+        {
+            paintRect.width = 0;
+            paintRect.height = 0;
+        }
+
+        _rendererState.paintRects.rects[idx] = paintRect;
+
+        if(coverCount < OCCLUSION_COVER_COUNT && isOpaqueCover(wgt) == LE_TRUE)
+        {
+            covers[coverCount++] = visRect;
+        }
+    }
+
+    _rendererState.paintRects.size = _rendererState.paintList.size;
+}
+#endif
+
 static void preRect(void)
 {
     int32_t idx;
@@ -619,9 +1234,18 @@ static void preRect(void)
 
     layerState = leGetLayerState(_rendererState.layerIdx);
 
+    // the list keeps its storage from rect to rect
+    _rendererState.paintList.size = 0;
+    _rendererState.paintIdx = 0;
+    _rendererState.paintListValid = LE_TRUE;
+
     invalidateWidget(&layerState->root,
                      &_rendererState.currentRenderLayer->frameRectList.rects[_rendererState.frameRectIdx]);
 
+#if LE_RENDERER_OCCLUSION == 1
+    cullPaintList();
+#endif
+
     // set up render buffer to match damaged rectangle size
 #if LE_RENDER_ORIENTATION == 0 || LE_RENDER_ORIENTATION == 180
     width = _rendererState.currentRenderLayer->frameRectList.rects[_rendererState.frameRectIdx].width;
@@ -633,8 +1257,8 @@ static void preRect(void)
 
     lePixelBufferCreate(width,
                         height,
-                        leGetLayerColorMode(_rendererState.layerIdx),
-                        &_dataBuffers[idx],
+                        scratchColorMode(),
+                        _dataBuffers[idx],
                         &buf->renderBuffer);
 
     switch(layerState->clearMode)
@@ -705,14 +1329,52 @@ static leWidget* findDirtyWidget(leArray* widgetArray)
     return NULL;
 }
 
+// the next widget of the paint list that is still dirty.  widgets cleaned
+// by an ancestor that didn't need painting are skipped.  once the list is
+// done the widgets left waiting on children are cleaned the way
+// findDirtyWidget does on its final pass.
+static leWidget* nextPaintWidget(void)
+{
+    leWidget* wgt;
+    uint32_t idx;
+
+    while(_rendererState.paintIdx < _rendererState.paintList.size)
+    {
+        wgt = _rendererState.paintList.values[_rendererState.paintIdx++];
+
+        if(wgt->status.dirtyState == LE_WIDGET_DIRTY_STATE_DIRTY)
+            return wgt;
+    }
+
+    for(idx = 0; idx < _rendererState.paintList.size; idx++)
+    {
+        wgt = _rendererState.paintList.values[idx];
+
+        if(wgt->status.dirtyState == LE_WIDGET_DIRTY_STATE_CHILD)
+        {
+            wgt->status.dirtyState = LE_WIDGET_DIRTY_STATE_CLEAN;
+        }
+    }
+
+    return NULL;
+}
+
 static void preWidget(void)
 {
     leLayerState* layerState;
 
     layerState = leGetLayerState(_rendererState.layerIdx);
 
-    // find a dirty widget to render
-    _rendererState.currentWidget = findDirtyWidget(&layerState->root.children);
+    // find a dirty widget to render, walking the list built when the rect
+    // was invalidated instead of searching the tree from the root each time
+    if(_rendererState.paintListValid == LE_TRUE)
+    {
+        _rendererState.currentWidget = nextPaintWidget();
+    }
+    else
+    {
+        _rendererState.currentWidget = findDirtyWidget(&layerState->root.children);
+    }
     
     if(_rendererState.currentWidget == NULL)
     {
@@ -733,6 +1395,22 @@ static leBool paintWidget(leWidget* widget)
 #if LE_PREEMPTION_LEVEL >= 1
     leBool painted = LE_FALSE;
 #endif
+
+#if LE_RENDERER_PROFILE == 1
+    uint32_t start;
+#endif
+
+#if LE_RENDERER_OCCLUSION == 1
+    const leRect* paintRect = NULL;
+
+    // the paint list is only culled for widgets taken from it
+    if(_rendererState.paintRects.size > 0 &&
+       _rendererState.paintIdx > 0 &&
+       _rendererState.paintList.values[_rendererState.paintIdx - 1] == widget)
+    {
+        paintRect = &_rendererState.paintRects.rects[_rendererState.paintIdx - 1];
+    }
+#endif
     
     // skip any child that isn't dirty or that does not have a dirty descendant
     if(widget->status.dirtyState == LE_WIDGET_DIRTY_STATE_CLEAN)
@@ -753,6 +1431,20 @@ static leBool paintWidget(leWidget* widget)
     {
         shouldPaint = LE_TRUE;
     }
+
+#if LE_RENDERER_OCCLUSION == 1
+    // opaque widgets above cover all of it, its children are still painted
+    if(shouldPaint == LE_TRUE &&
+       paintRect != NULL &&
+       (paintRect->width <= 0 || paintRect->height <= 0))
+    {
+        shouldPaint = LE_FALSE;
+
+#if LE_RENDERER_DAMAGE_STATS == 1
+        _damageStats.culledPaintCount++;
+#endif
+    }
+#endif
     
     // paint this widget and clear dirty flag
     if(shouldPaint == LE_TRUE)
@@ -786,6 +1478,14 @@ static leBool paintWidget(leWidget* widget)
             leRectClip(&_rendererState.currentRenderLayer->frameRectList.rects[_rendererState.frameRectIdx],
                        &clipRect,
                        &_rendererState.drawRect);
+
+#if LE_RENDERER_OCCLUSION == 1
+            // only the part opaque widgets above leave visible
+            if(paintRect != NULL)
+            {
+                _rendererState.drawRect = *paintRect;
+            }
+#endif
         }
         else
         {
@@ -794,8 +1494,28 @@ static leBool paintWidget(leWidget* widget)
 
         //printf("rendering frame %i, widget %i, type %i, rect %i %i %i %i\n", _rendererState.drawCount, widget->id, widget->type, widget->rect.x, widget->rect.y, widget->rect.width, widget->rect.height);
 
+#if LE_RENDERER_DAMAGE_STATS == 1
+        // a widget waiting on a stream is painted again, count it once
+        if(widget->status.drawState == LE_WIDGET_DRAW_STATE_READY)
+        {
+            _framePaintPixels += (uint32_t)_rendererState.drawRect.width *
+                                 (uint32_t)_rendererState.drawRect.height;
+        }
+#endif
+
+#if LE_RENDERER_PROFILE == 1
+        start = profileStart();
+#endif
+
         widget->fn->_handleEvent(widget, &paintEvt);
         widget->drawCount++;
+
+#if LE_RENDERER_PROFILE == 1
+        profileRecord(LE_PROFILE_WIDGET + (widget->type < LE_PROFILE_WIDGET_SLOTS ?
+                                           (uint32_t)widget->type :
+                                           LE_PROFILE_WIDGET_SLOTS - 1),
+                      start);
+#endif
         
 #if LE_PREEMPTION_LEVEL >= 1
         painted = LE_TRUE;
@@ -847,6 +1567,11 @@ static void _nextRect(void)
 static leResult postRect(void)
 {
     int32_t rotX, rotY;
+    gfxResult res;
+
+#if LE_RENDERER_PROFILE == 1
+    uint32_t start;
+#endif
 
     leRect frameRect = _rendererState.currentRenderLayer->frameRectList.rects[_rendererState.frameRectIdx];
 
@@ -869,16 +1594,26 @@ static leResult postRect(void)
     _scratchBuffers[_rendererState.currentScratchBuffer].gfxBuffer.size.height = _scratchBuffers[_rendererState.currentScratchBuffer].renderBuffer.size.height;
     _scratchBuffers[_rendererState.currentScratchBuffer].gfxBuffer.mode = _convertColorMode(_scratchBuffers[_rendererState.currentScratchBuffer].renderBuffer.mode);
     _scratchBuffers[_rendererState.currentScratchBuffer].gfxBuffer.buffer_length = _scratchBuffers[_rendererState.currentScratchBuffer].renderBuffer.buffer_length;
-    _scratchBuffers[_rendererState.currentScratchBuffer].gfxBuffer.flags = 0;
+    _scratchBuffers[_rendererState.currentScratchBuffer].gfxBuffer.flags = LE_SCRATCH_BUFFER_FLAGS;
     _scratchBuffers[_rendererState.currentScratchBuffer].gfxBuffer.pixels = (gfxBuffer)_scratchBuffers[_rendererState.currentScratchBuffer].renderBuffer.pixels;
 
-    /* render buffer may be locked by something or display driver may not be ready */
-    if(_rendererState.dispDriver->blitBuffer(rotX,
-                                             rotY,
-                                             &_scratchBuffers[_rendererState.currentScratchBuffer].gfxBuffer) == GFX_FAILURE)
-    {
+    /* render buffer may be locked by something or display driver may not be ready,
+       a driver that is still sending the previous scratch buffer fails here
+       and the blit is retried on the next paint */
+#if LE_RENDERER_PROFILE == 1
+    start = profileStart();
+#endif
+
+    res = _rendererState.dispDriver->blitBuffer(rotX,
+                                                rotY,
+                                                &_scratchBuffers[_rendererState.currentScratchBuffer].gfxBuffer);
+
+#if LE_RENDERER_PROFILE == 1
+    profileRecord(LE_PROFILE_BLIT, start);
+#endif
+
+    if(res == GFX_FAILURE)
         return LE_FAILURE;
-    }
 
     _rendererState.currentScratchBuffer = -1;
 
@@ -917,6 +1652,21 @@ static void postFrame(void)
     _rendererState.frameDrawCount = 0;
 
     _rendererState.drawCount++;
+
+#if LE_RENDERER_DAMAGE_STATS == 1
+    _damageStats.frameCount++;
+    _damageStats.paintPixelCount += _framePaintPixels;
+
+    if(_frameDamagePixels > 0)
+    {
+        _damageStats.lastOverdraw = (uint32_t)(((uint64_t)_framePaintPixels * 100u) / _frameDamagePixels);
+
+        if(_damageStats.lastOverdraw > _damageStats.maxOverdraw)
+        {
+            _damageStats.maxOverdraw = _damageStats.lastOverdraw;
+        }
+    }
+#endif
     
     // manage the layer's rectangle arrays
     for(itr = 0; itr < _state->layerList.size; ++itr)
@@ -984,27 +1734,35 @@ static void postFrame(void)
 						 
 extern int debugFlag;
 
-void leRenderer_Paint()
+/* runs one step of the frame state machine, returns LE_FALSE when the
+   renderer has to give the rest of the system time before continuing */
+static leBool paintStage(void)
 {
-#if LE_PREEMPTION_LEVEL == 0
+    leBool more = LE_TRUE;
 
-    while(_rendererState.frameState != LE_FRAME_READY)
-    {
+#if LE_RENDERER_PROFILE == 1
+    leFrameState stage = _rendererState.frameState;
+    uint32_t start = profileStart();
 #endif
-        switch(_rendererState.frameState)
+
+    switch(_rendererState.frameState)
+    {
+        case LE_FRAME_PREFRAME:
         {
-            case LE_FRAME_PREFRAME:
-            {
-                preFrame();
+#if LE_RENDERER_PROFILE == 1
+            _profileFrameStart = start;
+#endif
 
-                _rendererState.val.value.v_uint = 0;
-                _rendererState.dispDriver->ioctl(GFX_IOCTL_FRAME_START, &_rendererState.val);
-                
-                break;
-            }
-            case LE_FRAME_PRELAYER:
-            {
-                _rendererState.val.value.v_uint = _rendererState.layerIdx;
+            preFrame();
+
+            _rendererState.val.value.v_uint = 0;
+            _rendererState.dispDriver->ioctl(GFX_IOCTL_FRAME_START, &_rendererState.val);
+            
+            break;
+        }
+        case LE_FRAME_PRELAYER:
+        {
+            _rendererState.val.value.v_uint = _rendererState.layerIdx;
 
 				if(_rendererState.dispDriver->ioctl(GFX_IOCTL_SET_ACTIVE_LAYER, &_rendererState.val) >= GFX_IOCTL_ERROR_UNKNOWN)
 				{
@@ -1014,87 +1772,131 @@ void leRenderer_Paint()
 				{
 					preLayer();
 				}
-                
-                break;
-            }
-            case LE_FRAME_PRERECT:
-            {
-                preRect();
-                
-                break;
-            }
-            case LE_FRAME_PREWIDGET:
+            
+            break;
+        }
+        case LE_FRAME_PRERECT:
+        {
+            preRect();
+
+            /* all scratch buffers are still owned by the display driver,
+               give the rest of the system time until one is released */
+            if(_rendererState.frameState == LE_FRAME_PRERECT)
             {
-                preWidget();
-                
-                break;
+                more = LE_FALSE;
             }
-            case LE_FRAME_DRAWING:
+
+            break;
+        }
+        case LE_FRAME_PREWIDGET:
+        {
+            preWidget();
+            
+            break;
+        }
+        case LE_FRAME_DRAWING:
+        {
+            if(paintWidget(_rendererState.currentWidget) == LE_TRUE)
             {
-                if(paintWidget(_rendererState.currentWidget) == LE_TRUE)
-                {
-                    _rendererState.frameState = LE_FRAME_POSTWIDGET;
-                }
-                else
-                {
-                    return;
-                }
-                
-                break;
+                _rendererState.frameState = LE_FRAME_POSTWIDGET;
             }
-            case LE_FRAME_POSTWIDGET:
+            else
             {
-                _rendererState.frameState = LE_FRAME_PREWIDGET;
-                
-                break;
+                more = LE_FALSE;
             }
-            case LE_FRAME_POSTRECT:
+            
+            break;
+        }
+        case LE_FRAME_POSTWIDGET:
+        {
+            _rendererState.frameState = LE_FRAME_PREWIDGET;
+            
+            break;
+        }
+        case LE_FRAME_POSTRECT:
+        {
+            /* may need to preempt to give some time to the rest of the system */
+            if(postRect() == LE_FAILURE)
             {
-                /* may need to preempt to give some time to the rest of the system */
-                if(postRect() == LE_FAILURE)
-                    return;
-                
-                break;
+                more = LE_FALSE;
             }
-            case LE_FRAME_WAITFORBUFFER:
-            {
-                /* may need to preempt to give some time to the rest of the system */
-                //if(lePixelBuffer_IsLocked(&renderBuffer) == LE_TRUE)
-                //    return;
+            
+            break;
+        }
+        case LE_FRAME_WAITFORBUFFER:
+        {
+            /* may need to preempt to give some time to the rest of the system */
+            //if(lePixelBuffer_IsLocked(&renderBuffer) == LE_TRUE)
+            //    return;
 
-                _nextRect();
+            _nextRect();
 
-                break;
-            }
-            case LE_FRAME_POSTLAYER:
-            {
-                postLayer();
-                
-                _rendererState.dispDriver->ioctl(GFX_IOCTL_LAYER_SWAP, NULL);
-                
-                break;
-            }
-            case LE_FRAME_POSTFRAME:
-            {
-                _rendererState.dispDriver->ioctl(GFX_IOCTL_FRAME_END, NULL);
-                
-                postFrame();
-                
-                //if(_rendererState.pendingDamageRects.size > 0)
-                //{
-                //    _rendererState.frameState = LE_FRAME_PREFRAME;
-                //}
-                
-                break;
-            }
-            default:
-            {
-                break;
-            }
+            break;
         }
+        case LE_FRAME_POSTLAYER:
+        {
+            postLayer();
+            
+            _rendererState.dispDriver->ioctl(GFX_IOCTL_LAYER_SWAP, NULL);
+            
+            break;
+        }
+        case LE_FRAME_POSTFRAME:
+        {
+            _rendererState.dispDriver->ioctl(GFX_IOCTL_FRAME_END, NULL);
+            
+            postFrame();
+
+#if LE_RENDERER_PROFILE == 1
+            profileRecord(LE_PROFILE_FRAME, _profileFrameStart);
+            profileRecord(LE_PROFILE_LATENCY, _profileDamageStart);
+
+            // back to back frames start when the previous one ends
+            _profileDamageStart = profileStart();
+#endif
+            
+            //if(_rendererState.pendingDamageRects.size > 0)
+            //{
+            //    _rendererState.frameState = LE_FRAME_PREFRAME;
+            //}
+            
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+
+#if LE_RENDERER_PROFILE == 1
+    if(stage != LE_FRAME_READY)
+    {
+        profileRecord(LE_PROFILE_PREFRAME + (stage - LE_FRAME_PREFRAME), start);
+    }
+#endif
+
+    return more;
+}
+
+void leRenderer_Paint()
+{
+#if LE_INDEXED_SCRATCH == 1
+    if(_rendererState.palettePending == LE_TRUE &&
+       _rendererState.frameState == LE_FRAME_READY)
+    {
+        applyScratchPalette();
+    }
+#endif
+
 #if LE_PREEMPTION_LEVEL == 0
+    while(_rendererState.frameState != LE_FRAME_READY)
+    {
+        if(paintStage() == LE_FALSE)
+            return;
     }
-#endif    
+#else
+    paintStage();
+#endif
 }
 
 leResult _leRenderer_CreateLayerState(struct leLayerState* st)
@@ -42,6 +42,13 @@ extern "C" {
 #include "gfx/driver/gfx_driver.h"
 #include "gfx/legato/widget/legato_widget.h"
 
+// buffer flags the renderer attaches to scratch buffers handed to the display
+// driver and the GPU.  describes the byte order of the stored pixels.
+#if LE_SCRATCH_BIG_ENDIAN == 1
+#define LE_SCRATCH_BUFFER_FLAGS GFX_BF_BIG_ENDIAN
+#else
+#define LE_SCRATCH_BUFFER_FLAGS GFX_BF_NONE
+#endif
 
 // *****************************************************************************
 
@@ -105,6 +112,27 @@ const gfxDisplayDriver* leRenderer_DisplayInterface(void);
 */
 const gfxGraphicsProcessor* leRenderer_GPUInterface(void);
 
+// *****************************************************************************
+/* Function:
+    void leRenderer_SetGPUInterface(const gfxGraphicsProcessor* gpuDriver)
+
+  Summary:
+    Replaces the GPU driver interface the renderer was initialized with.
+
+  Description:
+    The generated Legato_Initialize passes the stock interface, which has no
+    operations.  The application installs the display driver's own GPU
+    interface after that, so it survives regenerating the Legato code.  Must
+    not be called while a frame is being drawn.
+
+  Parameters:
+    const gfxGraphicsProcessor* gpuDriver - the GPU driver interface
+
+  Returns:
+    void
+*/
+void leRenderer_SetGPUInterface(const gfxGraphicsProcessor* gpuDriver);
+
 // *****************************************************************************
 /* Function:
     leResult leRenderer_DamageArea(const leRect* rect)
@@ -126,9 +154,37 @@ const gfxGraphicsProcessor* leRenderer_GPUInterface(void);
 */
 leResult leRenderer_DamageArea(const leRect* rect, uint32_t layerIdx);
 
+// *****************************************************************************
+/* Function:
+    leResult leRenderer_ScrollDisplay(int32_t rows)
+
+  Summary:
+    Scrolls the whole display up by a number of rows, down when negative.
+
+  Description:
+    Meant for text that scrolls by whole lines, such as a terminal.  The
+    caller moves its content by the same amount and damages it in the same
+    update.  The display driver moves the picture on the panel at the start
+    of the next frame and only the rows scrolled into view are repainted.
+    The rest of the damage then matches what the panel shows and costs
+    nothing to send when the driver keeps a shadow of the panel.  Requests
+    made before the frame starts add up.  If the driver can't scroll, the
+    frame repaints every layer instead.
+
+  Parameters:
+    int32_t rows - the number of rows to scroll up by
+
+  Returns:
+    leResult
+*/
+leResult leRenderer_ScrollDisplay(int32_t rows);
+
 // internal use only
 void leRenderer_Paint(void);
 
+// internal use only, calls the wake callback
+void _leRenderer_Wake(void);
+
 // *****************************************************************************
 /* Function:
     leBool leRenderer_IsIdle(void);
@@ -137,7 +193,8 @@ void leRenderer_Paint(void);
     Returns LE_TRUE if there is no frame in progress
 
   Description:
-    Returns LE_TRUE if there is no frame in progress
+    Returns LE_TRUE if there is no frame in progress and no scratch palette
+    switch waiting for the display driver
 
   Parameters:
 
@@ -163,6 +220,322 @@ leBool leRenderer_IsIdle(void);
 */
 size_t leRenderer_GetDrawCount(void);
 
+// *****************************************************************************
+/* Enumeration:
+    leScratchSplit
+
+  Summary:
+    Strategies for slicing damage rectangles into scratch buffer sized pieces
+
+  Description:
+    LE_SCRATCH_SPLIT_DEFAULT - halve rectangles along the layer's render
+                               direction until they fit
+    LE_SCRATCH_SPLIT_BANDS - cut rectangles into bands of as many full rows as
+                             fit, producing the fewest blits for a given size
+*/
+typedef enum leScratchSplit
+{
+    LE_SCRATCH_SPLIT_DEFAULT,
+    LE_SCRATCH_SPLIT_BANDS
+} leScratchSplit;
+
+#define LE_DAMAGE_HISTOGRAM_SIZE    8
+#define LE_DAMAGE_CANDIDATE_COUNT   6
+
+// *****************************************************************************
+/* Structure:
+    leDamageStats
+
+  Summary:
+    Damage rectangle statistics collected by the renderer
+
+  Description:
+    frameCount - the number of frames rendered
+    damageRectCount - the number of damage rectangles before scratch cropping
+    blitCount - the number of blits sent to the display driver
+    pixelCount - the number of damaged pixels
+    histogram - damage rectangle areas.  bucket n counts rectangles of up to
+                (64 << n) pixels, the last bucket counts everything larger
+    candidateSize - scratch buffer sizes in bytes the blit estimate is
+                    computed for
+    candidateBlitCount - the number of blits each candidate size would have
+                         needed using LE_SCRATCH_SPLIT_BANDS
+    paintPixelCount - the number of pixels inside the clip rectangles widgets
+                      were painted with.  divided by pixelCount this is the
+                      average overdraw
+    culledPaintCount - the number of widget paints skipped because opaque
+                       widgets above covered the damaged part of the widget
+    lastOverdraw - the overdraw of the last frame in hundredths
+    maxOverdraw - the highest overdraw of a single frame in hundredths
+
+  Remarks:
+    Only collected when LE_RENDERER_DAMAGE_STATS is enabled.
+*/
+typedef struct leDamageStats
+{
+    uint32_t frameCount;
+    uint32_t damageRectCount;
+    uint32_t blitCount;
+    uint32_t pixelCount;
+    uint32_t histogram[LE_DAMAGE_HISTOGRAM_SIZE];
+    uint32_t candidateSize[LE_DAMAGE_CANDIDATE_COUNT];
+    uint32_t candidateBlitCount[LE_DAMAGE_CANDIDATE_COUNT];
+    uint32_t paintPixelCount;
+    uint32_t culledPaintCount;
+    uint32_t lastOverdraw;
+    uint32_t maxOverdraw;
+} leDamageStats;
+
+#define LE_PROFILE_RING_SIZE        32
+#define LE_PROFILE_WIDGET_SLOTS     8
+
+// *****************************************************************************
+/* Enumeration:
+    leProfileBucket
+
+  Summary:
+    Renderer profiler timing buckets
+
+  Description:
+    LE_PROFILE_FRAME - a whole frame, from the start of LE_FRAME_PREFRAME to
+                       the end of LE_FRAME_POSTFRAME
+    LE_PROFILE_PREFRAME to LE_PROFILE_POSTFRAME - one renderer state
+                       machine step in the matching frame state
+    LE_PROFILE_BLIT - one display driver blitBuffer call
+    LE_PROFILE_LATENCY - from the damage that started a frame while the
+                         renderer was idle to the end of that frame
+    LE_PROFILE_WIDGET - the paint event of one widget.  the widget type is
+                        added to the bucket, types past the last slot share
+                        it
+*/
+typedef enum leProfileBucket
+{
+    LE_PROFILE_FRAME = 0,
+    LE_PROFILE_PREFRAME,
+    LE_PROFILE_PRELAYER,
+    LE_PROFILE_PRERECT,
+    LE_PROFILE_PREWIDGET,
+    LE_PROFILE_DRAWING,
+    LE_PROFILE_POSTWIDGET,
+    LE_PROFILE_POSTRECT,
+    LE_PROFILE_WAITFORBUFFER,
+    LE_PROFILE_POSTLAYER,
+    LE_PROFILE_POSTFRAME,
+    LE_PROFILE_BLIT,
+    LE_PROFILE_LATENCY,
+    LE_PROFILE_WIDGET,
+    LE_PROFILE_BUCKET_COUNT = LE_PROFILE_WIDGET + LE_PROFILE_WIDGET_SLOTS
+} leProfileBucket;
+
+// *****************************************************************************
+/* Structure:
+    leProfileStats
+
+  Summary:
+    Timing statistics of one profiler bucket
+
+  Description:
+    count - the number of samples since the last reset
+    min - the shortest sample in clock ticks
+    max - the longest sample in clock ticks
+    total - the sum of all samples in clock ticks
+    samples - the last LE_PROFILE_RING_SIZE samples, oldest first once the
+              ring has wrapped
+    next - the ring index the next sample is written to
+
+  Remarks:
+    Only collected when LE_RENDERER_PROFILE is enabled and a clock has been
+    set with leRenderer_SetProfileClock.
+*/
+typedef struct leProfileStats
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint32_t samples[LE_PROFILE_RING_SIZE];
+    uint32_t next;
+} leProfileStats;
+
+/* Profiler clock, returns a free running tick count that wraps at 2^32 */
+typedef uint32_t (*leProfileClock)(void);
+
+/* Called when damage gives an idle renderer a new frame to draw */
+typedef void (*leRendererWakeCallback)(void);
+
+// *****************************************************************************
+/* Function:
+    leResult leRenderer_SetScratchPolicy(uint32_t size, leScratchSplit split);
+
+  Summary:
+    Sets the usable scratch buffer size and the damage split strategy
+
+  Description:
+    Damage rectangles are cropped to size bytes worth of pixels using the
+    given strategy.  Takes effect at the start of the next layer render.
+    The RAM budget is fixed at build time by LE_SCRATCH_BUFFER_SIZE_KB, size
+    can only be used to reduce it.
+
+  Parameters:
+    uint32_t size - the scratch size in bytes, 0 for the full buffer
+    leScratchSplit split - the split strategy
+
+  Returns:
+    leResult - LE_FAILURE if size exceeds the scratch buffer size
+*/
+leResult leRenderer_SetScratchPolicy(uint32_t size, leScratchSplit split);
+
+// *****************************************************************************
+/* Function:
+    leResult leRenderer_SetScratchPalette(const lePalette* pal);
+
+  Summary:
+    Renders into indexed scratch buffers that the display driver expands
+    through the given palette
+
+  Description:
+    Drawing colors are matched to the nearest palette entry.  A palette of
+    two colors uses INDEX_1 scratch buffers, up to sixteen INDEX_4 and up to
+    256 INDEX_8, so the same scratch RAM holds 16, 4 or 2 times the pixels
+    of an RGB565 buffer.  The palette is handed to the display driver with
+    GFX_IOCTL_SET_PALETTE once the renderer is idle and the screen is then
+    repainted.  The renderer is woken for the switch and doesn't report idle
+    until the driver has taken the palette.  The palette must stay valid
+    while it is in use.
+
+  Parameters:
+    const lePalette* pal - an internal palette, NULL renders in the layer
+                           color mode
+
+  Returns:
+    leResult - LE_FAILURE if indexed scratch buffers are not enabled or the
+               palette can't be used
+*/
+leResult leRenderer_SetScratchPalette(const lePalette* pal);
+
+// *****************************************************************************
+/* Function:
+    leResult leRenderer_GetDamageStats(leDamageStats* stats);
+
+  Summary:
+    Copies out the damage statistics collected since the last reset
+
+  Parameters:
+    leDamageStats* stats - the destination
+
+  Returns:
+    leResult - LE_FAILURE if statistics are not enabled
+*/
+leResult leRenderer_GetDamageStats(leDamageStats* stats);
+
+// *****************************************************************************
+/* Function:
+    void leRenderer_ResetDamageStats(void);
+
+  Summary:
+    Clears the damage statistics
+
+  Parameters:
+
+  Returns:
+*/
+void leRenderer_ResetDamageStats(void);
+
+// *****************************************************************************
+/* Function:
+    void leRenderer_SetWakeCallback(leRendererWakeCallback cb);
+
+  Summary:
+    Sets the function called when an idle renderer is given a frame to draw
+
+  Description:
+    Lets the task running leUpdate block while the screen is idle instead of
+    polling.  The callback runs in the context of whoever damaged the area,
+    which may be another task, so it should only signal the Legato task.
+    Damage added while a frame is in progress does not call it, that frame
+    picks the rectangles up when it ends.  Queued widget commands call it
+    too.
+
+  Parameters:
+    leRendererWakeCallback cb - the callback, NULL for none
+
+  Returns:
+*/
+void leRenderer_SetWakeCallback(leRendererWakeCallback cb);
+
+// *****************************************************************************
+/* Function:
+    void leRenderer_SetProfileClock(leProfileClock clock);
+
+  Summary:
+    Sets the clock the renderer profiler takes its samples from
+
+  Description:
+    On target this is typically the DWT cycle counter, on a host build any
+    monotonic clock.  Samples are tick differences so the counter may wrap,
+    but a single sample must be shorter than one wrap period.
+
+  Parameters:
+    leProfileClock clock - the clock, NULL stops profiling
+
+  Returns:
+*/
+void leRenderer_SetProfileClock(leProfileClock clock);
+
+// *****************************************************************************
+/* Function:
+    leResult leRenderer_GetProfileStats(leProfileBucket bucket,
+                                        leProfileStats* stats);
+
+  Summary:
+    Copies out the statistics of one profiler bucket
+
+  Parameters:
+    leProfileBucket bucket - the bucket
+    leProfileStats* stats - the destination
+
+  Returns:
+    leResult - LE_FAILURE if profiling is not enabled or the bucket is
+               invalid
+*/
+leResult leRenderer_GetProfileStats(leProfileBucket bucket,
+                                    leProfileStats* stats);
+
+// *****************************************************************************
+/* Function:
+    uint32_t leRenderer_ProfilePercentile(const leProfileStats* stats,
+                                          uint32_t pct);
+
+  Summary:
+    Returns a percentile of the samples in a bucket's ring
+
+  Description:
+    Only the last LE_PROFILE_RING_SIZE samples are kept, so high percentiles
+    describe that window rather than everything since the last reset.
+
+  Parameters:
+    const leProfileStats* stats - the statistics
+    uint32_t pct - the percentile, 0 to 100
+
+  Returns:
+    uint32_t - the sample in clock ticks, 0 if the ring is empty
+*/
+uint32_t leRenderer_ProfilePercentile(const leProfileStats* stats,
+                                      uint32_t pct);
+
+// *****************************************************************************
+/* Function:
+    void leRenderer_ResetProfileStats(void);
+
+  Summary:
+    Clears the profiler statistics
+
+  Parameters:
+
+  Returns:
+*/
+void leRenderer_ResetProfileStats(void);
+
 // *****************************************************************************
 /* Function:
     void leRenderer_GetDisplaySize(leSize* sz);
@@ -485,6 +858,44 @@ leResult leRenderer_PutPixel(int32_t x,
                              int32_t y,
                              leColor clr);
 
+// *****************************************************************************
+/* Function:
+    leResult leRenderer_PutMaskRow(int32_t x,
+                                   int32_t y,
+                                   const uint8_t* mask,
+                                   int32_t colStart,
+                                   int32_t colEnd,
+                                   leColor clr)
+
+  Summary:
+    Writes a color to the current render buffer wherever a bit of a mask
+    row is set.  Does not do bounds checking.
+
+  Description:
+    Bit n of the mask, most significant bit of each byte first, covers the
+    pixel at x + n.  Only columns colStart to colEnd - 1 are written, so the
+    caller clips by narrowing that range.  This is the row format of 1bpp
+    font glyphs.  In RGB color modes the set pixels are written straight
+    into the buffer rather than through leRenderer_PutPixel.
+
+  Parameters:
+    int32_t x - the x position of mask bit 0 (screen space)
+    int32_t y - the y position of the row (screen space)
+    const uint8_t* mask - the mask bits
+    int32_t colStart - the first column to write
+    int32_t colEnd - one past the last column to write
+    leColor clr - the color to write
+
+  Returns:
+    leResult
+*/
+leResult leRenderer_PutMaskRow(int32_t x,
+                               int32_t y,
+                               const uint8_t* mask,
+                               int32_t colStart,
+                               int32_t colEnd,
+                               leColor clr);
+
 // *****************************************************************************
 /* Function:
     leResult leRenderer_BlendPixel(int32_t x,
@@ -51,6 +51,10 @@ void leDynamicString_Constructor(leDynamicString* _this)
     _this->capacity = 0;
     _this->length = 0;
     _this->font = NULL;
+
+#if LE_STRING_LAYOUT_CACHE_ENABLED == 1
+    _leStringLayout_Invalidate(&_this->layout);
+#endif
 }
 
 leDynamicString* leDynamicString_New()
@@ -470,6 +474,54 @@ uint32_t _leDynamicString_ToChar(const leDynamicString* _this,
     return size;
 }
 
+#if LE_STRING_LAYOUT_CACHE_ENABLED == 1
+void _leString_Invalidate(leString* _this);
+
+// the layout cache is mutable state of an otherwise const string
+leResult _leDynamicString_GetRect(const leDynamicString* _this,
+                                  leRect* rect)
+{
+    return _leStringLayout_GetRect((const leString*)_this,
+                                   (leStringLayout*)&_this->layout,
+                                   rect);
+}
+
+uint32_t _leDynamicString_GetLineCount(const leDynamicString* _this)
+{
+    return _leStringLayout_GetLineCount((const leString*)_this,
+                                        (leStringLayout*)&_this->layout);
+}
+
+leResult _leDynamicString_GetLineRect(const leDynamicString* _this,
+                                      uint32_t line,
+                                      leRect* rect)
+{
+    return _leStringLayout_GetLineRect((const leString*)_this,
+                                       (leStringLayout*)&_this->layout,
+                                       line,
+                                       rect);
+}
+
+leResult _leDynamicString_GetLineIndices(const leDynamicString* _this,
+                                         uint32_t line,
+                                         uint32_t* start,
+                                         uint32_t* end)
+{
+    return _leStringLayout_GetLineIndices((const leString*)_this,
+                                          (leStringLayout*)&_this->layout,
+                                          line,
+                                          start,
+                                          end);
+}
+
+void _leDynamicString_Invalidate(leDynamicString* _this)
+{
+    _leStringLayout_Invalidate(&_this->layout);
+
+    _leString_Invalidate((leString*)_this);
+}
+#endif
+
 #if LE_DYNAMIC_VTABLES == 1
 void _leString_FillVTable(leStringVTable* vt);
 
@@ -478,6 +530,14 @@ void _leDynamicString_GenerateVTable(void)
     _leString_FillVTable((void*)&dynamicStringVTable);
     
     dynamicStringVTable.destructor = _leDynamicString_Destructor;
+
+#if LE_STRING_LAYOUT_CACHE_ENABLED == 1
+    dynamicStringVTable.getRect = _leDynamicString_GetRect;
+    dynamicStringVTable.getLineCount = _leDynamicString_GetLineCount;
+    dynamicStringVTable.getLineRect = _leDynamicString_GetLineRect;
+    dynamicStringVTable.getLineIndices = _leDynamicString_GetLineIndices;
+    dynamicStringVTable.invalidate = _leDynamicString_Invalidate;
+#endif
     
     dynamicStringVTable.getFont = _leDynamicString_GetFont;
     dynamicStringVTable.setFont = _leDynamicString_SetFont;
@@ -512,15 +572,26 @@ leResult _leString_SetInvalidateCallback(leString*, leString_InvalidateCallback,
 static const leDynamicStringVTable dynamicStringVTable =
 {
     // base class funcs
+#if LE_STRING_LAYOUT_CACHE_ENABLED == 1
+    .getRect = _leDynamicString_GetRect,
+    .getLineCount = _leDynamicString_GetLineCount,
+    .getLineRect = _leDynamicString_GetLineRect,
+    .getLineIndices = _leDynamicString_GetLineIndices,
+#else
     .getRect = (void*)_leString_GetRect,
     .getLineCount = (void*)_leString_GetLineCount,
     .getLineRect = (void*)_leString_GetLineRect,
     .getLineIndices = (void*)_leString_GetLineIndices,
+#endif
     .getCharRect = (void*)_leString_GetCharRect,
     .getCharIndexAtPoint = (void*)_leString_GetCharIndexAtPoint,
     ._draw = (void*)_leString_Draw,
     .preinvalidate = (void*)_leString_PreInvalidate,
+#if LE_STRING_LAYOUT_CACHE_ENABLED == 1
+    .invalidate = _leDynamicString_Invalidate,
+#else
     .invalidate = (void*)_leString_Invalidate,
+#endif
     .setPreInvalidateCallback = (void*)_leString_SetPreInvalidateCallback,
     .setInvalidateCallback = (void*)_leString_SetInvalidateCallback,
 
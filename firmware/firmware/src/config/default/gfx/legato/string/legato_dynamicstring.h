@@ -64,6 +64,10 @@ typedef struct leDynamicString
     uint16_t    capacity;               /**< string capacity */
     uint16_t    length;                 /**< string length */
     const leFont*  font;                /**< string font */
+
+#if LE_STRING_LAYOUT_CACHE_ENABLED == 1
+    leStringLayout layout;              /**< cached line layout */
+#endif
 } leDynamicString;
 
 // *****************************************************************************
@@ -55,6 +55,10 @@ void leFixedString_Constructor(leFixedString* _this,
     _this->length = 0;
     _this->data[0] = 0;
     _this->font = NULL;
+
+#if LE_STRING_LAYOUT_CACHE_ENABLED == 1
+    _leStringLayout_Invalidate(&_this->layout);
+#endif
 }
 
 leFixedString* leFixedString_New(leChar* buf,
@@ -431,6 +435,54 @@ uint32_t _leFixedString_ToChar(const leFixedString* _this,
     return size;
 }
 
+#if LE_STRING_LAYOUT_CACHE_ENABLED == 1
+void _leString_Invalidate(leString* _this);
+
+// the layout cache is mutable state of an otherwise const string
+leResult _leFixedString_GetRect(const leFixedString* _this,
+                                leRect* rect)
+{
+    return _leStringLayout_GetRect((const leString*)_this,
+                                   (leStringLayout*)&_this->layout,
+                                   rect);
+}
+
+uint32_t _leFixedString_GetLineCount(const leFixedString* _this)
+{
+    return _leStringLayout_GetLineCount((const leString*)_this,
+                                        (leStringLayout*)&_this->layout);
+}
+
+leResult _leFixedString_GetLineRect(const leFixedString* _this,
+                                    uint32_t line,
+                                    leRect* rect)
+{
+    return _leStringLayout_GetLineRect((const leString*)_this,
+                                       (leStringLayout*)&_this->layout,
+                                       line,
+                                       rect);
+}
+
+leResult _leFixedString_GetLineIndices(const leFixedString* _this,
+                                       uint32_t line,
+                                       uint32_t* start,
+                                       uint32_t* end)
+{
+    return _leStringLayout_GetLineIndices((const leString*)_this,
+                                          (leStringLayout*)&_this->layout,
+                                          line,
+                                          start,
+                                          end);
+}
+
+void _leFixedString_Invalidate(leFixedString* _this)
+{
+    _leStringLayout_Invalidate(&_this->layout);
+
+    _leString_Invalidate((leString*)_this);
+}
+#endif
+
 #if LE_DYNAMIC_VTABLES == 1
 void _leString_FillVTable(leStringVTable* vt);
 
@@ -440,6 +492,14 @@ void _leFixedString_GenerateVTable(void)
     
     // override
     fixedStringVTable.destructor = _leFixedString_Destructor;
+
+#if LE_STRING_LAYOUT_CACHE_ENABLED == 1
+    fixedStringVTable.getRect = _leFixedString_GetRect;
+    fixedStringVTable.getLineCount = _leFixedString_GetLineCount;
+    fixedStringVTable.getLineRect = _leFixedString_GetLineRect;
+    fixedStringVTable.getLineIndices = _leFixedString_GetLineIndices;
+    fixedStringVTable.invalidate = _leFixedString_Invalidate;
+#endif
     
     // local
     fixedStringVTable.getFont = _leFixedString_GetFont;
@@ -473,15 +533,26 @@ leResult _leString_SetInvalidateCallback(leString*, leString_InvalidateCallback,
 static const leFixedStringVTable fixedStringVTable =
 {
     // base class funcs
+#if LE_STRING_LAYOUT_CACHE_ENABLED == 1
+    .getRect = _leFixedString_GetRect,
+    .getLineCount = _leFixedString_GetLineCount,
+    .getLineRect = _leFixedString_GetLineRect,
+    .getLineIndices = _leFixedString_GetLineIndices,
+#else
     .getRect = (void*)_leString_GetRect,
     .getLineCount = (void*)_leString_GetLineCount,
     .getLineRect = (void*)_leString_GetLineRect,
     .getLineIndices = (void*)_leString_GetLineIndices,
+#endif
     .getCharRect = (void*)_leString_GetCharRect,
     .getCharIndexAtPoint = (void*)_leString_GetCharIndexAtPoint,
     ._draw = (void*)_leString_Draw,
     .preinvalidate = (void*)_leString_PreInvalidate,
+#if LE_STRING_LAYOUT_CACHE_ENABLED == 1
+    .invalidate = _leFixedString_Invalidate,
+#else
     .invalidate = (void*)_leString_Invalidate,
+#endif
     .setPreInvalidateCallback = (void*)_leString_SetPreInvalidateCallback,
     .setInvalidateCallback = (void*)_leString_SetInvalidateCallback,
 
@@ -410,6 +410,161 @@ leResult _leString_SetInvalidateCallback(leString* _this,
     return LE_SUCCESS;
 }
 
+#if LE_STRING_LAYOUT_CACHE_ENABLED == 1
+void _leStringLayout_Invalidate(leStringLayout* layout)
+{
+    layout->font = NULL;
+}
+
+// lays the string out again if it changed since the layout was cached.
+// returns LE_FALSE if the string can't be cached and has to be measured by
+// the generic functions.  a string with too many lines is remembered with
+// a line count of zero so the generic functions, which measure through the
+// string's own cached functions again, don't rescan it every call
+static leBool updateLayout(const leString* _this,
+                           leStringLayout* layout)
+{
+    uint32_t idx;
+    uint32_t len;
+    uint32_t line;
+    int32_t width;
+    leRasterFont* fnt;
+    leFontGlyph glyph;
+    leChar chr;
+
+    len = _this->fn->length(_this);
+    fnt = (leRasterFont*)_this->fn->getFont(_this);
+
+    if(len == 0 || len > UINT16_MAX || fnt == NULL || fnt->glyphTable == NULL)
+        return LE_FALSE;
+
+    if(layout->font == (leFont*)fnt && layout->length == len)
+        return layout->lineCount > 0 ? LE_TRUE : LE_FALSE;
+
+    layout->font = NULL;
+    layout->rect = leRect_Zero;
+
+    line = 0;
+    width = 0;
+
+    for(idx = 0; idx < len; idx++)
+    {
+        chr = _this->fn->charAt(_this, idx);
+
+        if(chr == LE_STRING_LINEBREAK)
+        {
+            if(line == LE_STRING_LAYOUT_CACHE_LINES - 1)
+            {
+                layout->lineCount = 0;
+                layout->length = len;
+                layout->font = (leFont*)fnt;
+
+                return LE_FALSE;
+            }
+
+            layout->lineEnd[line] = idx;
+            layout->lineWidth[line] = width;
+
+            if(layout->rect.width < width)
+            {
+                layout->rect.width = width;
+            }
+
+            line += 1;
+            width = 0;
+        }
+        else
+        {
+            leFont_GetGlyphInfo((leFont*)fnt, chr, &glyph);
+
+            width += glyph.advance;
+        }
+    }
+
+    layout->lineEnd[line] = len;
+    layout->lineWidth[line] = width;
+
+    if(layout->rect.width < width)
+    {
+        layout->rect.width = width;
+    }
+
+    layout->lineCount = line + 1;
+    layout->rect.height = layout->lineCount * fnt->height;
+
+    layout->length = len;
+    layout->font = (leFont*)fnt;
+
+    return LE_TRUE;
+}
+
+leResult _leStringLayout_GetRect(const leString* _this,
+                                 leStringLayout* layout,
+                                 leRect* rect)
+{
+    LE_ASSERT_THIS();
+
+    if(updateLayout(_this, layout) == LE_FALSE)
+        return _leString_GetRect(_this, rect);
+
+    *rect = layout->rect;
+
+    return LE_SUCCESS;
+}
+
+uint32_t _leStringLayout_GetLineCount(const leString* _this,
+                                      leStringLayout* layout)
+{
+    LE_ASSERT_THIS();
+
+    if(updateLayout(_this, layout) == LE_FALSE)
+        return _leString_GetLineCount(_this);
+
+    return layout->lineCount;
+}
+
+leResult _leStringLayout_GetLineRect(const leString* _this,
+                                     leStringLayout* layout,
+                                     uint32_t line,
+                                     leRect* rect)
+{
+    LE_ASSERT_THIS();
+
+    if(updateLayout(_this, layout) == LE_FALSE)
+        return _leString_GetLineRect(_this, line, rect);
+
+    *rect = leRect_Zero;
+
+    if(line >= layout->lineCount)
+        return LE_FAILURE;
+
+    rect->width = layout->lineWidth[line];
+    rect->height = ((leRasterFont*)layout->font)->height;
+
+    return LE_SUCCESS;
+}
+
+leResult _leStringLayout_GetLineIndices(const leString* _this,
+                                        leStringLayout* layout,
+                                        uint32_t line,
+                                        uint32_t* start,
+                                        uint32_t* end)
+{
+    LE_ASSERT_THIS();
+
+    if(updateLayout(_this, layout) == LE_FALSE)
+        return _leString_GetLineIndices(_this, line, start, end);
+
+    if(line >= layout->lineCount)
+        return LE_FAILURE;
+
+    *start = line == 0 ? 0 : layout->lineEnd[line - 1] + 1u;
+    *end = layout->lineEnd[line];
+
+    return LE_SUCCESS;
+}
+#endif
+
 #if LE_DYNAMIC_VTABLES == 1
 void _leString_GenerateVTable(void)
 {
@@ -115,6 +115,41 @@ typedef struct leString
     void* invCBUserData;                        /**< invalidate callback data */
 } leString;
 
+#if LE_STRING_LAYOUT_CACHE_ENABLED == 1
+// *****************************************************************************
+/**
+ * @brief This struct represents the cached line layout of a string.
+ * @details Strings that own their characters keep the line breaks, line
+ * widths and bounding rectangle computed for their font so that measuring
+ * unchanged text does not scan the characters and glyph table again.
+ * The layout is dropped whenever the string is invalidated and is
+ * recomputed when the font or length no longer match.  Strings with more
+ * than LE_STRING_LAYOUT_CACHE_LINES lines are measured every time, only the
+ * fact that they don't fit is cached.
+ */
+typedef struct leStringLayout
+{
+    const leFont* font;                                /**< layout font, NULL if stale */
+    uint16_t length;                                   /**< laid out string length */
+    uint16_t lineCount;                                /**< number of lines, 0 if too many to cache */
+    uint16_t lineEnd[LE_STRING_LAYOUT_CACHE_LINES];    /**< index after the last character of each line */
+    int32_t lineWidth[LE_STRING_LAYOUT_CACHE_LINES];   /**< width of each line */
+    leRect rect;                                       /**< string bounding rectangle */
+} leStringLayout;
+
+/**
+  * @cond INTERNAL
+  */
+void _leStringLayout_Invalidate(leStringLayout* layout);
+leResult _leStringLayout_GetRect(const leString* str, leStringLayout* layout, leRect* rect);
+uint32_t _leStringLayout_GetLineCount(const leString* str, leStringLayout* layout);
+leResult _leStringLayout_GetLineRect(const leString* str, leStringLayout* layout, uint32_t line, leRect* rect);
+leResult _leStringLayout_GetLineIndices(const leString* str, leStringLayout* layout, uint32_t line, uint32_t* start, uint32_t* end);
+/**
+  * @endcond
+  */
+#endif
+
 // *****************************************************************************
 /**
  * @brief Delete string.
@@ -0,0 +1,403 @@
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2020 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+#include "gfx/legato/string/legato_string_cache.h"
+
+#if LE_STRING_CACHE_ENABLED == 1
+
+#include <string.h>
+
+#include "gfx/legato/memory/legato_memory.h"
+#include "gfx/legato/renderer/legato_renderer.h"
+#include "gfx/legato/string/legato_stringutils.h"
+
+#define ASCII_SPACE 0x20
+
+typedef struct leStringCacheEntry
+{
+    const leFont* font;    // NULL for a free entry
+    leHAlignment align;    // alignment the lines were laid out with
+    uint32_t hash;         // hash of the text
+    uint32_t length;       // length of the text
+    leRect rect;           // mask rectangle relative to the draw position
+    uint32_t rowBytes;     // bytes per mask row
+    uint8_t* data;         // the text followed by the mask
+    uint32_t size;         // bytes allocated for data
+    uint32_t lastUse;      // use counter value of the last hit
+} leStringCacheEntry;
+
+static leStringCacheEntry _entries[LE_STRING_CACHE_ENTRIES];
+static leStringCacheStats _stats;
+static uint32_t _useCount;
+
+// FNV-1a over the code points
+static uint32_t hashString(const leString* str, uint32_t len)
+{
+    uint32_t hash = 2166136261u;
+    uint32_t i;
+
+    for(i = 0; i < len; i++)
+    {
+        hash ^= str->fn->charAt(str, i);
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+static leBool entryMatches(const leStringCacheEntry* entry,
+                           const leString* str,
+                           const leFont* font,
+                           leHAlignment align,
+                           uint32_t hash,
+                           uint32_t len)
+{
+    const leChar* text = (const leChar*)entry->data;
+    uint32_t i;
+
+    if(entry->font != font ||
+       entry->align != align ||
+       entry->hash != hash ||
+       entry->length != len)
+        return LE_FALSE;
+
+    for(i = 0; i < len; i++)
+    {
+        if(text[i] != str->fn->charAt(str, i))
+            return LE_FALSE;
+    }
+
+    return LE_TRUE;
+}
+
+static void freeEntry(leStringCacheEntry* entry)
+{
+    LE_FREE(entry->data);
+
+    _stats.bytes -= entry->size;
+
+    entry->font = NULL;
+    entry->data = NULL;
+    entry->size = 0;
+}
+
+// frees least recently used masks until size bytes and an entry are free
+static leStringCacheEntry* makeRoom(uint32_t size)
+{
+    leStringCacheEntry* lru;
+    uint32_t i;
+
+    while(1)
+    {
+        if(_stats.bytes + size <= LE_STRING_CACHE_BUDGET)
+        {
+            for(i = 0; i < LE_STRING_CACHE_ENTRIES; i++)
+            {
+                if(_entries[i].font == NULL)
+                    return &_entries[i];
+            }
+        }
+
+        lru = NULL;
+
+        for(i = 0; i < LE_STRING_CACHE_ENTRIES; i++)
+        {
+            if(_entries[i].font != NULL &&
+               (lru == NULL || _entries[i].lastUse < lru->lastUse))
+            {
+                lru = &_entries[i];
+            }
+        }
+
+        if(lru == NULL)
+            return NULL;
+
+        freeEntry(lru);
+
+        _stats.evictions++;
+    }
+}
+
+// lays the string out the way leStringRenderer_DrawString does, relative to
+// the draw position.  without a mask the glyph rectangles are merged into
+// rect, with one the glyph bits are copied into it
+static leResult layoutString(const leString* str,
+                             const leRasterFont* font,
+                             leHAlignment align,
+                             leRect* rect,
+                             uint8_t* mask,
+                             uint32_t rowBytes)
+{
+    uint32_t charItr, lines, lineItr;
+    uint32_t startIdx, endIdx;
+    leFontGlyph glyphInfo;
+    leChar codePoint;
+    int32_t stringY, lineX;
+    int32_t glyphX, glyphY;
+    int32_t row, col;
+    leRect stringRect, lineRect, glyphRect;
+    leFontGlyphDecoder dec;
+    const uint8_t* glyphData;
+    uint32_t maskX, maskY;
+
+    stringY = 0;
+
+    lines = str->fn->getLineCount(str);
+
+    str->fn->getRect(str, &stringRect);
+
+    leStringUtils_KerningRect(font, &stringRect);
+
+    for(lineItr = 0; lineItr < lines; lineItr++)
+    {
+        str->fn->getLineIndices(str, lineItr, &startIdx, &endIdx);
+        str->fn->getLineRect(str, lineItr, &lineRect);
+
+        if(align == LE_HALIGN_CENTER)
+        {
+            lineX = stringRect.x + (stringRect.width / 2) - (lineRect.width / 2);
+        }
+        else if(align == LE_HALIGN_RIGHT)
+        {
+            lineX = stringRect.x + stringRect.width - lineRect.width;
+        }
+        else
+        {
+            lineX = stringRect.x;
+        }
+
+        for(charItr = startIdx; charItr < endIdx; charItr++)
+        {
+            codePoint = str->fn->charAt(str, charItr);
+
+            leFont_GetGlyphInfo((leFont*)font, codePoint, &glyphInfo);
+
+            if(codePoint != ASCII_SPACE)
+            {
+                // drawn as an outline, leave the string to the renderer
+                if(glyphInfo.codePoint == LE_UNKNOWN_GLYPH)
+                    return LE_FAILURE;
+
+                glyphX = lineX + glyphInfo.bearingX;
+                glyphY = stringY + (font->baseline - glyphInfo.bearingY);
+
+                if(leFont_InitGlyphDecoder(&dec,
+                                           &glyphInfo,
+                                           (const uint8_t*)font->base.header.address + glyphInfo.dataOffset) == LE_FAILURE)
+                    return LE_FAILURE;
+
+                if(mask == NULL)
+                {
+                    glyphRect.x = glyphX;
+                    glyphRect.y = glyphY;
+                    glyphRect.width = glyphInfo.width;
+                    glyphRect.height = glyphInfo.height;
+
+                    if(rect->width == 0 || rect->height == 0)
+                    {
+                        *rect = glyphRect;
+                    }
+                    else if(glyphRect.width > 0 && glyphRect.height > 0)
+                    {
+                        leRectCombine(rect, &glyphRect, rect);
+                    }
+                }
+                else
+                {
+                    for(row = 0; row < glyphInfo.height; row++)
+                    {
+                        glyphData = leFont_DecodeGlyphRow(&dec);
+
+                        for(col = 0; col < glyphInfo.width; col++)
+                        {
+                            if((glyphData[(col >> 3)] & (0x80 >> (col & 0x7))) == 0)
+                                continue;
+
+                            maskX = glyphX + col - rect->x;
+                            maskY = glyphY + row - rect->y;
+
+                            mask[maskY * rowBytes + (maskX >> 3)] |= 0x80 >> (maskX & 0x7);
+                        }
+                    }
+                }
+            }
+
+            lineX += glyphInfo.advance;
+        }
+
+        stringY += font->height;
+    }
+
+    return LE_SUCCESS;
+}
+
+// renders the mask of a string into a free entry
+static leStringCacheEntry* addEntry(const leString* str,
+                                    const leRasterFont* font,
+                                    leHAlignment align,
+                                    uint32_t hash,
+                                    uint32_t len)
+{
+    leStringCacheEntry* entry;
+    leRect rect = leRect_Zero;
+    uint32_t rowBytes;
+    uint32_t textSize;
+    uint32_t size;
+    leChar* text;
+    uint32_t i;
+
+    if(layoutString(str, font, align, &rect, NULL, 0) == LE_FAILURE ||
+       rect.width <= 0 ||
+       rect.height <= 0)
+        return NULL;
+
+    rowBytes = (rect.width + 7) >> 3;
+
+    // keeps the mask aligned for the row writes
+    textSize = (len * sizeof(leChar) + 3) & ~0x3u;
+
+    size = textSize + rowBytes * rect.height;
+
+    if(size > LE_STRING_CACHE_BUDGET)
+        return NULL;
+
+    entry = makeRoom(size);
+
+    if(entry == NULL)
+        return NULL;
+
+    entry->data = LE_MALLOC(size);
+
+    if(entry->data == NULL)
+        return NULL;
+
+    memset(entry->data, 0, size);
+
+    text = (leChar*)entry->data;
+
+    for(i = 0; i < len; i++)
+    {
+        text[i] = str->fn->charAt(str, i);
+    }
+
+    entry->rect = rect;
+    entry->rowBytes = rowBytes;
+
+    layoutString(str, font, align, &entry->rect, entry->data + textSize, rowBytes);
+
+    entry->font = (const leFont*)font;
+    entry->align = align;
+    entry->hash = hash;
+    entry->length = len;
+    entry->size = size;
+
+    _stats.bytes += size;
+    _stats.misses++;
+
+    return entry;
+}
+
+leResult leStringCache_Draw(const leStringRenderRequest* req)
+{
+    leStringCacheEntry* entry = NULL;
+    const leRasterFont* font;
+    const uint8_t* mask;
+    leRect rect, clipRect;
+    int32_t colStart, colEnd;
+    int32_t row;
+    uint32_t len;
+    uint32_t hash;
+    uint32_t i;
+
+    font = (const leRasterFont*)req->str->fn->getFont(req->str);
+    len = req->str->fn->length(req->str);
+
+    if(font == NULL ||
+       font->glyphTable == NULL ||
+       font->base.header.location != LE_STREAM_LOCATION_ID_INTERNAL ||
+       font->bpp != LE_FONT_BPP_1 ||
+       (font->base.flags & LE_FONT_RIGHTTOLEFT) > 0 ||
+       req->lookupTable != NULL ||
+       req->alpha < 255 ||
+       len == 0)
+        return LE_FAILURE;
+
+    hash = hashString(req->str, len);
+
+    for(i = 0; i < LE_STRING_CACHE_ENTRIES; i++)
+    {
+        if(entryMatches(&_entries[i], req->str, (const leFont*)font, req->align, hash, len) == LE_TRUE)
+        {
+            entry = &_entries[i];
+
+            _stats.hits++;
+
+            break;
+        }
+    }
+
+    if(entry == NULL)
+    {
+        entry = addEntry(req->str, font, req->align, hash, len);
+
+        if(entry == NULL)
+            return LE_FAILURE;
+    }
+
+    entry->lastUse = ++_useCount;
+
+    rect = entry->rect;
+    rect.x += req->x;
+    rect.y += req->y;
+
+    if(leRenderer_CullDrawRect(&rect) == LE_TRUE)
+        return LE_SUCCESS;
+
+    leRenderer_ClipDrawRect(&rect, &clipRect);
+
+    colStart = clipRect.x - rect.x;
+    colEnd = colStart + clipRect.width;
+
+    mask = entry->data + ((entry->length * sizeof(leChar) + 3) & ~0x3u);
+
+    for(row = clipRect.y - rect.y; row < clipRect.y - rect.y + clipRect.height; row++)
+    {
+        leRenderer_PutMaskRow(rect.x,
+                              rect.y + row,
+                              mask + row * entry->rowBytes,
+                              colStart,
+                              colEnd,
+                              req->color);
+    }
+
+    return LE_SUCCESS;
+}
+
+void leStringCache_GetStats(leStringCacheStats* stats)
+{
+    *stats = _stats;
+}
+
+#endif /* LE_STRING_CACHE_ENABLED */
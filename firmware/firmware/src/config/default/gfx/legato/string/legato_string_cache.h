@@ -0,0 +1,128 @@
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2020 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+/*******************************************************************************
+ Module for Microchip Graphics Library - Legato User Interface Library
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    legato_string_cache.h
+
+  Summary:
+    Pre-rendered glyph masks of recently drawn strings
+
+  Description:
+    Strings drawn opaque with a 1bpp font are rendered once into a 1bpp mask
+    of the whole string.  Later draws of the same text, font and alignment
+    write the mask rows with the draw color instead of laying out and
+    drawing every glyph again.  Entries are keyed by their text so table,
+    fixed and dynamic strings share them and a changed string simply misses.
+    The masks are allocated with LE_MALLOC, which serves small ones from the
+    fixed heaps, and the least recently used ones are evicted to stay within
+    LE_STRING_CACHE_BUDGET bytes.
+*******************************************************************************/
+
+/** \file legato_string_cache.h
+* @brief Rendered string cache
+*
+* @details Keeps 1bpp masks of recently drawn strings.
+*/
+
+#ifndef LE_STRING_CACHE_H
+#define LE_STRING_CACHE_H
+
+#include "gfx/legato/string/legato_string_renderer.h"
+
+#if LE_STRING_CACHE_ENABLED == 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+/* Structure:
+    leStringCacheStats
+
+  Summary:
+    String cache statistics
+
+  Description:
+    hits - draws served from a cached mask
+    misses - masks rendered
+    evictions - masks freed to make room for another one
+    bytes - mask and text bytes currently cached
+*/
+typedef struct leStringCacheStats
+{
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t bytes;
+} leStringCacheStats;
+
+// *****************************************************************************
+/* Function:
+    leResult leStringCache_Draw(const leStringRenderRequest* req)
+
+  Summary:
+    Draws a string from its cached mask, rendering the mask if needed
+
+  Description:
+    Only opaque draws of left to right 1bpp fonts without a lookup table
+    are cached.  Strings with glyphs the font doesn't have and strings whose
+    mask is larger than the budget are not cached either.
+
+  Parameters:
+    const leStringRenderRequest* req - the draw request
+
+  Returns:
+    leResult - LE_FAILURE if the string must be drawn glyph by glyph
+*/
+leResult leStringCache_Draw(const leStringRenderRequest* req);
+
+// *****************************************************************************
+/* Function:
+    void leStringCache_GetStats(leStringCacheStats* stats)
+
+  Summary:
+    Copies out the cache statistics
+
+  Parameters:
+    leStringCacheStats* stats - the destination
+
+  Returns:
+    void
+*/
+void leStringCache_GetStats(leStringCacheStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LE_STRING_CACHE_ENABLED */
+
+#endif /* LE_STRING_CACHE_H */
@@ -26,6 +26,7 @@
 #include "gfx/legato/string/legato_string_renderer.h"
 
 #include "gfx/legato/string/legato_stringutils.h"
+#include "gfx/legato/string/legato_string_cache.h"
 
 #define ASCII_SPACE 0x20
 
@@ -178,6 +179,11 @@ leResult leStringRenderer_DrawString(leStringRenderRequest* req)
     else
     {
 #endif
+#if LE_STRING_CACHE_ENABLED == 1
+        if(leStringCache_Draw(req) == LE_SUCCESS)
+            return LE_SUCCESS;
+#endif
+
         return drawString(req);
 #if LE_STREAMING_ENABLED == 1
     }
@@ -35,6 +35,7 @@
 #include <string.h>
 
 #include "gfx/legato/image/legato_image.h"
+#include "gfx/legato/image/legato_image_cache.h"
 #include "gfx/legato/string/legato_string.h"
 #include "gfx/legato/common/legato_utils.h"
 #include "gfx/legato/memory/legato_memory.h"
@@ -91,6 +92,10 @@ void _leImageWidget_Constructor(leImageWidget* _this)
 
 void _leImageWidget_Destructor(leImageWidget* _this)
 {    
+#if LE_IMAGE_CACHE_ENABLED == 1
+    leImageCache_Release(_this);
+#endif
+
     _leWidget_Destructor((leWidget*)_this);
 }
 
@@ -142,6 +147,10 @@ leResult _leImageWidget_SetImage(leImageWidget* _this,
     if(_this->image != NULL)
         invalidateImageRect(_this);
 
+#if LE_IMAGE_CACHE_ENABLED == 1
+    leImageCache_Release(_this);
+#endif
+
     _this->image = imgAst;
 
     if(_this->image != NULL)
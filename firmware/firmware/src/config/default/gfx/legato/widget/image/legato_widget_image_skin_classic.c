@@ -31,6 +31,7 @@
 #include "gfx/legato/common/legato_utils.h"
 #include "gfx/legato/core/legato_state.h"
 #include "gfx/legato/image/legato_image.h"
+#include "gfx/legato/image/legato_image_cache.h"
 #include "gfx/legato/string/legato_string.h"
 #include "gfx/legato/renderer/legato_renderer.h"
 #include "gfx/legato/widget/legato_widget.h"
@@ -181,6 +182,17 @@ static void onImageStreamFinished(leStreamManager* dec)
 static void drawImage(leImageWidget* img)
 {
     leRect imgRect, imgSrcRect;
+    const leImage* image = img->image;
+
+#if LE_IMAGE_CACHE_ENABLED == 1
+    // draw the decoded copy when the image can be cached
+    image = leImageCache_Get(img, img->image);
+
+    if(image == NULL)
+    {
+        image = img->image;
+    }
+#endif
 
     imgSrcRect.x = 0;
     imgSrcRect.y = 0;
@@ -191,7 +203,7 @@ static void drawImage(leImageWidget* img)
     
     leUtils_RectToScreenSpace((leWidget*)img, &imgRect);
 
-    leImage_Draw(img->image,
+    leImage_Draw(image,
                  &imgSrcRect,
                  imgRect.x,
                  imgRect.y,
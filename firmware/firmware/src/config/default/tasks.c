@@ -74,22 +74,82 @@ static void lAPP_Tasks(  void *pvParameters  )
 #define TASK_BLE_STACK_SIZE (2 *1024 / sizeof(portSTACK_TYPE))
 #define TASK_BLE_PRIORITY (tskIDLE_PRIORITY + 3)
 
+/* a frame that can't finish, a scratch buffer or the display driver being
+   busy, is retried after this even if no completion wakes the task */
+#define LEGATO_RETRY_MS     10
+
+/* Handle for the _LEGATO_Tasks. */
+TaskHandle_t xLEGATO_Tasks;
+
+/* wakes the Legato task, called by the renderer when damage starts a frame
+   and by the display driver from the transfer interrupt when a blit is done */
+static void _LEGATO_Wake(void)
+{
+    BaseType_t woken = pdFALSE;
+
+    if(xLEGATO_Tasks == NULL)
+        return;
+
+    if(xPortIsInsideInterrupt() == pdTRUE)
+    {
+        vTaskNotifyGiveFromISR(xLEGATO_Tasks, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+    else
+    {
+        xTaskNotifyGive(xLEGATO_Tasks);
+    }
+}
+
 void _LEGATO_Tasks(  void *pvParameters  )
 {
+    gfxIOCTLArg_Value val;
+    TickType_t timeout;
+    uint32_t holdTime;
+
+    leRenderer_SetWakeCallback(_LEGATO_Wake);
+
+    val.value.v_pointer = (void*)_LEGATO_Wake;
+    gfxDriverInterface.ioctl(GFX_IOCTL_SET_BLIT_CALLBACK, &val);
+
     while(1)
     {
         Legato_Tasks();
-        vTaskDelay(10 / portTICK_PERIOD_MS);
+
+        /* nothing animates, an idle screen only changes when something
+           damages it or the frame rate limit releases queued changes */
+        if(leRenderer_IsIdle() == LE_FALSE)
+        {
+            timeout = LEGATO_RETRY_MS / portTICK_PERIOD_MS;
+        }
+        else if(leCommand_GetHoldTime(&holdTime) == LE_TRUE)
+        {
+            timeout = (holdTime + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+        }
+        else
+        {
+            timeout = portMAX_DELAY;
+        }
+
+        ulTaskNotifyTake(pdTRUE, timeout);
     }
 }
 
 void _SSD1351_Tasks(  void *pvParameters  )
 {
-    while(1)
+    gfxIOCTLArg_Value val;
+
+    /* the driver only has work to do until the controller is configured,
+       blits are sent from the Legato task and completed by interrupts */
+    do
     {
         DRV_SSD1351_Update();
         vTaskDelay(10 / portTICK_PERIOD_MS);
-    }
+
+        DRV_SSD1351_IOCTL(GFX_IOCTL_GET_STATUS, &val);
+    } while(val.value.v_uint != 0);
+
+    vTaskDelete(NULL);
 }
 
 
@@ -136,7 +196,7 @@ void SYS_Tasks ( void )
         1024,
         (void*)NULL,
         4,
-        (TaskHandle_t*)NULL
+        &xLEGATO_Tasks
     );
 
 
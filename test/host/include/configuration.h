@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/* Host build stand-in for the generated configuration.h. Only the values the
+   display code reads are defined. */
+
+#ifndef CONFIGURATION_H
+#define CONFIGURATION_H
+
+#include "toolchain_specifics.h"
+
+/* SPI Driver Instance 0 Configuration Options */
+#define DRV_SPI_INSTANCES_NUMBER              (1U)
+#define DRV_SPI_INDEX_0                       0
+#define DRV_SPI_CLIENTS_NUMBER_IDX0           1
+#define DRV_SPI_QUEUE_SIZE_IDX0               4
+
+/* SSD1351 Display Driver Configuration Options, a build can override them */
+#ifndef DRV_SSD1351_BLIT_NONBLOCKING
+#define DRV_SSD1351_BLIT_NONBLOCKING          1
+#endif
+#ifndef DRV_SSD1351_SHADOW_FRAMEBUFFER
+#define DRV_SSD1351_SHADOW_FRAMEBUFFER        1
+#endif
+#ifndef DRV_SSD1351_SHADOW_SPAN_COST
+#define DRV_SSD1351_SHADOW_SPAN_COST          8
+#endif
+
+/* TIME System Service Configuration Options */
+#define SYS_TIME_INDEX_0                      (0)
+
+#endif // CONFIGURATION_H
@@ -0,0 +1,50 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/* Host build stand-in for the generated definitions.h. It includes what the
+   application and the generated Legato code expect from it, with the display
+   driver chosen by the build: the SSD1351 driver over the mock SPI driver
+   when HOST_DISPLAY_SSD1351 is defined, the in-memory display otherwise. */
+
+#ifndef DEFINITIONS_H
+#define DEFINITIONS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include "system/time/sys_time.h"
+#include "driver/spi/drv_spi.h"
+#include "peripheral/sercom/usart/plib_sercom0_usart.h"
+#include "gfx/legato/generated/le_gen_harmony.h"
+#include "peripheral/gpio/plib_gpio.h"
+#ifdef HOST_DISPLAY_SSD1351
+#include "gfx/driver/controller/external_controller/drv_gfx_external_controller.h"
+#else
+#include "host_display.h"
+#endif
+#include "FreeRTOS.h"
+#include "task.h"
+#include "app.h"
+
+#endif // DEFINITIONS_H
@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/* Host build stand-in for the SPI driver API. The transfers are carried out
+   by mock/host_spi.c. Like the target header this pulls in the port pins,
+   which the display interface drives around its transfers. */
+
+#ifndef DRV_SPI_H
+#define DRV_SPI_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "peripheral/gpio/plib_gpio.h"
+
+typedef uintptr_t DRV_HANDLE;
+typedef uint16_t SYS_MODULE_INDEX;
+typedef uint32_t SYS_PORT_PIN;
+
+#define DRV_HANDLE_INVALID  (((DRV_HANDLE) -1))
+#define SYS_PORT_PIN_NONE   ((SYS_PORT_PIN)-1)
+
+typedef enum
+{
+    DRV_IO_INTENT_READ = 1,
+    DRV_IO_INTENT_WRITE = 2,
+    DRV_IO_INTENT_READWRITE = 3,
+} DRV_IO_INTENT;
+
+typedef uintptr_t DRV_SPI_TRANSFER_HANDLE;
+
+#define DRV_SPI_TRANSFER_HANDLE_INVALID  ((DRV_SPI_TRANSFER_HANDLE)(-1))
+
+typedef enum
+{
+    DRV_SPI_TRANSFER_EVENT_PENDING = 0,
+    DRV_SPI_TRANSFER_EVENT_COMPLETE = 1,
+    DRV_SPI_TRANSFER_EVENT_HANDLE_EXPIRED = 2,
+    DRV_SPI_TRANSFER_EVENT_ERROR = -1,
+    DRV_SPI_TRANSFER_EVENT_HANDLE_INVALID = -2
+} DRV_SPI_TRANSFER_EVENT;
+
+typedef enum
+{
+    DRV_SPI_CLOCK_PHASE_VALID_TRAILING_EDGE = 0,
+    DRV_SPI_CLOCK_PHASE_VALID_LEADING_EDGE = 1,
+} DRV_SPI_CLOCK_PHASE;
+
+typedef enum
+{
+    DRV_SPI_CLOCK_POLARITY_IDLE_LOW = 0,
+    DRV_SPI_CLOCK_POLARITY_IDLE_HIGH = 1,
+} DRV_SPI_CLOCK_POLARITY;
+
+typedef enum
+{
+    DRV_SPI_DATA_BITS_8 = 0,
+} DRV_SPI_DATA_BITS;
+
+typedef enum
+{
+    DRV_SPI_CS_POLARITY_ACTIVE_LOW = 0,
+    DRV_SPI_CS_POLARITY_ACTIVE_HIGH = 1
+} DRV_SPI_CS_POLARITY;
+
+typedef struct
+{
+    uint32_t                        baudRateInHz;
+    DRV_SPI_CLOCK_PHASE             clockPhase;
+    DRV_SPI_CLOCK_POLARITY          clockPolarity;
+    DRV_SPI_DATA_BITS               dataBits;
+    SYS_PORT_PIN                    chipSelect;
+    DRV_SPI_CS_POLARITY             csPolarity;
+} DRV_SPI_TRANSFER_SETUP;
+
+typedef void (*DRV_SPI_TRANSFER_EVENT_HANDLER)(DRV_SPI_TRANSFER_EVENT event,
+                                               DRV_SPI_TRANSFER_HANDLE transferHandle,
+                                               uintptr_t context);
+
+DRV_HANDLE DRV_SPI_Open(const SYS_MODULE_INDEX drvIndex, const DRV_IO_INTENT ioIntent);
+void DRV_SPI_Close(const DRV_HANDLE handle);
+bool DRV_SPI_TransferSetup(const DRV_HANDLE handle, DRV_SPI_TRANSFER_SETUP* setup);
+void DRV_SPI_TransferEventHandlerSet(const DRV_HANDLE handle,
+                                     const DRV_SPI_TRANSFER_EVENT_HANDLER eventHandler,
+                                     uintptr_t context);
+void DRV_SPI_WriteTransferAdd(const DRV_HANDLE handle,
+                              void* pTransmitData,
+                              size_t txSize,
+                              DRV_SPI_TRANSFER_HANDLE * const transferHandle);
+void DRV_SPI_ReadTransferAdd(const DRV_HANDLE handle,
+                             void* pReceiveData,
+                             size_t rxSize,
+                             DRV_SPI_TRANSFER_HANDLE * const transferHandle);
+
+#endif // DRV_SPI_H
@@ -0,0 +1,61 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/* Host build stand-in for the generated GPIO pin macros of the display
+   pins. The pin levels are kept by mock/host_gpio.c. */
+
+#ifndef PLIB_GPIO_H
+#define PLIB_GPIO_H
+
+#include <stdint.h>
+
+typedef enum
+{
+    HOST_PIN_CS,
+    HOST_PIN_RSDC,
+    HOST_PIN_RESET,
+    HOST_PIN_EN,
+    HOST_PIN_COUNT
+} HOST_PIN;
+
+void HOST_GPIO_Write(HOST_PIN pin, uint32_t value);
+uint32_t HOST_GPIO_Read(HOST_PIN pin);
+
+/*** Macros for GFX_DISP_INTF_PIN_CS pin ***/
+#define GFX_DISP_INTF_PIN_CS_Set()               HOST_GPIO_Write(HOST_PIN_CS, 1)
+#define GFX_DISP_INTF_PIN_CS_Clear()             HOST_GPIO_Write(HOST_PIN_CS, 0)
+#define GFX_DISP_INTF_PIN_CS_Get()               HOST_GPIO_Read(HOST_PIN_CS)
+/*** Macros for GFX_DISP_INTF_PIN_RSDC pin ***/
+#define GFX_DISP_INTF_PIN_RSDC_Set()             HOST_GPIO_Write(HOST_PIN_RSDC, 1)
+#define GFX_DISP_INTF_PIN_RSDC_Clear()           HOST_GPIO_Write(HOST_PIN_RSDC, 0)
+#define GFX_DISP_INTF_PIN_RSDC_Get()             HOST_GPIO_Read(HOST_PIN_RSDC)
+/*** Macros for GFX_DISP_INTF_PIN_RESET pin ***/
+#define GFX_DISP_INTF_PIN_RESET_Set()            HOST_GPIO_Write(HOST_PIN_RESET, 1)
+#define GFX_DISP_INTF_PIN_RESET_Clear()          HOST_GPIO_Write(HOST_PIN_RESET, 0)
+#define GFX_DISP_INTF_PIN_RESET_Get()            HOST_GPIO_Read(HOST_PIN_RESET)
+/*** Macros for GFX_DISP_INTF_PIN_EN pin ***/
+#define GFX_DISP_INTF_PIN_EN_Set()               HOST_GPIO_Write(HOST_PIN_EN, 1)
+#define GFX_DISP_INTF_PIN_EN_Clear()             HOST_GPIO_Write(HOST_PIN_EN, 0)
+#define GFX_DISP_INTF_PIN_EN_Get()               HOST_GPIO_Read(HOST_PIN_EN)
+
+#endif // PLIB_GPIO_H
@@ -0,0 +1,306 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  Legato Host Runner
+
+  File Name:
+    le_host.c
+
+  Summary:
+    Replays display traces through the application on the host.
+
+  Description:
+    Runs Screen0, oled_c.c and the Legato library against the mock display
+    and prints what it took to keep the display up to date: frames, blits,
+    pixels and SSD1351 wire bytes, or with HOST_DISPLAY_SSD1351 the SPI
+    transfers, bytes and wire time the real driver needed, Legato task wakeups, command queue and
+    string cache counters, and the CPU time of the whole run.
+
+    A trace is a text file with one event per line:
+
+        <ms> <line> <text>
+
+    posts <text> to display line <line> (1 or 2) at <ms> milliseconds, the
+    way the BLE handlers do. Blank lines and lines starting with # are
+    skipped. --burst posts count line 2 updates one millisecond apart
+    instead, the case the update rate limit is there for.
+
+    le_host [--trace file] [--burst count] [--png file] [--png-dir dir]
+            [--echo]
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "definitions.h"
+#include "host_app.h"
+#include "host_png.h"
+#include "host_rtos.h"
+#ifdef HOST_DISPLAY_SSD1351
+#include "host_spi.h"
+#endif
+
+#define TRACE_LINE_SIZE     300
+
+/* how long the display gets to settle after the last event */
+#define SETTLE_MS           1000
+
+static const char* pngDir;
+static uint32_t pngCount;
+
+/* what reached the display since the last reset */
+static void printDisplay(const char* label)
+{
+#ifdef HOST_DISPLAY_SSD1351
+    HOST_SPI_STATS spi;
+    gfxIOCTLArg_TransferStats xfer;
+
+    HOST_SPI_GetStats(&spi);
+    DRV_SSD1351_IOCTL(GFX_IOCTL_GET_TRANSFER_STATS, &xfer);
+
+    printf("%s %u transfers, %u command bytes, %u data bytes, %u windows, %u pixels, %.3f ms on the wire\n",
+           label,
+           (unsigned)spi.transfers,
+           (unsigned)spi.commandBytes,
+           (unsigned)spi.dataBytes,
+           (unsigned)spi.windows,
+           (unsigned)spi.pixels,
+           (double)spi.wireNs / 1000000.0);
+    printf("driver:  %u pixel bytes sent, %u skipped, %u blits skipped since startup, %u pin violations\n",
+           (unsigned)xfer.bytesSent,
+           (unsigned)xfer.bytesSkipped,
+           (unsigned)xfer.blitsSkipped,
+           (unsigned)spi.violations);
+#else
+    HOST_DISPLAY_STATS display;
+
+    HOST_Display_GetStats(&display);
+
+    printf("%s %u frames, %u blits, %u pixels, %u bytes\n",
+           label,
+           (unsigned)display.frames,
+           (unsigned)display.blits,
+           (unsigned)display.pixels,
+           (unsigned)display.bytes);
+#endif
+}
+
+static void resetDisplay(void)
+{
+#ifdef HOST_DISPLAY_SSD1351
+    HOST_SPI_ResetStats();
+#else
+    HOST_Display_ResetStats();
+#endif
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: le_host [--trace file] [--burst count] [--png file]\n"
+            "               [--png-dir dir] [--echo]\n");
+
+    exit(2);
+}
+
+/* runs until the time of the next event, dumping a frame after each change
+   when asked to */
+static void runTo(uint32_t ms)
+{
+    char path[512];
+
+    while(HOST_RTOS_Milliseconds() < ms)
+    {
+        if(HOST_APP_IsIdle() == true)
+        {
+            HOST_RTOS_Advance(ms - HOST_RTOS_Milliseconds());
+            break;
+        }
+
+        HOST_APP_RunUntilIdle(ms - HOST_RTOS_Milliseconds());
+
+        if(pngDir != NULL && HOST_APP_IsIdle() == true)
+        {
+            snprintf(path, sizeof(path), "%s/frame%04u.png", pngDir, (unsigned)pngCount++);
+
+            if(HOST_PNG_Write(path, HOST_APP_Frame(), HOST_APP_WIDTH, HOST_APP_HEIGHT) != 0)
+            {
+                fprintf(stderr, "le_host: can't write %s\n", path);
+                exit(1);
+            }
+        }
+    }
+}
+
+static uint32_t replayTrace(const char* path)
+{
+    char buf[TRACE_LINE_SIZE];
+    FILE* file = fopen(path, "r");
+    uint32_t events = 0;
+    uint32_t lineNumber = 0;
+    unsigned long ms;
+    unsigned line;
+    int text;
+
+    if(file == NULL)
+    {
+        fprintf(stderr, "le_host: can't open %s\n", path);
+        exit(1);
+    }
+
+    while(fgets(buf, sizeof(buf), file) != NULL)
+    {
+        lineNumber++;
+
+        buf[strcspn(buf, "\r\n")] = '\0';
+
+        if(buf[strspn(buf, " \t")] == '\0' || buf[0] == '#')
+            continue;
+
+        text = -1;
+
+        /* the text starts after one space, the status texts are padded */
+        if(sscanf(buf, "%lu %u%n", &ms, &line, &text) < 2 || text < 0 || buf[text] != ' ')
+        {
+            fprintf(stderr, "%s:%u: expected <ms> <line> <text>\n", path, (unsigned)lineNumber);
+            exit(1);
+        }
+
+        runTo(ms);
+
+        if(HOST_APP_BleText(line, buf + text + 1) == false)
+        {
+            fprintf(stderr, "%s:%u: application queue full\n", path, (unsigned)lineNumber);
+        }
+
+        events++;
+    }
+
+    fclose(file);
+
+    return events;
+}
+
+static uint32_t replayBurst(uint32_t count)
+{
+    char text[32];
+    uint32_t i;
+
+    for(i = 0; i < count; i++)
+    {
+        snprintf(text, sizeof(text), "value %u", (unsigned)i);
+
+        HOST_APP_BleText(2, text);
+        HOST_APP_Run(1);
+    }
+
+    return count;
+}
+
+int main(int argc, char* argv[])
+{
+    const char* tracePath = NULL;
+    const char* pngPath = NULL;
+    uint32_t burst = 0;
+    uint32_t events = 0;
+    uint32_t start;
+    HOST_APP_STATS app;
+    leCommandStats command;
+    leStringCacheStats cache;
+    clock_t cpu;
+    int i;
+
+    for(i = 1; i < argc; i++)
+    {
+        if(strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+            tracePath = argv[++i];
+        else if(strcmp(argv[i], "--burst") == 0 && i + 1 < argc)
+            burst = strtoul(argv[++i], NULL, 0);
+        else if(strcmp(argv[i], "--png") == 0 && i + 1 < argc)
+            pngPath = argv[++i];
+        else if(strcmp(argv[i], "--png-dir") == 0 && i + 1 < argc)
+            pngDir = argv[++i];
+        else if(strcmp(argv[i], "--echo") == 0)
+            HOST_RTOS_SetEcho(true);
+        else
+            usage();
+    }
+
+    cpu = clock();
+
+    HOST_APP_Initialize();
+
+    printf("startup: %u ms\n", (unsigned)HOST_RTOS_Milliseconds());
+    printDisplay("         ");
+
+    resetDisplay();
+    HOST_APP_ResetStats();
+
+    start = HOST_RTOS_Milliseconds();
+
+    if(tracePath != NULL)
+    {
+        events = replayTrace(tracePath);
+    }
+    else if(burst > 0)
+    {
+        events = replayBurst(burst);
+    }
+
+    runTo(HOST_RTOS_Milliseconds() + SETTLE_MS);
+
+    cpu = clock() - cpu;
+
+    HOST_APP_GetStats(&app);
+    leCommand_GetStats(&command);
+    leStringCache_GetStats(&cache);
+
+    printf("events:  %u in %u ms\n", (unsigned)events, (unsigned)(HOST_RTOS_Milliseconds() - start));
+    printDisplay("display:");
+    printf("legato:  %u wakeups, %u messages\n", (unsigned)app.wakeups, (unsigned)app.messages);
+    printf("command: %u queued, %u full, %u merged, %u applied, %u batches\n",
+           (unsigned)command.queued,
+           (unsigned)command.full,
+           (unsigned)command.merged,
+           (unsigned)command.applied,
+           (unsigned)command.batches);
+    printf("strings: %u hits, %u misses, %u evictions, %u bytes\n",
+           (unsigned)cache.hits,
+           (unsigned)cache.misses,
+           (unsigned)cache.evictions,
+           (unsigned)cache.bytes);
+    printf("cpu:     %.3f ms\n", (double)cpu * 1000.0 / CLOCKS_PER_SEC);
+
+    if(pngPath != NULL &&
+       HOST_PNG_Write(pngPath, HOST_APP_Frame(), HOST_APP_WIDTH, HOST_APP_HEIGHT) != 0)
+    {
+        fprintf(stderr, "le_host: can't write %s\n", pngPath);
+
+        return 1;
+    }
+
+    return 0;
+}
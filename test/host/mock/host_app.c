@@ -0,0 +1,425 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  Host Application Source File
+
+  File Name:
+    host_app.c
+
+  Summary:
+    Runs the display side of the application on the host.
+
+  Description:
+    See host_app.h. Time only moves in HOST_APP_Run, one millisecond at a
+    time. Every millisecond the application task takes what is queued, then
+    the Legato task runs as long as it has been woken or its timeout has
+    passed. A task delay inside the application, oled_c.c waiting for room
+    in the Legato command queue, runs the Legato task for the delay.
+
+    With a CPU scale set, the millisecond is cut into slices. A pass of the
+    Legato task keeps it busy for its scaled CPU time, and the SPI mock
+    moves on slice by slice meanwhile, so the next pass starts only once
+    the time charged for the last one has passed. What the pass sends is
+    held back until as much of that time has passed as the pass had taken
+    when it added its first transfer.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "definitions.h"
+#include "click_routines/oled_c/oled_c.h"
+#include "host_app.h"
+#include "host_gpio.h"
+#include "host_rtos.h"
+#ifdef HOST_DISPLAY_SSD1351
+#include "host_spi.h"
+#endif
+
+/* as in tasks.c */
+#define LEGATO_RETRY_MS     10
+
+/* runs of the Legato task without time passing before it counts as stuck */
+#define LEGATO_RUN_LIMIT    10000
+
+/* slice of a millisecond with a CPU scale set */
+#define CHARGE_SLICE_US     10
+#define CHARGE_SLICE_NS     (CHARGE_SLICE_US * 1000u)
+
+APP_DATA appData;
+
+static bool legatoNotified;
+static uint32_t legatoTimeout;
+static uint32_t legatoWaitStart;
+static HOST_APP_STATS stats;
+static uint32_t cpuScale;
+static uint64_t legatoBusyNs;   // left of the running pass
+static uint64_t legatoHoldNs;   // left until what the pass sends may start
+static uint64_t legatoSendNs;   // CPU time the pass added its first transfer at
+
+/* _LEGATO_Wake */
+static void HOST_APP_LegatoWake(void)
+{
+    legatoNotified = true;
+}
+
+/* one pass of the _LEGATO_Tasks loop, up to its ulTaskNotifyTake */
+static void HOST_APP_LegatoTask(void)
+{
+    uint32_t holdTime;
+
+    Legato_Tasks();
+
+    if(leRenderer_IsIdle() == LE_FALSE)
+    {
+        legatoTimeout = LEGATO_RETRY_MS;
+    }
+    else if(leCommand_GetHoldTime(&holdTime) == LE_TRUE)
+    {
+        legatoTimeout = holdTime;
+    }
+    else
+    {
+        legatoTimeout = portMAX_DELAY;
+    }
+
+    legatoWaitStart = HOST_RTOS_Milliseconds();
+    stats.wakeups++;
+}
+
+static bool HOST_APP_LegatoReady(void)
+{
+    if(legatoNotified == true)
+        return true;
+
+    return legatoTimeout != portMAX_DELAY &&
+           HOST_RTOS_Milliseconds() - legatoWaitStart >= legatoTimeout;
+}
+
+static void HOST_APP_LegatoRun(void)
+{
+    uint32_t runs = 0;
+
+    while(HOST_APP_LegatoReady() == true)
+    {
+        legatoNotified = false;
+
+        HOST_APP_LegatoTask();
+
+        if(++runs == LEGATO_RUN_LIMIT)
+        {
+            fprintf(stderr, "host: Legato task keeps waking itself at %u ms\n",
+                    (unsigned)HOST_RTOS_Milliseconds());
+
+            exit(1);
+        }
+    }
+}
+
+static uint64_t HOST_APP_CpuNs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+#ifdef HOST_DISPLAY_SSD1351
+/* the first transfer of a pass, the time it is added at is when it may
+   start on the wire */
+static void HOST_APP_TransferAdded(void)
+{
+    if(legatoSendNs == 0)
+    {
+        legatoSendNs = HOST_APP_CpuNs();
+    }
+}
+#endif
+
+/* one pass of the Legato task, busy for scale times its CPU time */
+static void HOST_APP_LegatoCharged(void)
+{
+    uint64_t start, end;
+
+    legatoNotified = false;
+    legatoSendNs = 0;
+
+#ifdef HOST_DISPLAY_SSD1351
+    HOST_SPI_Hold(true);
+#endif
+
+    start = HOST_APP_CpuNs();
+    HOST_APP_LegatoTask();
+    end = HOST_APP_CpuNs();
+
+    legatoBusyNs = (end - start) * cpuScale;
+    legatoHoldNs = legatoSendNs != 0 ? (legatoSendNs - start) * cpuScale : legatoBusyNs;
+}
+
+/* one millisecond with the Legato task charged for its time */
+static void HOST_APP_RunCharged(void)
+{
+    uint32_t us;
+    uint64_t budget, spent;
+    bool sending = false;
+
+    for(us = 0; us < 1000; us += CHARGE_SLICE_US)
+    {
+#ifdef HOST_DISPLAY_SSD1351
+        sending = HOST_SPI_IsSending();
+#endif
+        budget = CHARGE_SLICE_NS;
+
+        while(budget > 0)
+        {
+            if(legatoBusyNs == 0)
+            {
+                if(HOST_APP_LegatoReady() == false)
+                    break;
+
+                HOST_APP_LegatoCharged();
+            }
+
+            spent = legatoBusyNs < budget ? legatoBusyNs : budget;
+
+            /* stop where the pass sends so the transfers start there */
+            if(legatoHoldNs > 0 && legatoHoldNs < spent)
+            {
+                spent = legatoHoldNs;
+            }
+
+            legatoBusyNs -= spent;
+            legatoHoldNs -= legatoHoldNs < spent ? legatoHoldNs : spent;
+            budget -= spent;
+
+            stats.legatoNs += spent;
+
+            if(sending == true)
+            {
+                stats.overlapNs += spent;
+            }
+
+#ifdef HOST_DISPLAY_SSD1351
+            if(legatoHoldNs == 0)
+            {
+                HOST_SPI_Hold(false);
+            }
+#endif
+        }
+
+        stats.activeNs += sending == true ? CHARGE_SLICE_NS : CHARGE_SLICE_NS - budget;
+
+#ifdef HOST_DISPLAY_SSD1351
+        HOST_SPI_Run(CHARGE_SLICE_US);
+#endif
+    }
+}
+
+/* a task delay of the application, the Legato task runs meanwhile */
+static void HOST_APP_Delay(uint32_t ms)
+{
+    while(ms-- > 0)
+    {
+#ifdef HOST_DISPLAY_SSD1351
+        HOST_SPI_Run(1000);
+#endif
+        HOST_APP_LegatoRun();
+        HOST_RTOS_Advance(1);
+    }
+}
+
+/* the OLED part of APP_Tasks in the service state */
+static void HOST_APP_Tasks(void)
+{
+    APP_Msg_T appMsg;
+
+    while(OSAL_QUEUE_Receive(&appData.appQueue, &appMsg, 0) == OSAL_RESULT_TRUE)
+    {
+        stats.messages++;
+
+        if(appMsg.msgId == APP_MSG_OLEDC_EVT)
+        {
+            APP_OLEDC_Handler(appMsg.msgData);
+        }
+        else if(appMsg.msgId == APP_MSG_BLE_DISPLAY_EVT)
+        {
+            oled_c_Image_mchplogo_visible();
+            LCD_PRINT(0, appMsg.msgData[BLE_DATA_LINE], &appMsg.msgData[BLE_DATA]);
+        }
+    }
+}
+
+void HOST_APP_Initialize(void)
+{
+    gfxIOCTLArg_Value val;
+
+    HOST_GPIO_Reset();
+
+    /* SYS_Initialize */
+#ifdef HOST_DISPLAY_SSD1351
+    HOST_SPI_Reset();
+    DRV_SSD1351_Initialize();
+#else
+    HOST_Display_Reset();
+#endif
+
+    Legato_Initialize();
+
+    /* APP_Initialize */
+    OSAL_QUEUE_Create(&appData.appQueue, 64, sizeof(APP_Msg_T));
+#ifdef HOST_DISPLAY_SSD1351
+    leRenderer_SetGPUInterface(&gfxSSD1351GPUInterface);
+#endif
+    leCommand_SetClock(HOST_RTOS_Milliseconds);
+
+    /* _LEGATO_Tasks */
+    leRenderer_SetWakeCallback(HOST_APP_LegatoWake);
+
+    val.value.v_pointer = (void*)HOST_APP_LegatoWake;
+    gfxDriverInterface.ioctl(GFX_IOCTL_SET_BLIT_CALLBACK, &val);
+
+    legatoNotified = true;
+
+    HOST_RTOS_SetDelayHook(HOST_APP_Delay);
+
+#ifdef HOST_DISPLAY_SSD1351
+    /* _SSD1351_Tasks */
+    do
+    {
+        DRV_SSD1351_Update();
+        vTaskDelay(10 / portTICK_PERIOD_MS);
+
+        DRV_SSD1351_IOCTL(GFX_IOCTL_GET_STATUS, &val);
+    } while(val.value.v_uint != 0);
+
+    /* from here on transfers take their time on the wire, a blit that
+       waits for one by polling never returns */
+    HOST_SPI_SetMode(HOST_SPI_TIMED);
+#endif
+
+    /* APP_Tasks in APP_STATE_LCD_INIT */
+    LCD_INIT();
+    appData.state = APP_STATE_SERVICE_TASKS;
+
+    HOST_APP_RunUntilIdle(1000);
+}
+
+void HOST_APP_SetCpuScale(uint32_t scale)
+{
+    cpuScale = scale;
+
+#ifdef HOST_DISPLAY_SSD1351
+    HOST_SPI_SetAddHook(scale > 0 ? HOST_APP_TransferAdded : NULL);
+#endif
+}
+
+void HOST_APP_Run(uint32_t ms)
+{
+    while(ms-- > 0)
+    {
+        if(cpuScale > 0)
+        {
+            HOST_APP_Tasks();
+            HOST_APP_RunCharged();
+            HOST_RTOS_Advance(1);
+
+            continue;
+        }
+
+#ifdef HOST_DISPLAY_SSD1351
+        HOST_SPI_Run(1000);
+#endif
+        HOST_APP_Tasks();
+        HOST_APP_LegatoRun();
+        HOST_RTOS_Advance(1);
+    }
+}
+
+bool HOST_APP_IsIdle(void)
+{
+    uint32_t holdTime;
+
+    return HOST_RTOS_QueueCount(appData.appQueue) == 0 &&
+#ifdef HOST_DISPLAY_SSD1351
+           HOST_SPI_IsIdle() == true &&
+#endif
+           legatoNotified == false &&
+           legatoBusyNs == 0 &&
+           leRenderer_IsIdle() == LE_TRUE &&
+           leCommand_GetHoldTime(&holdTime) == LE_FALSE;
+}
+
+uint32_t HOST_APP_RunUntilIdle(uint32_t maxMs)
+{
+    uint32_t ms = 0;
+
+    while(ms < maxMs && HOST_APP_IsIdle() == false)
+    {
+        HOST_APP_Run(1);
+        ms++;
+    }
+
+    return ms;
+}
+
+bool HOST_APP_BleText(uint8_t line, const char* text)
+{
+    APP_Msg_T appMsg;
+    size_t len = strlen(text);
+
+    /* the BLE handlers copy at most what fits a message */
+    if(len > sizeof(appMsg.msgData) - BLE_DATA - 1)
+    {
+        len = sizeof(appMsg.msgData) - BLE_DATA - 1;
+    }
+
+    appMsg.msgId = APP_MSG_BLE_DISPLAY_EVT;
+    appMsg.msgData[BLE_DATA_LINE] = line;
+    memcpy(&appMsg.msgData[BLE_DATA], text, len);
+    appMsg.msgData[BLE_DATA + len] = '\0';
+
+    return OSAL_QUEUE_Send(&appData.appQueue, &appMsg, 0) == OSAL_RESULT_TRUE;
+}
+
+const uint16_t* HOST_APP_Frame(void)
+{
+#ifdef HOST_DISPLAY_SSD1351
+    return HOST_SPI_Panel();
+#else
+    return HOST_Display_Frame();
+#endif
+}
+
+void HOST_APP_GetStats(HOST_APP_STATS* out)
+{
+    *out = stats;
+}
+
+void HOST_APP_ResetStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  Host Application Header File
+
+  File Name:
+    host_app.h
+
+  Summary:
+    Runs the display side of the application on the host.
+
+  Description:
+    Does what SYS_Initialize, the tasks in tasks.c and the OLED part of
+    APP_Tasks do on the target, for the Legato code, oled_c.c and the display
+    driver. Built with HOST_DISPLAY_SSD1351 the display is the SSD1351 driver
+    over the mock SPI driver of host_spi.c, otherwise the mock display of
+    host_display.c. The Legato task is modeled on _LEGATO_Tasks: it runs when the
+    renderer or the display driver wakes it or when its timeout expires, and
+    every run is counted as a wakeup. BLE events come in through
+    HOST_APP_BleText, as the BLE handlers would post them.
+*******************************************************************************/
+
+#ifndef HOST_APP_H
+#define HOST_APP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HOST_APP_WIDTH      96
+#define HOST_APP_HEIGHT     96
+
+typedef struct
+{
+    uint32_t wakeups;   // runs of the Legato task loop
+    uint32_t messages;  // application messages handled
+    uint64_t legatoNs;  // Legato task time charged, see HOST_APP_SetCpuScale
+    uint64_t overlapNs; // of that, time with a transfer on the wire
+    uint64_t activeNs;  // time with the Legato task or the SPI mock busy
+} HOST_APP_STATS;
+
+/* initializes the display driver, Legato and the OLED application, and runs
+   the system until the first screen is on the display */
+void HOST_APP_Initialize(void);
+
+/* charges every pass of the Legato task scale times the host CPU time it
+   took on the virtual clock, so drawing takes time while transfers go on.
+   Milliseconds are then run in 10 us slices. 0, the default, makes the
+   task take no time */
+void HOST_APP_SetCpuScale(uint32_t scale);
+
+/* runs the system for ms virtual milliseconds */
+void HOST_APP_Run(uint32_t ms);
+
+/* runs the system until nothing is queued, held or being drawn, or maxMs
+   has passed. Returns the milliseconds it ran for */
+uint32_t HOST_APP_RunUntilIdle(uint32_t maxMs);
+
+/* true if nothing is queued, held, being drawn or being sent */
+bool HOST_APP_IsIdle(void);
+
+/* posts a text line the way the BLE handlers do, line 1 is the connection
+   status and line 2 the received data */
+bool HOST_APP_BleText(uint8_t line, const char* text);
+
+/* what the display shows, RGB565 in CPU byte order, row after row. With
+   HOST_DISPLAY_SSD1351 this is read back from the controller model */
+const uint16_t* HOST_APP_Frame(void);
+
+void HOST_APP_GetStats(HOST_APP_STATS* stats);
+void HOST_APP_ResetStats(void);
+
+#endif // HOST_APP_H
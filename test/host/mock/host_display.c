@@ -0,0 +1,248 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  Host Display Driver Source File
+
+  File Name:
+    host_display.c
+
+  Summary:
+    A gfxDisplayDriver that draws into a 96x96 RGB565 frame buffer in memory.
+
+  Description:
+    See host_display.h.
+*******************************************************************************/
+
+#include "host_display.h"
+
+#include <string.h>
+
+#define HOST_DISPLAY_WINDOW_BYTES   7
+#define HOST_DISPLAY_PALETTE_SIZE   256
+
+static uint16_t frame[HOST_DISPLAY_HEIGHT][HOST_DISPLAY_WIDTH];
+static uint16_t palette[HOST_DISPLAY_PALETTE_SIZE];
+static HOST_DISPLAY_STATS stats;
+static uint32_t refuse;
+static gfxBlitCallBack blitCallback;
+
+/* reads a pixel the way the SSD1351 driver expands it, indexed pixels are
+   packed most significant bits first */
+static uint16_t HOST_Display_Pixel(const gfxPixelBuffer* buf, int32_t x, int32_t y)
+{
+    uint32_t idx = y * buf->size.width + x;
+    const uint8_t* bytes = (const uint8_t*)buf->pixels;
+    uint16_t clr;
+
+    switch(buf->mode)
+    {
+        case GFX_COLOR_MODE_INDEX_1:
+            return palette[(bytes[idx >> 3] >> (7 - (idx & 0x7))) & 0x1];
+        case GFX_COLOR_MODE_INDEX_4:
+            return palette[(bytes[idx >> 1] >> ((idx & 0x1) ? 0 : 4)) & 0xF];
+        case GFX_COLOR_MODE_INDEX_8:
+            return palette[bytes[idx]];
+        case GFX_COLOR_MODE_RGB_565:
+        {
+            clr = ((const uint16_t*)buf->pixels)[idx];
+
+            if((buf->flags & GFX_BF_BIG_ENDIAN) > 0)
+            {
+                clr = (uint16_t)((clr >> 8) | (clr << 8));
+            }
+
+            return clr;
+        }
+        default:
+            return (uint16_t)gfxColorConvert(buf->mode,
+                                             GFX_COLOR_MODE_RGB_565,
+                                             gfxPixelBufferGet_Unsafe(buf, x, y));
+    }
+}
+
+static void HOST_Display_Update(void)
+{
+}
+
+static gfxResult HOST_Display_BlitBuffer(int32_t x,
+                                         int32_t y,
+                                         gfxPixelBuffer* buf)
+{
+    int32_t row, col;
+
+    if(refuse > 0)
+    {
+        refuse--;
+        stats.blitsRefused++;
+
+        return GFX_FAILURE;
+    }
+
+    for(row = 0; row < buf->size.height; row++)
+    {
+        for(col = 0; col < buf->size.width; col++)
+        {
+            if(x + col < 0 || x + col >= HOST_DISPLAY_WIDTH ||
+               y + row < 0 || y + row >= HOST_DISPLAY_HEIGHT)
+                continue;
+
+            frame[y + row][x + col] = HOST_Display_Pixel(buf, col, row);
+        }
+    }
+
+    stats.blits++;
+    stats.pixels += buf->size.width * buf->size.height;
+    stats.bytes += HOST_DISPLAY_WINDOW_BYTES + buf->size.width * buf->size.height * 2;
+
+    if(blitCallback != NULL)
+    {
+        blitCallback();
+    }
+
+    return GFX_SUCCESS;
+}
+
+static gfxDriverIOCTLResponse HOST_Display_IOCTL(gfxDriverIOCTLRequest request,
+                                                 void* arg)
+{
+    gfxIOCTLArg_Value* val = (gfxIOCTLArg_Value*)arg;
+    gfxIOCTLArg_DisplaySize* disp;
+    gfxIOCTLArg_LayerRect* rect;
+    gfxIOCTLArg_TransferStats* transfer;
+    gfxIOCTLArg_Palette* pal;
+    gfxColor clr;
+    uint32_t i;
+
+    switch(request)
+    {
+        case GFX_IOCTL_FRAME_START:
+        case GFX_IOCTL_SET_ACTIVE_LAYER:
+        case GFX_IOCTL_LAYER_SWAP:
+            return GFX_IOCTL_OK;
+        case GFX_IOCTL_FRAME_END:
+            stats.frames++;
+            return GFX_IOCTL_OK;
+        case GFX_IOCTL_GET_COLOR_MODE:
+            val->value.v_colormode = GFX_COLOR_MODE_RGB_565;
+            return GFX_IOCTL_OK;
+        case GFX_IOCTL_GET_BUFFER_COUNT:
+        case GFX_IOCTL_GET_LAYER_COUNT:
+            val->value.v_uint = 1;
+            return GFX_IOCTL_OK;
+        case GFX_IOCTL_GET_ACTIVE_LAYER:
+        case GFX_IOCTL_GET_STATUS:
+            val->value.v_uint = 0;
+            return GFX_IOCTL_OK;
+        case GFX_IOCTL_GET_VSYNC_COUNT:
+            val->value.v_uint = stats.frames;
+            return GFX_IOCTL_OK;
+        case GFX_IOCTL_GET_DISPLAY_SIZE:
+        {
+            disp = (gfxIOCTLArg_DisplaySize*)arg;
+            disp->width = HOST_DISPLAY_WIDTH;
+            disp->height = HOST_DISPLAY_HEIGHT;
+            return GFX_IOCTL_OK;
+        }
+        case GFX_IOCTL_GET_LAYER_RECT:
+        {
+            rect = (gfxIOCTLArg_LayerRect*)arg;
+            rect->layer.id = 0;
+            rect->x = 0;
+            rect->y = 0;
+            rect->width = HOST_DISPLAY_WIDTH;
+            rect->height = HOST_DISPLAY_HEIGHT;
+            return GFX_IOCTL_OK;
+        }
+        case GFX_IOCTL_GET_TRANSFER_STATS:
+        {
+            transfer = (gfxIOCTLArg_TransferStats*)arg;
+            transfer->bytesSent = stats.pixels * 2;
+            transfer->bytesSkipped = 0;
+            transfer->blitsSkipped = 0;
+            return GFX_IOCTL_OK;
+        }
+        case GFX_IOCTL_SET_PALETTE:
+        {
+            pal = (gfxIOCTLArg_Palette*)arg;
+
+            if(pal->colorCount > HOST_DISPLAY_PALETTE_SIZE)
+                return GFX_IOCTL_ERROR_UNKNOWN;
+
+            for(i = 0; i < pal->colorCount; i++)
+            {
+                clr = 0;
+
+                memcpy(&clr,
+                       (uint8_t*)pal->palette + i * gfxColorInfoTable[pal->mode].size,
+                       gfxColorInfoTable[pal->mode].size);
+
+                palette[i] = (uint16_t)gfxColorConvert(pal->mode, GFX_COLOR_MODE_RGB_565, clr);
+            }
+
+            return GFX_IOCTL_OK;
+        }
+        case GFX_IOCTL_SET_BLIT_CALLBACK:
+            blitCallback = (gfxBlitCallBack)val->value.v_pointer;
+            return GFX_IOCTL_OK;
+        default:
+            break;
+    }
+
+    return GFX_IOCTL_UNSUPPORTED;
+}
+
+const gfxDisplayDriver gfxDriverInterface =
+{
+    .update = HOST_Display_Update,
+    .blitBuffer = HOST_Display_BlitBuffer,
+    .ioctl = HOST_Display_IOCTL,
+};
+
+void HOST_Display_Reset(void)
+{
+    memset(frame, 0, sizeof(frame));
+    memset(palette, 0, sizeof(palette));
+    memset(&stats, 0, sizeof(stats));
+    refuse = 0;
+}
+
+const uint16_t* HOST_Display_Frame(void)
+{
+    return &frame[0][0];
+}
+
+void HOST_Display_GetStats(HOST_DISPLAY_STATS* out)
+{
+    *out = stats;
+}
+
+void HOST_Display_ResetStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void HOST_Display_RefuseBlits(uint32_t count)
+{
+    refuse = count;
+}
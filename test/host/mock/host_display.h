@@ -0,0 +1,73 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  Host Display Driver Header File
+
+  File Name:
+    host_display.h
+
+  Summary:
+    A gfxDisplayDriver that draws into a 96x96 RGB565 frame buffer in memory.
+
+  Description:
+    Stands in for the SSD1351 driver on the host. Blits complete immediately
+    and are counted. The byte counter uses the cost of the SSD1351 wire
+    format, a 7 byte window setup plus two bytes per pixel, so the numbers
+    compare with what the panel would be sent without the driver's shadow.
+*******************************************************************************/
+
+#ifndef HOST_DISPLAY_H
+#define HOST_DISPLAY_H
+
+#include <stdint.h>
+
+#include "gfx/driver/gfx_driver.h"
+
+#define HOST_DISPLAY_WIDTH      96
+#define HOST_DISPLAY_HEIGHT     96
+
+typedef struct
+{
+    uint32_t blits;         // blits accepted
+    uint32_t blitsRefused;  // blits failed on request, see HOST_Display_RefuseBlits
+    uint32_t pixels;        // pixels blitted
+    uint32_t bytes;         // SSD1351 wire bytes the blits would take
+    uint32_t frames;        // GFX_IOCTL_FRAME_END calls
+} HOST_DISPLAY_STATS;
+
+extern const gfxDisplayDriver gfxDriverInterface;
+
+/* clears the frame buffer, the palette and the counters */
+void HOST_Display_Reset(void);
+
+/* the frame buffer, RGB565 in CPU byte order, row after row */
+const uint16_t* HOST_Display_Frame(void);
+
+void HOST_Display_GetStats(HOST_DISPLAY_STATS* stats);
+void HOST_Display_ResetStats(void);
+
+/* fails the next count blits the way a busy driver does */
+void HOST_Display_RefuseBlits(uint32_t count);
+
+#endif // HOST_DISPLAY_H
@@ -0,0 +1,80 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  Host GPIO Source File
+
+  File Name:
+    host_gpio.c
+
+  Summary:
+    Pin levels of the display pins for the host build.
+
+  Description:
+    See host_gpio.h.
+*******************************************************************************/
+
+#include <stddef.h>
+
+#include "host_gpio.h"
+
+static uint32_t levels[HOST_PIN_COUNT] = { 1, 1, 1, 1 };
+static uint32_t writes[HOST_PIN_COUNT];
+static HOST_GPIO_Hook hook;
+
+void HOST_GPIO_Reset(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < HOST_PIN_COUNT; i++)
+    {
+        levels[i] = 1;
+        writes[i] = 0;
+    }
+}
+
+void HOST_GPIO_SetHook(HOST_GPIO_Hook fn)
+{
+    hook = fn;
+}
+
+uint32_t HOST_GPIO_Writes(HOST_PIN pin)
+{
+    return writes[pin];
+}
+
+void HOST_GPIO_Write(HOST_PIN pin, uint32_t value)
+{
+    levels[pin] = value != 0;
+    writes[pin]++;
+
+    if(hook != NULL)
+    {
+        hook(pin, levels[pin]);
+    }
+}
+
+uint32_t HOST_GPIO_Read(HOST_PIN pin)
+{
+    return levels[pin];
+}
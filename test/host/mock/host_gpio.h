@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  Host GPIO Header File
+
+  File Name:
+    host_gpio.h
+
+  Summary:
+    Pin levels of the display pins for the host build.
+
+  Description:
+    The GFX_DISP_INTF_PIN macros of the host plib_gpio.h write and read the
+    levels kept here. A mock peripheral that has to see pin changes, like
+    the SSD1351 model watching its chip select, installs a hook.
+*******************************************************************************/
+
+#ifndef HOST_GPIO_H
+#define HOST_GPIO_H
+
+#include <stdint.h>
+
+#include "peripheral/gpio/plib_gpio.h"
+
+typedef void (*HOST_GPIO_Hook)(HOST_PIN pin, uint32_t value);
+
+/* sets all pins high */
+void HOST_GPIO_Reset(void);
+
+/* called on every pin write, NULL to remove it */
+void HOST_GPIO_SetHook(HOST_GPIO_Hook hook);
+
+/* writes to a pin */
+uint32_t HOST_GPIO_Writes(HOST_PIN pin);
+
+#endif // HOST_GPIO_H
@@ -0,0 +1,75 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+  Host Paint
+
+  File Name:
+    host_paint.c
+
+  Summary:
+    Runs test code inside a frame, where the leRenderer draw calls work.
+*******************************************************************************/
+
+#include "host_paint.h"
+#include "host_app.h"
+
+static HOST_PAINT_FUNC paintFn;
+static leWidgetVTable overlayVTable;
+
+static void HOST_PAINT_Paint(leWidget* _this)
+{
+    leRect frame;
+
+    leRenderer_GetFrameRect(&frame);
+
+    paintFn(&frame);
+
+    _this->status.drawState = LE_WIDGET_DRAW_STATE_DONE;
+}
+
+void HOST_PAINT_Run(HOST_PAINT_FUNC fn)
+{
+    leWidget* overlay;
+
+    overlay = leWidget_New();
+
+    overlayVTable = *overlay->fn;
+    overlayVTable._paint = HOST_PAINT_Paint;
+    overlay->fn = &overlayVTable;
+
+    overlay->fn->setSize(overlay, HOST_APP_WIDTH, HOST_APP_HEIGHT);
+    overlay->fn->setBackgroundType(overlay, LE_WIDGET_BACKGROUND_NONE);
+
+    paintFn = fn;
+
+    leAddRootWidget(overlay, 0);
+    HOST_APP_RunUntilIdle(1000);
+
+    leRemoveRootWidget(overlay, 0);
+    leWidget_Delete(overlay);
+    HOST_APP_RunUntilIdle(1000);
+
+    paintFn = NULL;
+}
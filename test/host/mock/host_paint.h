@@ -0,0 +1,55 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+  Host Paint Header File
+
+  File Name:
+    host_paint.h
+
+  Summary:
+    Runs test code inside a frame, where the leRenderer draw calls work.
+
+  Description:
+    The leRenderer pixel, fill and mask row calls draw into the scratch
+    buffer of the frame in progress, so they can only be called from a
+    widget paint. HOST_PAINT_Run adds a transparent widget over the whole
+    screen whose paint calls the given function once per scratch rectangle,
+    repaints the screen and removes the widget again.
+*******************************************************************************/
+
+#ifndef HOST_PAINT_H
+#define HOST_PAINT_H
+
+#include "gfx/legato/legato.h"
+
+/* draws with the leRenderer calls, frame is the part of the screen the
+   scratch buffer holds. Pixels outside it must not be touched */
+typedef void (*HOST_PAINT_FUNC)(const leRect* frame);
+
+/* repaints the screen with fn called after the widgets for each scratch
+   rectangle and runs until idle */
+void HOST_PAINT_Run(HOST_PAINT_FUNC fn);
+
+#endif // HOST_PAINT_H
@@ -0,0 +1,204 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  Host PNG Writer Source File
+
+  File Name:
+    host_png.c
+
+  Summary:
+    Writes RGB565 frames as PNG files.
+
+  Description:
+    See host_png.h.
+*******************************************************************************/
+
+#include "host_png.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HOST_PNG_BLOCK_MAX  65535
+
+static uint32_t crcTable[256];
+
+static uint32_t HOST_PNG_Crc(uint32_t crc, const uint8_t* data, size_t size)
+{
+    uint32_t c, n, k;
+
+    if(crcTable[1] == 0)
+    {
+        for(n = 0; n < 256; n++)
+        {
+            c = n;
+
+            for(k = 0; k < 8; k++)
+            {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+
+            crcTable[n] = c;
+        }
+    }
+
+    crc = ~crc;
+
+    while(size-- > 0)
+    {
+        crc = crcTable[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+static void HOST_PNG_Put32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static int HOST_PNG_Chunk(FILE* f, const char* type, const uint8_t* data, uint32_t size)
+{
+    uint8_t hdr[8];
+    uint8_t crc[4];
+    uint32_t c;
+
+    HOST_PNG_Put32(hdr, size);
+    memcpy(hdr + 4, type, 4);
+
+    c = HOST_PNG_Crc(0, hdr + 4, 4);
+    c = HOST_PNG_Crc(c, data, size);
+
+    HOST_PNG_Put32(crc, c);
+
+    if(fwrite(hdr, 1, 8, f) != 8 ||
+       (size > 0 && fwrite(data, 1, size, f) != size) ||
+       fwrite(crc, 1, 4, f) != 4)
+        return -1;
+
+    return 0;
+}
+
+int HOST_PNG_Write(const char* path,
+                   const uint16_t* pixels,
+                   uint32_t width,
+                   uint32_t height)
+{
+    static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    uint8_t ihdr[13];
+    uint8_t* raw;
+    uint8_t* z;
+    uint8_t* p;
+    uint32_t rawSize = (width * 3 + 1) * height;
+    uint32_t blocks = rawSize / HOST_PNG_BLOCK_MAX + 1;
+    uint32_t zSize = 2 + blocks * 5 + rawSize + 4;
+    uint32_t x, y, i, len, a = 1, b = 0;
+    uint16_t clr;
+    FILE* f;
+    int res = -1;
+
+    raw = malloc(rawSize);
+    z = malloc(zSize);
+
+    if(raw == NULL || z == NULL)
+        goto done;
+
+    /* filter type 0 and the pixels expanded to eight bits per channel */
+    for(y = 0, p = raw; y < height; y++)
+    {
+        *p++ = 0;
+
+        for(x = 0; x < width; x++)
+        {
+            clr = pixels[y * width + x];
+
+            *p++ = (uint8_t)(((clr >> 11) & 0x1F) * 255 / 31);
+            *p++ = (uint8_t)(((clr >> 5) & 0x3F) * 255 / 63);
+            *p++ = (uint8_t)((clr & 0x1F) * 255 / 31);
+        }
+    }
+
+    /* zlib stream of stored blocks */
+    p = z;
+    *p++ = 0x78;
+    *p++ = 0x01;
+
+    for(i = 0; i < rawSize; i += len)
+    {
+        len = rawSize - i < HOST_PNG_BLOCK_MAX ? rawSize - i : HOST_PNG_BLOCK_MAX;
+
+        *p++ = i + len == rawSize ? 1 : 0;
+        *p++ = (uint8_t)len;
+        *p++ = (uint8_t)(len >> 8);
+        *p++ = (uint8_t)~len;
+        *p++ = (uint8_t)(~len >> 8);
+
+        memcpy(p, raw + i, len);
+        p += len;
+    }
+
+    for(i = 0; i < rawSize; i++)
+    {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+
+    HOST_PNG_Put32(p, (b << 16) | a);
+    p += 4;
+
+    HOST_PNG_Put32(ihdr, width);
+    HOST_PNG_Put32(ihdr + 4, height);
+    ihdr[8] = 8;    // bit depth
+    ihdr[9] = 2;    // truecolor
+    ihdr[10] = 0;
+    ihdr[11] = 0;
+    ihdr[12] = 0;
+
+    f = fopen(path, "wb");
+
+    if(f == NULL)
+        goto done;
+
+    if(fwrite(signature, 1, sizeof(signature), f) == sizeof(signature) &&
+       HOST_PNG_Chunk(f, "IHDR", ihdr, sizeof(ihdr)) == 0 &&
+       HOST_PNG_Chunk(f, "IDAT", z, (uint32_t)(p - z)) == 0 &&
+       HOST_PNG_Chunk(f, "IEND", NULL, 0) == 0)
+    {
+        res = 0;
+    }
+
+    if(fclose(f) != 0)
+    {
+        res = -1;
+    }
+
+done:
+    free(raw);
+    free(z);
+
+    return res;
+}
@@ -0,0 +1,191 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  Host RTOS Source File
+
+  File Name:
+    host_rtos.c
+
+  Summary:
+    Virtual time, queues and the console UART for the host build.
+
+  Description:
+    See host_rtos.h.
+*******************************************************************************/
+
+#include "host_rtos.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "task.h"
+#include "osal/osal_freertos_extend.h"
+#include "system/time/sys_time.h"
+#include "peripheral/sercom/usart/plib_sercom0_usart.h"
+
+struct HOST_QUEUE
+{
+    uint8_t* items;
+    uint32_t length;
+    uint32_t itemSize;
+    uint32_t head;
+    uint32_t count;
+};
+
+static uint32_t now;
+static HOST_RTOS_DelayHook delayHook;
+static bool echo;
+static uint32_t consoleBytes;
+
+uint32_t HOST_RTOS_Milliseconds(void)
+{
+    return now;
+}
+
+void HOST_RTOS_Advance(uint32_t ms)
+{
+    now += ms;
+}
+
+void HOST_RTOS_SetDelayHook(HOST_RTOS_DelayHook hook)
+{
+    delayHook = hook;
+}
+
+void HOST_RTOS_SetEcho(bool on)
+{
+    echo = on;
+}
+
+uint32_t HOST_RTOS_ConsoleBytes(void)
+{
+    return consoleBytes;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return now / portTICK_PERIOD_MS;
+}
+
+void vTaskDelay(const TickType_t xTicksToDelay)
+{
+    if(delayHook != NULL)
+    {
+        delayHook(xTicksToDelay * portTICK_PERIOD_MS);
+    }
+    else
+    {
+        now += xTicksToDelay * portTICK_PERIOD_MS;
+    }
+}
+
+uint32_t HOST_RTOS_QueueCount(OSAL_QUEUE_HANDLE_TYPE queue)
+{
+    return queue != NULL ? queue->count : 0;
+}
+
+OSAL_RESULT OSAL_QUEUE_Create(OSAL_QUEUE_HANDLE_TYPE *queID, uint32_t queueLength, uint32_t itemSize)
+{
+    struct HOST_QUEUE* q = calloc(1, sizeof(struct HOST_QUEUE));
+
+    if(q == NULL)
+        return OSAL_RESULT_FALSE;
+
+    q->items = calloc(queueLength, itemSize);
+    q->length = queueLength;
+    q->itemSize = itemSize;
+
+    if(q->items == NULL)
+    {
+        free(q);
+
+        return OSAL_RESULT_FALSE;
+    }
+
+    *queID = q;
+
+    return OSAL_RESULT_TRUE;
+}
+
+OSAL_RESULT OSAL_QUEUE_Send(OSAL_QUEUE_HANDLE_TYPE *queID, void *itemToQueue, uint32_t waitMS)
+{
+    struct HOST_QUEUE* q = *queID;
+
+    (void)waitMS;
+
+    if(q == NULL || q->count == q->length)
+        return OSAL_RESULT_FALSE;
+
+    memcpy(q->items + ((q->head + q->count) % q->length) * q->itemSize,
+           itemToQueue,
+           q->itemSize);
+
+    q->count++;
+
+    return OSAL_RESULT_TRUE;
+}
+
+OSAL_RESULT OSAL_QUEUE_Receive(OSAL_QUEUE_HANDLE_TYPE *queID, void *pBuffer, uint32_t waitMS)
+{
+    struct HOST_QUEUE* q = *queID;
+
+    (void)waitMS;
+
+    if(q == NULL || q->count == 0)
+        return OSAL_RESULT_FALSE;
+
+    memcpy(pBuffer, q->items + q->head * q->itemSize, q->itemSize);
+
+    q->head = (q->head + 1) % q->length;
+    q->count--;
+
+    return OSAL_RESULT_TRUE;
+}
+
+SYS_TIME_RESULT SYS_TIME_DelayMS(uint32_t ms, SYS_TIME_HANDLE* handle)
+{
+    now += ms;
+
+    *handle = 1;
+
+    return SYS_TIME_SUCCESS;
+}
+
+bool SYS_TIME_DelayIsComplete(SYS_TIME_HANDLE handle)
+{
+    return handle != SYS_TIME_HANDLE_INVALID;
+}
+
+size_t SERCOM0_USART_Write(uint8_t* pWrBuffer, const size_t size)
+{
+    consoleBytes += size;
+
+    if(echo == true)
+    {
+        fwrite(pWrBuffer, 1, size, stdout);
+    }
+
+    return size;
+}
@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  Host RTOS Header File
+
+  File Name:
+    host_rtos.h
+
+  Summary:
+    Virtual time, queues and the console UART for the host build.
+
+  Description:
+    There are no threads on the host. Time is a millisecond counter that only
+    moves when HOST_RTOS_Advance is called, and a task delay hands control to
+    the hook the host loop installs so the Legato task can run meanwhile.
+*******************************************************************************/
+
+#ifndef HOST_RTOS_H
+#define HOST_RTOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "FreeRTOS.h"
+#include "osal/osal_freertos_extend.h"
+
+typedef void (*HOST_RTOS_DelayHook)(uint32_t ms);
+
+/* the virtual time in milliseconds */
+uint32_t HOST_RTOS_Milliseconds(void);
+
+/* moves the virtual time on */
+void HOST_RTOS_Advance(uint32_t ms);
+
+/* called by vTaskDelay instead of advancing the time itself, NULL to just
+   advance it */
+void HOST_RTOS_SetDelayHook(HOST_RTOS_DelayHook hook);
+
+/* messages waiting in a queue */
+uint32_t HOST_RTOS_QueueCount(OSAL_QUEUE_HANDLE_TYPE queue);
+
+/* prints what the application writes to the console UART */
+void HOST_RTOS_SetEcho(bool echo);
+
+/* bytes written to the console UART */
+uint32_t HOST_RTOS_ConsoleBytes(void);
+
+#endif // HOST_RTOS_H
@@ -0,0 +1,572 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  Host SPI Source File
+
+  File Name:
+    host_spi.c
+
+  Summary:
+    SPI driver and SSD1351 controller model for the host build.
+
+  Description:
+    See host_spi.h.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "configuration.h"
+#include "driver/spi/drv_spi.h"
+#include "host_gpio.h"
+#include "host_spi.h"
+
+#define HOST_SPI_HANDLE         1
+
+#define SSD1351_GRAM_SIZE       128
+#define SSD1351_COLUMN_OFFSET   16
+
+/* start line at which panel row 0 shows GRAM row 0, the driver scrolls
+   the display by moving it away from here */
+#define SSD1351_START_LINE      0x20
+
+#define SSD1351_SET_COLUMN      0x15
+#define SSD1351_SET_ROW         0x75
+#define SSD1351_WRITE_RAM       0x5C
+#define SSD1351_SET_REMAP       0xA0
+#define SSD1351_SET_START_LINE  0xA1
+
+typedef struct
+{
+    const uint8_t* data;
+    uint32_t size;
+    uint32_t sent;
+    uint32_t cs;
+    uint32_t rsdc;
+} HOST_SPI_TRANSFER;
+
+/* the controller side, what the SSD1351 makes of the bytes */
+static struct
+{
+    uint16_t gram[SSD1351_GRAM_SIZE][SSD1351_GRAM_SIZE];
+    uint8_t command;
+    uint32_t parm;
+    uint8_t high;
+    uint8_t columnStart;
+    uint8_t columnEnd;
+    uint8_t rowStart;
+    uint8_t rowEnd;
+    uint8_t column;
+    uint8_t row;
+    uint8_t startLine;
+    uint8_t remap;
+} ssd;
+
+static HOST_SPI_TRANSFER queue[DRV_SPI_QUEUE_SIZE_IDX0];
+static uint32_t queueHead;
+static uint32_t queueCount;
+static bool running;
+static bool inHandler;
+static bool held;
+static uint32_t startable;
+static void (*addHook)(void);
+static HOST_SPI_MODE mode;
+static uint32_t baud;
+static uint64_t bitBudget;
+static uint32_t refuse;
+static uint32_t fail;
+static DRV_SPI_TRANSFER_EVENT_HANDLER handler;
+static uintptr_t handlerContext;
+static HOST_SPI_STATS stats;
+static uint16_t panel[HOST_SPI_PANEL_HEIGHT][HOST_SPI_PANEL_WIDTH];
+
+static void HOST_SPI_Pin(HOST_PIN pin, uint32_t value)
+{
+    if(pin == HOST_PIN_CS && value == 0)
+    {
+        stats.selects++;
+    }
+
+    /* the pins of a transfer on the wire must hold */
+    if(running == true && (pin == HOST_PIN_CS || pin == HOST_PIN_RSDC))
+    {
+        if((pin == HOST_PIN_CS && value != queue[queueHead].cs) ||
+           (pin == HOST_PIN_RSDC && value != queue[queueHead].rsdc))
+        {
+            stats.violations++;
+        }
+    }
+}
+
+static void HOST_SPI_Pixel(uint16_t clr)
+{
+    ssd.gram[ssd.row][ssd.column] = clr;
+    stats.pixels++;
+
+    if(ssd.column < ssd.columnEnd)
+    {
+        ssd.column++;
+        return;
+    }
+
+    ssd.column = ssd.columnStart;
+
+    ssd.row = ssd.row < ssd.rowEnd ? ssd.row + 1 : ssd.rowStart;
+}
+
+static void HOST_SPI_Command(uint8_t cmd)
+{
+    ssd.command = cmd;
+    ssd.parm = 0;
+
+    if(cmd == SSD1351_SET_COLUMN)
+    {
+        stats.windows++;
+    }
+    else if(cmd == SSD1351_WRITE_RAM)
+    {
+        stats.ramWrites++;
+    }
+}
+
+static void HOST_SPI_Data(uint8_t data)
+{
+    uint32_t parm = ssd.parm++;
+
+    switch(ssd.command)
+    {
+        case SSD1351_SET_COLUMN:
+        {
+            if(parm == 0)
+            {
+                ssd.columnStart = data & 0x7F;
+                ssd.column = ssd.columnStart;
+            }
+            else if(parm == 1)
+            {
+                ssd.columnEnd = data & 0x7F;
+            }
+
+            break;
+        }
+        case SSD1351_SET_ROW:
+        {
+            if(parm == 0)
+            {
+                ssd.rowStart = data & 0x7F;
+                ssd.row = ssd.rowStart;
+            }
+            else if(parm == 1)
+            {
+                ssd.rowEnd = data & 0x7F;
+            }
+
+            break;
+        }
+        case SSD1351_WRITE_RAM:
+        {
+            /* 65k colors, two bytes a pixel high byte first */
+            if((parm & 1) == 0)
+            {
+                ssd.high = data;
+            }
+            else
+            {
+                HOST_SPI_Pixel((uint16_t)((ssd.high << 8) | data));
+            }
+
+            break;
+        }
+        case SSD1351_SET_REMAP:
+        {
+            ssd.remap = data;
+
+            break;
+        }
+        case SSD1351_SET_START_LINE:
+        {
+            ssd.startLine = data & 0x7F;
+
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+/* the bytes of a transfer reach the controller */
+static void HOST_SPI_Deliver(const HOST_SPI_TRANSFER* xfer)
+{
+    uint32_t i;
+
+    if(xfer->rsdc == 0)
+    {
+        stats.commandBytes += xfer->size;
+    }
+    else
+    {
+        stats.dataBytes += xfer->size;
+    }
+
+    stats.wireNs += (uint64_t)xfer->size * 8 * 1000000000u / baud;
+
+    for(i = 0; i < xfer->size; i++)
+    {
+        stats.wireHash = (stats.wireHash ^ (xfer->rsdc << 8 | xfer->data[i])) * 16777619u;
+    }
+
+    /* a deselected controller ignores the clock */
+    if(xfer->cs != 0)
+        return;
+
+    for(i = 0; i < xfer->size; i++)
+    {
+        if(xfer->rsdc == 0)
+        {
+            HOST_SPI_Command(xfer->data[i]);
+        }
+        else
+        {
+            HOST_SPI_Data(xfer->data[i]);
+        }
+    }
+}
+
+/* starts the transfer at the head of the queue */
+static void HOST_SPI_Start(void)
+{
+    HOST_SPI_TRANSFER* xfer = &queue[queueHead];
+
+    xfer->cs = HOST_GPIO_Read(HOST_PIN_CS);
+    xfer->rsdc = HOST_GPIO_Read(HOST_PIN_RSDC);
+    xfer->sent = 0;
+
+    if(xfer->cs != 0)
+    {
+        stats.violations++;
+    }
+
+    running = true;
+}
+
+/* ends the running transfer, calls the event handler and starts the next */
+static void HOST_SPI_Finish(void)
+{
+    HOST_SPI_TRANSFER xfer = queue[queueHead];
+    DRV_SPI_TRANSFER_EVENT event = DRV_SPI_TRANSFER_EVENT_COMPLETE;
+
+    running = false;
+
+    queueHead = (queueHead + 1) % DRV_SPI_QUEUE_SIZE_IDX0;
+    queueCount--;
+
+    if(fail > 0)
+    {
+        fail--;
+        stats.errors++;
+        event = DRV_SPI_TRANSFER_EVENT_ERROR;
+    }
+    else
+    {
+        HOST_SPI_Deliver(&xfer);
+    }
+
+    stats.transfers++;
+
+    if(handler != NULL)
+    {
+        inHandler = true;
+        handler(event, HOST_SPI_HANDLE, handlerContext);
+        inHandler = false;
+    }
+
+    if(held == true && startable > 0)
+    {
+        startable--;
+    }
+
+    if(queueCount > 0 && (held == false || startable > 0))
+    {
+        HOST_SPI_Start();
+    }
+}
+
+/* finishes transfers until the queue is empty, transfers the handlers add
+   included */
+static void HOST_SPI_Drain(void)
+{
+    while(running == true)
+    {
+        HOST_SPI_Finish();
+    }
+}
+
+void HOST_SPI_Reset(void)
+{
+    memset(&ssd, 0, sizeof(ssd));
+    memset(&stats, 0, sizeof(stats));
+
+    ssd.columnEnd = SSD1351_GRAM_SIZE - 1;
+    ssd.rowEnd = SSD1351_GRAM_SIZE - 1;
+
+    queueHead = 0;
+    queueCount = 0;
+    running = false;
+    inHandler = false;
+    held = false;
+    startable = 0;
+    addHook = NULL;
+    mode = HOST_SPI_IMMEDIATE;
+    baud = 1000000;
+    bitBudget = 0;
+    refuse = 0;
+    fail = 0;
+    handler = NULL;
+
+    HOST_GPIO_SetHook(HOST_SPI_Pin);
+}
+
+void HOST_SPI_SetMode(HOST_SPI_MODE newMode)
+{
+    mode = newMode;
+
+    if(mode == HOST_SPI_IMMEDIATE && inHandler == false)
+    {
+        HOST_SPI_Drain();
+    }
+}
+
+void HOST_SPI_Run(uint32_t us)
+{
+    HOST_SPI_TRANSFER* xfer;
+    uint32_t bytes;
+
+    bitBudget += (uint64_t)us * baud / 1000000u;
+
+    while(running == true && bitBudget >= 8)
+    {
+        xfer = &queue[queueHead];
+
+        bytes = (uint32_t)(bitBudget / 8);
+
+        if(bytes > xfer->size - xfer->sent)
+        {
+            bytes = xfer->size - xfer->sent;
+        }
+
+        xfer->sent += bytes;
+        bitBudget -= (uint64_t)bytes * 8;
+
+        if(xfer->sent == xfer->size)
+        {
+            HOST_SPI_Finish();
+        }
+    }
+
+    /* an idle bus doesn't save up time */
+    if(running == false)
+    {
+        bitBudget = 0;
+    }
+}
+
+void HOST_SPI_Hold(bool hold)
+{
+    held = hold;
+    startable = queueCount;
+
+    if(held == false && running == false && queueCount > 0)
+    {
+        HOST_SPI_Start();
+    }
+}
+
+void HOST_SPI_SetAddHook(void (*hook)(void))
+{
+    addHook = hook;
+}
+
+bool HOST_SPI_IsSending(void)
+{
+    return running;
+}
+
+void HOST_SPI_Flush(void)
+{
+    HOST_SPI_Drain();
+}
+
+bool HOST_SPI_IsIdle(void)
+{
+    return queueCount == 0;
+}
+
+void HOST_SPI_RefuseTransfers(uint32_t count)
+{
+    refuse = count;
+}
+
+void HOST_SPI_FailTransfers(uint32_t count)
+{
+    fail = count;
+}
+
+void HOST_SPI_GetStats(HOST_SPI_STATS* out)
+{
+    *out = stats;
+}
+
+void HOST_SPI_ResetStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+const uint16_t* HOST_SPI_Panel(void)
+{
+    uint32_t y, row;
+
+    for(y = 0; y < HOST_SPI_PANEL_HEIGHT; y++)
+    {
+        row = (y + ssd.startLine + SSD1351_GRAM_SIZE - SSD1351_START_LINE) % SSD1351_GRAM_SIZE;
+
+        memcpy(panel[y],
+               &ssd.gram[row][SSD1351_COLUMN_OFFSET],
+               sizeof(panel[y]));
+    }
+
+    return &panel[0][0];
+}
+
+uint8_t HOST_SPI_StartLine(void)
+{
+    return ssd.startLine;
+}
+
+uint8_t HOST_SPI_Remap(void)
+{
+    return ssd.remap;
+}
+
+DRV_HANDLE DRV_SPI_Open(const SYS_MODULE_INDEX drvIndex, const DRV_IO_INTENT ioIntent)
+{
+    (void)ioIntent;
+
+    if(drvIndex != DRV_SPI_INDEX_0)
+        return DRV_HANDLE_INVALID;
+
+    return HOST_SPI_HANDLE;
+}
+
+void DRV_SPI_Close(const DRV_HANDLE handle)
+{
+    (void)handle;
+}
+
+bool DRV_SPI_TransferSetup(const DRV_HANDLE handle, DRV_SPI_TRANSFER_SETUP* setup)
+{
+    if(handle != HOST_SPI_HANDLE || setup->baudRateInHz == 0)
+        return false;
+
+    baud = setup->baudRateInHz;
+    stats.setups++;
+
+    return true;
+}
+
+void DRV_SPI_TransferEventHandlerSet(const DRV_HANDLE handle,
+                                     const DRV_SPI_TRANSFER_EVENT_HANDLER eventHandler,
+                                     uintptr_t context)
+{
+    (void)handle;
+
+    handler = eventHandler;
+    handlerContext = context;
+}
+
+void DRV_SPI_WriteTransferAdd(const DRV_HANDLE handle,
+                              void* pTransmitData,
+                              size_t txSize,
+                              DRV_SPI_TRANSFER_HANDLE * const transferHandle)
+{
+    HOST_SPI_TRANSFER* xfer;
+
+    if(handle != HOST_SPI_HANDLE || pTransmitData == NULL || txSize == 0 ||
+       queueCount == DRV_SPI_QUEUE_SIZE_IDX0 || refuse > 0)
+    {
+        if(refuse > 0)
+        {
+            refuse--;
+        }
+
+        *transferHandle = DRV_SPI_TRANSFER_HANDLE_INVALID;
+
+        return;
+    }
+
+    xfer = &queue[(queueHead + queueCount) % DRV_SPI_QUEUE_SIZE_IDX0];
+    xfer->data = pTransmitData;
+    xfer->size = txSize;
+
+    queueCount++;
+
+    *transferHandle = HOST_SPI_HANDLE;
+
+    /* the event handler carries on transfers already under way */
+    if(held == true && inHandler == true)
+    {
+        startable++;
+    }
+
+    if(addHook != NULL && inHandler == false)
+    {
+        addHook();
+    }
+
+    /* transfers added by the event handler start after it returns */
+    if(running == false && inHandler == false && held == false)
+    {
+        HOST_SPI_Start();
+    }
+
+    if(mode == HOST_SPI_IMMEDIATE && inHandler == false)
+    {
+        HOST_SPI_Drain();
+    }
+}
+
+void DRV_SPI_ReadTransferAdd(const DRV_HANDLE handle,
+                             void* pReceiveData,
+                             size_t rxSize,
+                             DRV_SPI_TRANSFER_HANDLE * const transferHandle)
+{
+    (void)handle;
+    (void)pReceiveData;
+    (void)rxSize;
+
+    /* the SSD1351 is write only over SPI */
+    *transferHandle = DRV_SPI_TRANSFER_HANDLE_INVALID;
+}
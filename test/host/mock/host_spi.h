@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  Host SPI Header File
+
+  File Name:
+    host_spi.h
+
+  Summary:
+    SPI driver and SSD1351 controller model for the host build.
+
+  Description:
+    Implements the DRV_SPI transfer API the display interface uses and
+    feeds what goes over the wire to a model of the SSD1351: the column and
+    row address commands, the RAM write command with its auto-wrapping
+    window and the 128x128 GRAM. The chip select and RS/DCx levels are
+    taken when a transfer starts, the way the SERCOM shifts them out, and a
+    transfer that starts with chip select high or sees chip select or RS/DCx
+    change while it is running is counted as a violation.
+
+    Transfers are queued like in the Harmony driver, DRV_SPI_QUEUE_SIZE_IDX0
+    at a time, and the event handler of a transfer runs before the next one
+    starts. In HOST_SPI_IMMEDIATE mode a transfer finishes as soon as it is
+    added, with transfers added from the event handler finishing after it
+    returns. In HOST_SPI_TIMED mode transfers only move on in HOST_SPI_Run,
+    at the baud rate of the last transfer setup. Anything that waits for a
+    transfer by polling spins forever in that mode.
+*******************************************************************************/
+
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HOST_SPI_PANEL_WIDTH    96
+#define HOST_SPI_PANEL_HEIGHT   96
+
+typedef enum
+{
+    HOST_SPI_IMMEDIATE,
+    HOST_SPI_TIMED,
+} HOST_SPI_MODE;
+
+typedef struct
+{
+    uint32_t transfers;     // transfers finished
+    uint32_t commandBytes;  // bytes sent with RS/DCx low
+    uint32_t dataBytes;     // bytes sent with RS/DCx high
+    uint32_t selects;       // chip select falling edges
+    uint32_t violations;    // transfers with a wrong chip select or RS/DCx
+    uint32_t setups;        // transfer setup calls
+    uint32_t windows;       // column address commands
+    uint32_t ramWrites;     // RAM write commands
+    uint32_t pixels;        // pixels written to GRAM
+    uint32_t errors;        // transfers failed on request
+    uint64_t wireNs;        // time on the wire at the set baud rates
+    uint32_t wireHash;      // FNV-1a hash of the bytes with their RS/DCx level
+} HOST_SPI_STATS;
+
+/* empties the queue and the GRAM, resets the controller model and the
+   counters and goes back to immediate mode */
+void HOST_SPI_Reset(void);
+
+void HOST_SPI_SetMode(HOST_SPI_MODE mode);
+
+/* moves timed transfers on by us microseconds */
+void HOST_SPI_Run(uint32_t us);
+
+/* finishes all queued transfers */
+void HOST_SPI_Flush(void);
+
+/* true if no transfer is queued */
+bool HOST_SPI_IsIdle(void);
+
+/* while held, transfers added from outside the event handler queue up but
+   don't start, as if the code adding them was still running. Letting go
+   starts them */
+void HOST_SPI_Hold(bool hold);
+
+/* called after each transfer added from outside the event handler */
+void HOST_SPI_SetAddHook(void (*hook)(void));
+
+/* true while a transfer is on the wire */
+bool HOST_SPI_IsSending(void);
+
+/* fails the next count transfer adds the way a full queue does */
+void HOST_SPI_RefuseTransfers(uint32_t count);
+
+/* ends the next count transfers with an error event, their bytes don't
+   reach the controller */
+void HOST_SPI_FailTransfers(uint32_t count);
+
+void HOST_SPI_GetStats(HOST_SPI_STATS* stats);
+void HOST_SPI_ResetStats(void);
+
+/* the part of GRAM the panel shows from the current start line, RGB565
+   in CPU byte order, row after row */
+const uint16_t* HOST_SPI_Panel(void);
+
+/* the display start line and remap settings sent to the controller */
+uint8_t HOST_SPI_StartLine(void);
+uint8_t HOST_SPI_Remap(void);
+
+#endif // HOST_SPI_H
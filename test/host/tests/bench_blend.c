@@ -0,0 +1,333 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+  Alpha Blend Benchmark
+
+  File Name:
+    bench_blend.c
+
+  Summary:
+    Checks the RGB565 blend paths against the RGBA8888 blend and times them.
+
+  Description:
+    Blends random colors over the screen with random alpha through
+    leRenderer_BlendPixel and leRenderer_FillArea, whose RGB565 paths blend
+    in place with 32 alpha steps. Fails unless every pixel matches
+    leColorBlend_RGB_565, fills leave the pixels around them alone and
+    no channel is further than one step from the RGBA8888 blend the
+    renderer used before, and prints the largest difference per channel.
+    Then prints the pixels per second of alpha fills, of blended pixels
+    and of the RGBA8888 blend. Built with the scratch buffers in either
+    byte order, the timings go to stderr so both builds print the same.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "definitions.h"
+#include "host_app.h"
+#include "host_paint.h"
+#include "host_test.h"
+
+#define CHECK_PIXELS    2000
+#define CHECK_FILLS     100
+#define BENCH_ROUNDS    200
+#define BENCH_ALPHA     128
+
+static leColor saved[HOST_APP_HEIGHT][HOST_APP_WIDTH];
+
+static uint32_t seed = 1;
+static uint32_t checkedPixels;
+static uint32_t checkedFills;
+static uint32_t maxError[3];
+static uint32_t benchPixels;
+static clock_t fillTime;
+static clock_t pixelTime;
+static clock_t rgbaTime;
+
+static int32_t rnd(int32_t range)
+{
+    seed = seed * 1103515245u + 12345u;
+
+    return (int32_t)((seed >> 8) % (uint32_t)range);
+}
+
+static uint32_t randomAlpha(void)
+{
+    switch(rnd(8))
+    {
+        case 0:
+            return 0;
+        case 1:
+            return 255;
+        default:
+            return (uint32_t)rnd(256);
+    }
+}
+
+/* the blend the renderer used for RGB565 before, through RGBA8888 */
+static leColor blendRGBA(leColor clr, leColor dest, uint32_t a)
+{
+    leColor src;
+
+    src = leColorConvert(LE_COLOR_MODE_RGB_565, LE_COLOR_MODE_RGBA_8888, clr);
+    src = (src & ~RGBA_8888_ALPHA_MASK) | a;
+
+    if(a == 0)
+        return dest;
+
+    return leColorConvert(LE_COLOR_MODE_RGBA_8888,
+                          LE_COLOR_MODE_RGB_565,
+                          leColorBlend_RGBA_8888(src,
+                                                 leColorConvert(LE_COLOR_MODE_RGB_565,
+                                                                LE_COLOR_MODE_RGBA_8888,
+                                                                dest)));
+}
+
+static uint32_t distance(uint32_t a, uint32_t b)
+{
+    return a > b ? a - b : b - a;
+}
+
+static void track(uint32_t channel, uint32_t error)
+{
+    if(error > maxError[channel])
+    {
+        maxError[channel] = error;
+    }
+}
+
+static void checkBlend(leColor result, leColor clr, leColor dest, uint32_t a)
+{
+    leColor ref;
+
+    HOST_TEST_EQUAL(result, a == 0 ? dest : leColorBlend_RGB_565(clr, dest, a));
+
+    if(a == 255)
+    {
+        HOST_TEST_EQUAL(result, clr);
+    }
+
+    ref = blendRGBA(clr, dest, a);
+
+    track(0, distance(result >> 11, ref >> 11));
+    track(1, distance((result >> 5) & 0x3F, (ref >> 5) & 0x3F));
+    track(2, distance(result & 0x1F, ref & 0x1F));
+}
+
+static void save(const leRect* frame)
+{
+    int32_t x, y;
+
+    for(y = 0; y < frame->height; y++)
+    {
+        for(x = 0; x < frame->width; x++)
+        {
+            saved[y][x] = leRenderer_GetPixel(frame->x + x, frame->y + y);
+        }
+    }
+}
+
+static void restore(const leRect* frame)
+{
+    int32_t x, y;
+
+    for(y = 0; y < frame->height; y++)
+    {
+        for(x = 0; x < frame->width; x++)
+        {
+            leRenderer_PutPixel(frame->x + x, frame->y + y, saved[y][x]);
+        }
+    }
+}
+
+static void checkPixels(const leRect* frame)
+{
+    int32_t i, x, y;
+    leColor clr, dest;
+    uint32_t a;
+
+    for(i = 0; i < CHECK_PIXELS / 16; i++)
+    {
+        x = frame->x + rnd(frame->width);
+        y = frame->y + rnd(frame->height);
+        clr = (leColor)rnd(0x10000);
+        a = randomAlpha();
+
+        dest = leRenderer_GetPixel(x, y);
+
+        leRenderer_BlendPixel(x, y, clr, a);
+
+        checkBlend(leRenderer_GetPixel(x, y), clr, dest, a);
+
+        leRenderer_PutPixel(x, y, dest);
+
+        checkedPixels++;
+    }
+}
+
+static void checkFills(const leRect* frame)
+{
+    leRect fill;
+    int32_t i, x, y;
+    leColor clr, pixel;
+    uint32_t a;
+
+    save(frame);
+
+    for(i = 0; i < CHECK_FILLS / 16; i++)
+    {
+        // odd and even starts and widths cover the pair loop's single pixels
+        fill.x = frame->x + rnd(frame->width);
+        fill.y = frame->y + rnd(frame->height);
+        fill.width = 1 + rnd(frame->x + frame->width - fill.x);
+        fill.height = 1 + rnd(frame->y + frame->height - fill.y);
+        clr = (leColor)rnd(0x10000);
+        a = randomAlpha();
+
+        leRenderer_FillArea(fill.x, fill.y, fill.width, fill.height, clr, a);
+
+        for(y = 0; y < frame->height; y++)
+        {
+            for(x = 0; x < frame->width; x++)
+            {
+                pixel = leRenderer_GetPixel(frame->x + x, frame->y + y);
+
+                if(leRectContainsPoint(&fill, &(lePoint){frame->x + x, frame->y + y}) == LE_TRUE)
+                {
+                    checkBlend(pixel, clr, saved[y][x], a);
+                }
+                else
+                {
+                    HOST_TEST_EQUAL(pixel, saved[y][x]);
+                }
+            }
+        }
+
+        restore(frame);
+
+        checkedFills++;
+    }
+}
+
+static void bench(const leRect* frame)
+{
+    int32_t i, x, y;
+    clock_t cpu;
+    leColor dest;
+
+    benchPixels = BENCH_ROUNDS * frame->width * frame->height;
+
+    cpu = clock();
+
+    for(i = 0; i < BENCH_ROUNDS; i++)
+    {
+        leRenderer_FillArea(frame->x, frame->y, frame->width, frame->height, 0xF81F, BENCH_ALPHA);
+    }
+
+    fillTime = clock() - cpu;
+    cpu = clock();
+
+    for(i = 0; i < BENCH_ROUNDS; i++)
+    {
+        for(y = frame->y; y < frame->y + frame->height; y++)
+        {
+            for(x = frame->x; x < frame->x + frame->width; x++)
+            {
+                leRenderer_BlendPixel(x, y, 0x07E0, BENCH_ALPHA);
+            }
+        }
+    }
+
+    pixelTime = clock() - cpu;
+    cpu = clock();
+
+    for(i = 0; i < BENCH_ROUNDS; i++)
+    {
+        for(y = frame->y; y < frame->y + frame->height; y++)
+        {
+            for(x = frame->x; x < frame->x + frame->width; x++)
+            {
+                dest = leRenderer_GetPixel(x, y);
+
+                leRenderer_PutPixel(x, y, blendRGBA(0x001F, dest, BENCH_ALPHA));
+            }
+        }
+    }
+
+    rgbaTime = clock() - cpu;
+}
+
+static void paint(const leRect* frame)
+{
+    checkPixels(frame);
+    checkFills(frame);
+
+    if(benchPixels == 0)
+    {
+        bench(frame);
+    }
+}
+
+static double pixelsPerSecond(clock_t cpu)
+{
+    if(cpu == 0)
+    {
+        cpu = 1;
+    }
+
+    return (double)benchPixels * CLOCKS_PER_SEC / (double)cpu / 1e6;
+}
+
+int main(void)
+{
+    HOST_APP_Initialize();
+
+    HOST_PAINT_Run(paint);
+
+    HOST_TEST_CHECK(checkedPixels > 0);
+    HOST_TEST_CHECK(checkedFills > 0);
+    HOST_TEST_CHECK(benchPixels > 0);
+
+    printf("pixels checked %u, fills checked %u\n",
+           (unsigned)checkedPixels,
+           (unsigned)checkedFills);
+    printf("largest difference from the RGBA8888 blend: red %u, green %u, blue %u\n",
+           (unsigned)maxError[0],
+           (unsigned)maxError[1],
+           (unsigned)maxError[2]);
+
+    fprintf(stderr, "alpha fill %.1f Mpx/s, blend pixel %.1f Mpx/s, rgba8888 %.1f Mpx/s\n",
+            pixelsPerSecond(fillTime),
+            pixelsPerSecond(pixelTime),
+            pixelsPerSecond(rgbaTime));
+
+    HOST_TEST_CHECK(maxError[0] <= 1);
+    HOST_TEST_CHECK(maxError[1] <= 1);
+    HOST_TEST_CHECK(maxError[2] <= 1);
+
+    return 0;
+}
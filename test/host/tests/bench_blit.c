@@ -0,0 +1,176 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+  SSD1351 Blit Overhead Benchmark
+
+  File Name:
+    bench_blit.c
+
+  Summary:
+    Measures what a blit costs on top of its pixels.
+
+  Description:
+    Sends full width scratch buffers of a few heights through the SSD1351
+    driver to the SPI mock, once opening a new GRAM window and once
+    carrying on in the window the blit above left open, and prints the
+    transfers, the command and window bytes, the time on the wire and the
+    CPU time per blit, the SPI mock's included. Big-endian buffers go out in place, buffers in CPU
+    byte order are swapped a chunk at a time. Fails if a window setup
+    costs more than its seven bytes or a continued band sends any.
+*******************************************************************************/
+
+#include <time.h>
+
+#include "definitions.h"
+#include "host_gpio.h"
+#include "host_spi.h"
+#include "host_test.h"
+
+#define WIDTH       96
+#define MAX_ROWS    48
+#define REPEATS     500
+
+/* bytes of a window setup, column and row address and the RAM write */
+#define WINDOW_COMMAND_BYTES    3
+#define WINDOW_DATA_BYTES       4
+
+static uint16_t pixels[WIDTH * MAX_ROWS];
+static gfxPixelBuffer buffer;
+static uint32_t seed;
+static uint32_t callbacks;
+
+static void blitDone(void)
+{
+    callbacks++;
+}
+
+/* new pixels every time so the shadow never skips a blit */
+static void fill(int32_t rows, gfxBool bigEndian)
+{
+    int32_t i;
+
+    seed++;
+
+    gfxPixelBufferCreate(WIDTH, rows, GFX_COLOR_MODE_RGB_565, pixels, &buffer);
+
+    for(i = 0; i < WIDTH * rows; i++)
+    {
+        pixels[i] = (uint16_t)(seed * 0x1F3D + i * 0x0841 + 1);
+    }
+
+    buffer.flags = bigEndian == GFX_TRUE ? GFX_BF_BIG_ENDIAN : 0;
+}
+
+static void startup(void)
+{
+    gfxIOCTLArg_Value val;
+
+    HOST_GPIO_Reset();
+    HOST_SPI_Reset();
+
+    DRV_SSD1351_Initialize();
+    DRV_SSD1351_Update();
+
+    val.value.v_pointer = (void*)blitDone;
+    DRV_SSD1351_IOCTL(GFX_IOCTL_SET_BLIT_CALLBACK, &val);
+}
+
+/* blits rows at row y, continuing the band above when there is one, and
+   returns the CPU time per blit in microseconds */
+static double measure(int32_t rows, gfxBool bigEndian, gfxBool band, HOST_SPI_STATS* spi)
+{
+    clock_t cpu = 0;
+    clock_t start;
+    uint32_t i;
+
+    for(i = 0; i < REPEATS; i++)
+    {
+        /* the window is left open below the band at row 0 */
+        fill(rows, bigEndian);
+        HOST_TEST_EQUAL(DRV_SSD1351_BlitBuffer(0, 0, &buffer), GFX_SUCCESS);
+
+        if(band == GFX_FALSE)
+        {
+            /* a blit at the far end of the panel closes it */
+            fill(1, bigEndian);
+            HOST_TEST_EQUAL(DRV_SSD1351_BlitBuffer(0, 95, &buffer), GFX_SUCCESS);
+        }
+
+        fill(rows, bigEndian);
+
+        HOST_SPI_ResetStats();
+        callbacks = 0;
+
+        start = clock();
+        HOST_TEST_EQUAL(DRV_SSD1351_BlitBuffer(0, rows, &buffer), GFX_SUCCESS);
+        cpu += clock() - start;
+
+        HOST_TEST_EQUAL(callbacks, 1);
+    }
+
+    HOST_SPI_GetStats(spi);
+
+    HOST_TEST_EQUAL(spi->dataBytes - spi->pixels * 2, band == GFX_TRUE ? 0 : WINDOW_DATA_BYTES);
+    HOST_TEST_EQUAL(spi->commandBytes, band == GFX_TRUE ? 0 : WINDOW_COMMAND_BYTES);
+    HOST_TEST_EQUAL(spi->pixels, WIDTH * rows);
+    HOST_TEST_EQUAL(spi->violations, 0);
+
+    return (double)cpu * 1e6 / CLOCKS_PER_SEC / REPEATS;
+}
+
+int main(void)
+{
+    static const int32_t heights[] = { 1, 4, 16, MAX_ROWS };
+    HOST_SPI_STATS spi;
+    uint32_t h, order, band;
+    double cpu;
+
+    startup();
+
+    printf("rows order   window  transfers  overhead bytes  wire us  cpu us\n");
+
+    for(order = 0; order < 2; order++)
+    {
+        for(h = 0; h < sizeof(heights) / sizeof(heights[0]); h++)
+        {
+            for(band = 0; band < 2; band++)
+            {
+                cpu = measure(heights[h], order == 0 ? GFX_TRUE : GFX_FALSE,
+                              band == 1 ? GFX_TRUE : GFX_FALSE, &spi);
+
+                printf("%4d %-7s %-8s %9u %15u %8.1f %7.2f\n",
+                       (int)heights[h],
+                       order == 0 ? "wire" : "cpu",
+                       band == 1 ? "band" : "new",
+                       (unsigned)spi.transfers,
+                       (unsigned)(spi.commandBytes + spi.dataBytes - spi.pixels * 2),
+                       (double)spi.wireNs / 1000.0,
+                       cpu);
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,356 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+  Damage Region Benchmark
+
+  File Name:
+    bench_damage.c
+
+  Summary:
+    Checks leRectArray_Union and times it against the pairwise passes.
+
+  Description:
+    Checks that the union of random rectangle sets covers the same pixels
+    as the input without overlaps. Then builds hundreds of invalidations
+    the way a streaming line graph and rapid text updates produce them and
+    prints the rectangles and pixels left and the CPU time of the union
+    and of RemoveDuplicates, MergeSimilar and RemoveOverlapping, which
+    preLayer ran before. Last the text updates go through
+    leRenderer_DamageArea and the frame that draws them is timed.
+
+    The rectangle lists come from the Legato heap, which is enlarged for
+    this build. The shipped 7 KB heap holds the union's working buffer for
+    about a hundred rectangles, past that preLayer falls back to the
+    pairwise passes.
+*******************************************************************************/
+
+#include <string.h>
+#include <time.h>
+
+#include "definitions.h"
+#include "host_app.h"
+#include "host_test.h"
+
+#define GRID            96
+#define RANDOM_SETS     500
+#define RANDOM_RECTS    64
+#define GRAPH_POINTS    400
+#define GLYPH_WIDTH     6
+#define GLYPH_HEIGHT    8
+#define TEXT_UPDATES    3
+#define RUNS            20
+
+static uint8_t grid[GRID * GRID];
+static uint32_t seed = 1;
+
+static int32_t rnd(int32_t range)
+{
+    seed = seed * 1103515245u + 12345u;
+
+    return (int32_t)((seed >> 8) % (uint32_t)range);
+}
+
+static void cover(const leRectArray* arr, uint8_t bit)
+{
+    uint32_t i;
+    int32_t x, y;
+
+    for(i = 0; i < arr->size; i++)
+    {
+        for(y = arr->rects[i].y; y < arr->rects[i].y + arr->rects[i].height; y++)
+        {
+            for(x = arr->rects[i].x; x < arr->rects[i].x + arr->rects[i].width; x++)
+            {
+                // a second union rect on the same pixel is an overlap
+                HOST_TEST_CHECK(bit == 1 || (grid[y * GRID + x] & bit) == 0);
+
+                grid[y * GRID + x] |= bit;
+            }
+        }
+    }
+}
+
+static uint32_t area(const leRectArray* arr)
+{
+    uint32_t i, sum = 0;
+
+    for(i = 0; i < arr->size; i++)
+    {
+        sum += (uint32_t)(arr->rects[i].width * arr->rects[i].height);
+    }
+
+    return sum;
+}
+
+static void copy(const leRectArray* src, leRectArray* dest)
+{
+    uint32_t i;
+
+    leRectArray_Clear(dest);
+
+    for(i = 0; i < src->size; i++)
+    {
+        leRectArray_PushBack(dest, &src->rects[i]);
+    }
+}
+
+static void testRandom(void)
+{
+    leRectArray in, out;
+    leRect rect;
+    uint32_t set, i, count, x;
+
+    leRectArray_Create(&in);
+    leRectArray_Create(&out);
+
+    for(set = 0; set < RANDOM_SETS; set++)
+    {
+        leRectArray_Clear(&in);
+
+        count = 1 + (uint32_t)rnd(RANDOM_RECTS);
+
+        for(i = 0; i < count; i++)
+        {
+            rect.x = rnd(GRID - 1);
+            rect.y = rnd(GRID - 1);
+            rect.width = 1 + rnd(set % 2 == 0 ? 8 : GRID - rect.x);
+            rect.height = 1 + rnd(set % 2 == 0 ? 8 : GRID - rect.y);
+
+            if(rect.x + rect.width > GRID)
+                rect.width = GRID - rect.x;
+
+            if(rect.y + rect.height > GRID)
+                rect.height = GRID - rect.y;
+
+            leRectArray_PushBack(&in, &rect);
+        }
+
+        copy(&in, &out);
+
+        HOST_TEST_EQUAL(leRectArray_Union(&out), LE_SUCCESS);
+
+        memset(grid, 0, sizeof(grid));
+
+        cover(&in, 1);
+        cover(&out, 2);
+
+        for(x = 0; x < GRID * GRID; x++)
+        {
+            HOST_TEST_CHECK(grid[x] == 0 || grid[x] == 3);
+        }
+
+        // sorted by Y, then X
+        for(i = 1; i < out.size; i++)
+        {
+            HOST_TEST_CHECK(out.rects[i - 1].y < out.rects[i].y ||
+                            (out.rects[i - 1].y == out.rects[i].y &&
+                             out.rects[i - 1].x < out.rects[i].x));
+        }
+    }
+
+    leRectArray_Destroy(&in);
+    leRectArray_Destroy(&out);
+}
+
+/* the segments of a graph scrolling one column per sample, each joins the
+   last sample to the new one and every sample repaints the column it
+   leaves */
+static void buildGraph(leRectArray* arr)
+{
+    leRect rect;
+    int32_t i, last = GRID / 2, value, col;
+
+    for(i = 0; i < GRAPH_POINTS; i++)
+    {
+        col = i % GRID;
+        value = last + rnd(13) - 6;
+
+        if(value < 0)
+            value = 0;
+
+        if(value >= GRID)
+            value = GRID - 1;
+
+        rect.x = col;
+        rect.y = value < last ? value : last;
+        rect.width = 2;
+        rect.height = (value < last ? last - value : value - last) + 1;
+
+        if(rect.x + rect.width > GRID)
+            rect.width = GRID - rect.x;
+
+        leRectArray_PushBack(arr, &rect);
+
+        last = value;
+    }
+}
+
+/* a glyph rect for every character of a screen of text retyped a few
+   times, with the cursor cell before each character */
+static void buildText(leRectArray* arr)
+{
+    leRect rect;
+    int32_t pass, x, y;
+
+    rect.width = GLYPH_WIDTH;
+    rect.height = GLYPH_HEIGHT;
+
+    for(pass = 0; pass < TEXT_UPDATES; pass++)
+    {
+        for(y = 0; y + GLYPH_HEIGHT <= GRID; y += GLYPH_HEIGHT + 2)
+        {
+            for(x = 0; x + GLYPH_WIDTH <= GRID; x += GLYPH_WIDTH)
+            {
+                rect.x = x;
+                rect.y = y;
+
+                leRectArray_PushBack(arr, &rect);
+
+                rect.x = x + GLYPH_WIDTH - 1;
+                rect.width = 1;
+
+                leRectArray_PushBack(arr, &rect);
+
+                rect.width = GLYPH_WIDTH;
+            }
+        }
+    }
+}
+
+static void legacy(leRectArray* arr)
+{
+    leRectArray_RemoveDuplicates(arr);
+    leRectArray_MergeSimilar(arr);
+    leRectArray_RemoveOverlapping(arr);
+}
+
+static void bench(const char* name, const leRectArray* in)
+{
+    leRectArray work;
+    uint32_t run, unionRects, unionArea, covered, x;
+    clock_t unionTime, legacyTime;
+
+    leRectArray_Create(&work);
+
+    memset(grid, 0, sizeof(grid));
+    cover(in, 1);
+
+    for(covered = 0, x = 0; x < GRID * GRID; x++)
+    {
+        covered += grid[x];
+    }
+
+    unionTime = clock();
+
+    for(run = 0; run < RUNS; run++)
+    {
+        copy(in, &work);
+
+        HOST_TEST_EQUAL(leRectArray_Union(&work), LE_SUCCESS);
+    }
+
+    unionTime = clock() - unionTime;
+    unionRects = work.size;
+    unionArea = area(&work);
+
+    // the union sends every damaged pixel once
+    HOST_TEST_EQUAL(unionArea, covered);
+
+    legacyTime = clock();
+
+    for(run = 0; run < RUNS; run++)
+    {
+        copy(in, &work);
+        legacy(&work);
+    }
+
+    legacyTime = clock() - legacyTime;
+
+    printf("%-10s %4u rects %5u pixels | union %3u rects %5u pixels %8.1f us"
+           " | pairwise %3u rects %5u pixels %8.1f us\n",
+           name,
+           (unsigned)in->size,
+           (unsigned)covered,
+           (unsigned)unionRects,
+           (unsigned)unionArea,
+           (double)unionTime * 1e6 / CLOCKS_PER_SEC / RUNS,
+           (unsigned)work.size,
+           (unsigned)area(&work),
+           (double)legacyTime * 1e6 / CLOCKS_PER_SEC / RUNS);
+
+    HOST_TEST_CHECK(area(&work) >= covered);
+
+    leRectArray_Destroy(&work);
+}
+
+static void benchRenderer(const leRectArray* text)
+{
+    uint32_t i;
+    clock_t cpu;
+
+    cpu = clock();
+
+    for(i = 0; i < text->size; i++)
+    {
+        leRenderer_DamageArea(&text->rects[i], 0);
+    }
+
+    HOST_APP_RunUntilIdle(1000);
+
+    cpu = clock() - cpu;
+
+    HOST_TEST_CHECK(HOST_APP_IsIdle() == true);
+
+    printf("renderer   %4u invalidations drawn in %.3f ms\n",
+           (unsigned)text->size,
+           (double)cpu * 1000.0 / CLOCKS_PER_SEC);
+}
+
+int main(void)
+{
+    leRectArray graph, text;
+
+    HOST_APP_Initialize();
+
+    testRandom();
+
+    leRectArray_Create(&graph);
+    leRectArray_Create(&text);
+
+    buildGraph(&graph);
+    buildText(&text);
+
+    HOST_TEST_CHECK(graph.size >= 100 && text.size >= 100);
+
+    bench("line graph", &graph);
+    bench("text", &text);
+
+    benchRenderer(&text);
+
+    leRectArray_Destroy(&graph);
+    leRectArray_Destroy(&text);
+
+    return 0;
+}
@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+  Glyph Lookup Benchmark
+
+  File Name:
+    bench_font.c
+
+  Summary:
+    Times glyph lookups and string layout with each glyph lookup index.
+
+  Description:
+    Copies NotoMono_Regular with a range index, as le_font_rle.py writes it,
+    a sorted index and no index, checks that all three find the same glyph
+    for every code point up to LOOKUP_RANGE and that a stale range index is
+    ignored, and prints the hash of what they found to stdout. The time per
+    lookup and per layout of a text line go to stderr. Built once with
+    LE_FONT_GLYPH_RECENT_COUNT 0 and once with a recent list, the stdout of
+    both has to match.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "definitions.h"
+#include "gfx/legato/string/legato_stringutils.h"
+#include "host_test.h"
+
+#define LOOKUP_RANGE    0x3000
+#define RUNS            2000
+
+static const char text[] = "The quick brown fox jumps over the lazy dog 0123456789";
+
+static leRasterFont fonts[3];
+
+static const char* names[] =
+{
+    "range",
+    "sorted",
+    "none",
+};
+
+static uint32_t lookupHash(const leFont* font)
+{
+    leFontGlyph glyph;
+    uint32_t cp, hash = 0;
+
+    for(cp = 0; cp < LOOKUP_RANGE; cp++)
+    {
+        memset(&glyph, 0, sizeof(glyph));
+
+        if(leFont_GetGlyphInfo(font, cp, &glyph) == LE_SUCCESS)
+        {
+            hash = (hash ^ glyph.codePoint) * 16777619u;
+            hash = (hash ^ glyph.dataOffset) * 16777619u;
+        }
+    }
+
+    return hash;
+}
+
+static double lookupNs(const leFont* font)
+{
+    leFontGlyph glyph;
+    uint32_t run, cp;
+    clock_t cpu = clock();
+
+    for(run = 0; run < RUNS; run++)
+    {
+        for(cp = 0x20; cp < 0x7F; cp++)
+        {
+            leFont_GetGlyphInfo(font, cp, &glyph);
+        }
+    }
+
+    cpu = clock() - cpu;
+
+    return (double)cpu * 1e9 / CLOCKS_PER_SEC / RUNS / (0x7F - 0x20);
+}
+
+static double layoutUs(const leFont* font, leRect* rect)
+{
+    uint32_t run;
+    clock_t cpu = clock();
+
+    for(run = 0; run < RUNS; run++)
+    {
+        leStringUtils_GetRectCStr(text, font, rect);
+    }
+
+    cpu = clock() - cpu;
+
+    return (double)cpu * 1e6 / CLOCKS_PER_SEC / RUNS;
+}
+
+int main(void)
+{
+    leRasterFont stale;
+    leRect rect;
+    uint32_t i, hash[3];
+
+    HOST_TEST_EQUAL(NotoMono_Regular.index.mode, LE_FONT_GLYPH_INDEX_RANGE);
+
+    for(i = 0; i < 3; i++)
+    {
+        fonts[i] = NotoMono_Regular;
+    }
+
+    fonts[1].index.mode = LE_FONT_GLYPH_INDEX_SORTED;
+    fonts[2].index.mode = LE_FONT_GLYPH_INDEX_NONE;
+
+    for(i = 0; i < 3; i++)
+    {
+        hash[i] = lookupHash((leFont*)&fonts[i]);
+
+        HOST_TEST_EQUAL(hash[i], hash[0]);
+    }
+
+    // an index written for another glyph table
+    stale = NotoMono_Regular;
+    stale.index.first = 0x21;
+
+    HOST_TEST_EQUAL(lookupHash((leFont*)&stale), hash[0]);
+
+    printf("lookups up to 0x%X: %08x\n", (unsigned)LOOKUP_RANGE, (unsigned)hash[0]);
+
+    for(i = 0; i < 3; i++)
+    {
+        fprintf(stderr, "%-6s %5.1f ns per lookup, %6.2f us per layout",
+                names[i],
+                lookupNs((leFont*)&fonts[i]),
+                layoutUs((leFont*)&fonts[i], &rect));
+        fprintf(stderr, " of %dx%d\n", rect.width, rect.height);
+    }
+
+    printf("layout: %dx%d\n", rect.width, rect.height);
+
+    return 0;
+}
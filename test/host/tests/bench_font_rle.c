@@ -0,0 +1,224 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+  Compressed Font Benchmark
+
+  File Name:
+    bench_font_rle.c
+
+  Summary:
+    Compares the flash and decode time of run length encoded and raw glyphs.
+
+  Description:
+    Builds a raw copy of each font in le_gen_fonts.c, the glyphs decoded and
+    laid out the way the generator writes them, four byte aligned. Fails
+    unless every encoded glyph ends where the next one starts and both
+    copies read back the same rows. Prints the glyph data bytes of both and
+    the hash of the rows to stdout and the time per row read through
+    leFontGlyphDecoder to stderr.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "definitions.h"
+#include "host_test.h"
+
+#define FIRST_CODE      0x20
+#define LAST_CODE       0x7E
+#define GLYPH_COUNT     (LAST_CODE - FIRST_CODE + 1)
+#define GLYPH_SIZE      20      // bytes per kerning table entry
+#define GLYPH_FLAGS     12      // offset of the flags in an entry
+#define GLYPH_OFFSET    16      // offset of the data offset in an entry
+#define RAW_BYTES       4096
+#define RUNS            2000
+
+static const struct
+{
+    const char* name;
+    leRasterFont* font;
+} fonts[] =
+{
+    { "NotoSans_Bold", &NotoSans_Bold },
+    { "NotoMono_Regular", &NotoMono_Regular },
+};
+
+static uint8_t rawTable[4 + GLYPH_COUNT * GLYPH_SIZE];
+static uint8_t rawGlyphs[RAW_BYTES];
+static leRasterFont rawFont;
+
+static void setEntry(uint32_t idx, uint16_t flags, uint32_t offset)
+{
+    uint8_t* entry = rawTable + 4 + idx * GLYPH_SIZE;
+
+    entry[GLYPH_FLAGS] = flags & 0xFF;
+    entry[GLYPH_FLAGS + 1] = flags >> 8;
+
+    entry[GLYPH_OFFSET] = offset & 0xFF;
+    entry[GLYPH_OFFSET + 1] = (offset >> 8) & 0xFF;
+    entry[GLYPH_OFFSET + 2] = (offset >> 16) & 0xFF;
+    entry[GLYPH_OFFSET + 3] = offset >> 24;
+}
+
+/* decodes every glyph of font into rawFont, returns the glyphs encoded */
+static uint32_t buildRaw(const leRasterFont* font)
+{
+    leFontGlyph glyph;
+    leFontGlyphDecoder dec;
+    const uint8_t* data;
+    uint32_t idx, row, size = 0, encoded = 0, end = 0;
+
+    memcpy(rawTable, font->glyphTable, sizeof(rawTable));
+
+    HOST_TEST_EQUAL(rawTable[0], GLYPH_COUNT);
+
+    for(idx = 0; idx < GLYPH_COUNT; idx++)
+    {
+        HOST_TEST_EQUAL(leFont_GetGlyphInfo(&font->base, FIRST_CODE + idx, &glyph), LE_SUCCESS);
+
+        data = (const uint8_t*)font->base.header.address + glyph.dataOffset;
+
+        // encoded glyphs are packed back to back
+        HOST_TEST_EQUAL(glyph.dataOffset, end);
+
+        HOST_TEST_EQUAL(leFont_InitGlyphDecoder(&dec, &glyph, data), LE_SUCCESS);
+
+        size += -size % 4;
+
+        for(row = 0; row < (uint32_t)glyph.height; row++)
+        {
+            HOST_TEST_CHECK(size + glyph.dataRowWidth <= RAW_BYTES);
+
+            memcpy(rawGlyphs + size + row * glyph.dataRowWidth,
+                   leFont_DecodeGlyphRow(&dec),
+                   glyph.dataRowWidth);
+        }
+
+        end = (uint32_t)(dec.data - (const uint8_t*)font->base.header.address);
+
+        if((glyph.flags & LE_FONT_GLYPH_RLE) != 0)
+        {
+            encoded++;
+        }
+
+        setEntry(idx, glyph.flags & ~LE_FONT_GLYPH_RLE, size);
+
+        size += glyph.dataRowWidth * glyph.height;
+    }
+
+    HOST_TEST_EQUAL(end, font->base.header.size);
+
+    rawFont = *font;
+    rawFont.base.header.address = rawGlyphs;
+    rawFont.base.header.size = size + -size % 4;
+    rawFont.glyphTable = rawTable;
+
+    return encoded;
+}
+
+/* reads every row of every glyph, returns their hash */
+static uint32_t readRows(const leRasterFont* font)
+{
+    leFontGlyph glyph;
+    leFontGlyphDecoder dec;
+    const uint8_t* data;
+    uint32_t idx, row, i, hash = 2166136261u;
+
+    for(idx = 0; idx < GLYPH_COUNT; idx++)
+    {
+        leFont_GetGlyphInfo(&font->base, FIRST_CODE + idx, &glyph);
+
+        leFont_InitGlyphDecoder(&dec, &glyph, (const uint8_t*)font->base.header.address + glyph.dataOffset);
+
+        for(row = 0; row < (uint32_t)glyph.height; row++)
+        {
+            data = leFont_DecodeGlyphRow(&dec);
+
+            for(i = 0; i < glyph.dataRowWidth; i++)
+            {
+                hash = (hash ^ data[i]) * 16777619u;
+            }
+        }
+    }
+
+    return hash;
+}
+
+static double rowNs(const leRasterFont* font)
+{
+    leFontGlyph glyph;
+    uint32_t run, idx, rows = 0;
+    clock_t cpu;
+
+    for(idx = 0; idx < GLYPH_COUNT; idx++)
+    {
+        leFont_GetGlyphInfo(&font->base, FIRST_CODE + idx, &glyph);
+
+        rows += glyph.height;
+    }
+
+    cpu = clock();
+
+    for(run = 0; run < RUNS; run++)
+    {
+        readRows(font);
+    }
+
+    cpu = clock() - cpu;
+
+    return (double)cpu * 1e9 / CLOCKS_PER_SEC / RUNS / rows;
+}
+
+int main(void)
+{
+    uint32_t i, encoded, hash;
+
+    printf("font              encoded glyphs  raw bytes  encoded bytes  row hash\n");
+
+    for(i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++)
+    {
+        encoded = buildRaw(fonts[i].font);
+        hash = readRows(fonts[i].font);
+
+        HOST_TEST_CHECK(encoded > 0);
+        HOST_TEST_EQUAL(readRows(&rawFont), hash);
+        HOST_TEST_CHECK(fonts[i].font->base.header.size < rawFont.base.header.size);
+
+        printf("%-17s %14u %10u %14u  %08X\n",
+               fonts[i].name,
+               (unsigned)encoded,
+               (unsigned)rawFont.base.header.size,
+               (unsigned)fonts[i].font->base.header.size,
+               (unsigned)hash);
+
+        fprintf(stderr, "%s: %.1f ns per encoded row, %.1f ns per raw row\n",
+                fonts[i].name,
+                rowNs(fonts[i].font),
+                rowNs(&rawFont));
+    }
+
+    return 0;
+}
@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+  Image Cache Benchmark
+
+  File Name:
+    bench_image_cache.c
+
+  Summary:
+    Times repaints of the JPEG logo with and without the image cache.
+
+  Description:
+    Shows the logo, then damages its rectangle REPAINTS times and runs each
+    repaint to the end. Built once with LE_IMAGE_CACHE_ENABLED and once
+    without, it prints a hash of the panel after the repaints to stdout,
+    where the two builds have to agree, and the CPU time per repaint and
+    the cache counters to stderr.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <time.h>
+
+#include "definitions.h"
+#include "host_app.h"
+#include "host_test.h"
+
+#define REPAINTS    200
+
+static uint32_t frameHash(void)
+{
+    const uint16_t* frame = HOST_APP_Frame();
+    uint32_t i, hash = 0;
+
+    for(i = 0; i < HOST_APP_WIDTH * HOST_APP_HEIGHT; i++)
+    {
+        hash = (hash ^ frame[i]) * 16777619u;
+    }
+
+    return hash;
+}
+
+int main(void)
+{
+    leRect rect;
+    uint32_t i;
+    clock_t cpu;
+#if LE_IMAGE_CACHE_ENABLED == 1
+    leImageCacheStats stats;
+#endif
+
+    HOST_APP_Initialize();
+
+    // text updates show the logo
+    HOST_TEST_CHECK(HOST_APP_BleText(2, "logo") == true);
+    HOST_APP_RunUntilIdle(1000);
+
+    HOST_TEST_CHECK(Screen0_mchplogo->fn->getVisible(Screen0_mchplogo) == LE_TRUE);
+
+    Screen0_mchplogo->fn->localRect(Screen0_mchplogo, &rect);
+    Screen0_mchplogo->fn->rectToScreen(Screen0_mchplogo, &rect);
+
+    cpu = clock();
+
+    for(i = 0; i < REPAINTS; i++)
+    {
+        HOST_TEST_EQUAL(leRenderer_DamageArea(&rect, 0), LE_SUCCESS);
+        HOST_APP_RunUntilIdle(1000);
+    }
+
+    cpu = clock() - cpu;
+
+    HOST_TEST_CHECK(HOST_APP_IsIdle() == true);
+
+    printf("logo %dx%d after %u repaints, frame %08x\n",
+           rect.width,
+           rect.height,
+           (unsigned)REPAINTS,
+           (unsigned)frameHash());
+
+#if LE_IMAGE_CACHE_ENABLED == 1
+    leImageCache_GetStats(&stats);
+
+    fprintf(stderr, "cache:   %.1f us per repaint, %u hits, %u misses, %u evictions, %u bytes\n",
+            (double)cpu * 1e6 / CLOCKS_PER_SEC / REPAINTS,
+            (unsigned)stats.hits,
+            (unsigned)stats.misses,
+            (unsigned)stats.evictions,
+            (unsigned)stats.bytes);
+
+    HOST_TEST_CHECK(stats.hits >= REPAINTS);
+#else
+    fprintf(stderr, "decoder: %.1f us per repaint\n",
+            (double)cpu * 1e6 / CLOCKS_PER_SEC / REPAINTS);
+#endif
+
+    return 0;
+}
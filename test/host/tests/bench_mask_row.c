@@ -0,0 +1,278 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+  Mask Row Benchmark
+
+  File Name:
+    bench_mask_row.c
+
+  Summary:
+    Checks leRenderer_PutMaskRow against per pixel writes and times both.
+
+  Description:
+    In each scratch format the console offers, RGB565, 4bpp gray, 1bpp mono
+    and the 8bpp global palette, draws random 1bpp mask rows with random
+    column ranges once with leRenderer_PutMaskRow and once with a
+    leRenderer_PutPixel per set bit, the way glyph rows were drawn before,
+    and fails unless both leave the same pixels. Then prints the pixels per
+    second of both paths drawing glyph sized rows.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "definitions.h"
+#include "host_app.h"
+#include "host_paint.h"
+#include "host_test.h"
+
+#define MASK_BYTES      4
+#define MASK_BITS       (MASK_BYTES * 8)
+#define CHECK_ROWS      200
+#define BENCH_ROWS      200000
+#define GLYPH_WIDTH     12
+
+static const uint16_t grayPaletteData[16] =
+{
+    0x0000,0x1082,0x2104,0x3186,0x4228,0x52AA,0x632C,0x73AE,
+    0x8C51,0x9CD3,0xAD55,0xBDD7,0xCE79,0xDEFB,0xEF7D,0xFFFF,
+};
+
+static const uint16_t monoPaletteData[2] =
+{
+    0x0000,0xFFFF,
+};
+
+static const lePalette grayPalette =
+{
+    {
+        LE_STREAM_LOCATION_ID_INTERNAL,
+        (void*)grayPaletteData,
+        sizeof(grayPaletteData),
+    },
+    16,
+    LE_COLOR_MODE_RGB_565
+};
+
+static const lePalette monoPalette =
+{
+    {
+        LE_STREAM_LOCATION_ID_INTERNAL,
+        (void*)monoPaletteData,
+        sizeof(monoPaletteData),
+    },
+    2,
+    LE_COLOR_MODE_RGB_565
+};
+
+static const struct
+{
+    const char* name;
+    const lePalette* palette;
+} formats[] =
+{
+    { "rgb565", NULL },
+    { "4bpp gray", &grayPalette },
+    { "1bpp mono", &monoPalette },
+    { "8bpp global", &leGlobalPalette },
+};
+
+static const leColor colors[] =
+{
+    0xFFFF, 0x0000, 0xF800, 0x07E0, 0x001F, 0x8410,
+};
+
+static uint32_t seed = 1;
+static uint32_t checked;
+static clock_t maskTime;
+static clock_t pixelTime;
+static uint32_t benchPixels;
+
+static int32_t rnd(int32_t range)
+{
+    seed = seed * 1103515245u + 12345u;
+
+    return (int32_t)((seed >> 8) % (uint32_t)range);
+}
+
+static void putPixels(int32_t x,
+                      int32_t y,
+                      const uint8_t* mask,
+                      int32_t colStart,
+                      int32_t colEnd,
+                      leColor clr)
+{
+    int32_t col;
+
+    for(col = colStart; col < colEnd; col++)
+    {
+        if((mask[col >> 3] & (0x80 >> (col & 0x7))) != 0)
+        {
+            leRenderer_PutPixel(x + col, y, clr);
+        }
+    }
+}
+
+static void readRow(int32_t x, int32_t y, leColor* row)
+{
+    int32_t col;
+
+    for(col = 0; col < MASK_BITS; col++)
+    {
+        row[col] = leRenderer_GetPixel(x + col, y);
+    }
+}
+
+static void writeRow(int32_t x, int32_t y, const leColor* row)
+{
+    int32_t col;
+
+    for(col = 0; col < MASK_BITS; col++)
+    {
+        leRenderer_PutPixel(x + col, y, row[col]);
+    }
+}
+
+static void check(const leRect* frame)
+{
+    uint8_t mask[MASK_BYTES];
+    leColor before[MASK_BITS];
+    leColor fast[MASK_BITS];
+    leColor slow[MASK_BITS];
+    int32_t i, b, x, y, colStart, colEnd;
+    leColor clr;
+
+    for(i = 0; i < CHECK_ROWS; i++)
+    {
+        for(b = 0; b < MASK_BYTES; b++)
+        {
+            mask[b] = (uint8_t)rnd(256);
+        }
+
+        x = frame->x + rnd(frame->width - MASK_BITS + 1);
+        y = frame->y + rnd(frame->height);
+        colStart = rnd(MASK_BITS);
+        colEnd = colStart + rnd(MASK_BITS - colStart + 1);
+        clr = colors[rnd(sizeof(colors) / sizeof(colors[0]))];
+
+        readRow(x, y, before);
+
+        leRenderer_PutMaskRow(x, y, mask, colStart, colEnd, clr);
+        readRow(x, y, fast);
+        writeRow(x, y, before);
+
+        putPixels(x, y, mask, colStart, colEnd, clr);
+        readRow(x, y, slow);
+        writeRow(x, y, before);
+
+        if(memcmp(fast, slow, sizeof(fast)) != 0)
+        {
+            fprintf(stderr, "row at %d,%d columns %d-%d mask %02X%02X%02X%02X differs\n",
+                    (int)x, (int)y, (int)colStart, (int)colEnd,
+                    mask[0], mask[1], mask[2], mask[3]);
+            exit(1);
+        }
+
+        checked++;
+    }
+}
+
+static void bench(const leRect* frame)
+{
+    static const uint8_t glyph[2] = { 0x3C, 0xF0 };
+    clock_t cpu;
+    int32_t i;
+
+    benchPixels = BENCH_ROWS * GLYPH_WIDTH;
+
+    cpu = clock();
+
+    for(i = 0; i < BENCH_ROWS; i++)
+    {
+        leRenderer_PutMaskRow(frame->x, frame->y + i % frame->height, glyph, 0, GLYPH_WIDTH, 0xFFFF);
+    }
+
+    maskTime = clock() - cpu;
+    cpu = clock();
+
+    for(i = 0; i < BENCH_ROWS; i++)
+    {
+        putPixels(frame->x, frame->y + i % frame->height, glyph, 0, GLYPH_WIDTH, 0xFFFF);
+    }
+
+    pixelTime = clock() - cpu;
+}
+
+static void paint(const leRect* frame)
+{
+    check(frame);
+
+    if(benchPixels == 0)
+    {
+        bench(frame);
+    }
+}
+
+static double pixelsPerSecond(clock_t cpu)
+{
+    if(cpu == 0)
+    {
+        cpu = 1;
+    }
+
+    return (double)benchPixels * CLOCKS_PER_SEC / (double)cpu / 1e6;
+}
+
+int main(void)
+{
+    uint32_t i;
+
+    HOST_APP_Initialize();
+
+    printf("format       rows checked  mask row Mpx/s  per pixel Mpx/s\n");
+
+    for(i = 0; i < sizeof(formats) / sizeof(formats[0]); i++)
+    {
+        HOST_TEST_EQUAL(leRenderer_SetScratchPalette(formats[i].palette), LE_SUCCESS);
+        HOST_APP_RunUntilIdle(1000);
+
+        checked = 0;
+        benchPixels = 0;
+
+        HOST_PAINT_Run(paint);
+
+        HOST_TEST_CHECK(checked > 0);
+        HOST_TEST_CHECK(benchPixels > 0);
+
+        printf("%-12s %12u %15.1f %16.1f\n",
+               formats[i].name,
+               (unsigned)checked,
+               pixelsPerSecond(maskTime),
+               pixelsPerSecond(pixelTime));
+    }
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+  Scratch Buffer Overlap Benchmark
+
+  File Name:
+    bench_overlap.c
+
+  Summary:
+    Times frames with drawing and SPI transfers overlapping or not.
+
+  Description:
+    Covers the screen with a blended fill and takes it away again, then
+    runs a round of text changes, with the Legato task charged CPU_SCALE
+    times its host CPU time and the SPI mock sending at the bus speed.
+    Prints the time the Legato task or the bus was busy, the drawing time,
+    the time on the wire and how much of the drawing happened while a
+    transfer was on the wire. Built once with LE_SCRATCH_BUFFER_COUNT 1,
+    where the renderer waits for each blit to finish before drawing the
+    next rectangle, and once with 2, where it draws the next one meanwhile.
+    With two buffers fails unless drawing overlaps transfers. The first
+    argument overrides the CPU scale.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "definitions.h"
+#include "host_app.h"
+#include "host_paint.h"
+#include "host_spi.h"
+#include "host_test.h"
+
+/* roughly how much longer the 64 MHz WBZ451 takes than a desktop core */
+#define CPU_SCALE   40
+
+static const char* texts[] =
+{
+    "Hello",
+    "12:34 21.5C",
+    "the quick brown fox",
+    "",
+};
+
+static void report(const char* name)
+{
+    HOST_APP_STATS app;
+    HOST_SPI_STATS spi;
+
+    HOST_APP_GetStats(&app);
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_EQUAL(spi.violations, 0);
+
+    printf("%-8s %7u %9.2f %8.2f %8.2f %10.2f\n",
+           name,
+           (unsigned)LE_SCRATCH_BUFFER_COUNT,
+           (double)app.activeNs / 1e6,
+           (double)app.legatoNs / 1e6,
+           (double)spi.wireNs / 1e6,
+           (double)app.overlapNs / 1e6);
+
+    HOST_TEST_CHECK(app.activeNs <= app.legatoNs + spi.wireNs + 1000000u);
+
+#if LE_SCRATCH_BUFFER_COUNT > 1
+    HOST_TEST_CHECK(app.overlapNs > 0);
+#endif
+}
+
+static void fill(const leRect* frame)
+{
+    leRenderer_FillArea(frame->x, frame->y, frame->width, frame->height, 0x07FF, 160);
+}
+
+static void reset(void)
+{
+    HOST_APP_ResetStats();
+    HOST_SPI_ResetStats();
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t scale = CPU_SCALE;
+    uint32_t i;
+
+    if(argc > 1)
+    {
+        scale = (uint32_t)atoi(argv[1]);
+    }
+
+    HOST_APP_Initialize();
+    HOST_APP_SetCpuScale(scale);
+
+    printf("cpu scale %u\n", (unsigned)scale);
+    printf("workload buffers busy ms  draw ms  wire ms  overlap ms\n");
+
+    reset();
+    HOST_PAINT_Run(fill);
+
+    HOST_TEST_CHECK(HOST_APP_IsIdle() == true);
+
+    report("fill");
+
+    reset();
+
+    for(i = 0; i < sizeof(texts) / sizeof(texts[0]); i++)
+    {
+        HOST_TEST_CHECK(HOST_APP_BleText(2, texts[i]) == true);
+        HOST_APP_RunUntilIdle(1000);
+
+        HOST_TEST_CHECK(HOST_APP_IsIdle() == true);
+    }
+
+    report("text");
+
+    return 0;
+}
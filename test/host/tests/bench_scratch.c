@@ -0,0 +1,193 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+  Scratch Format Benchmark
+
+  File Name:
+    bench_scratch.c
+
+  Summary:
+    Compares Screen0 drawn into RGB565 and palette indexed scratch buffers.
+
+  Description:
+    Switches the scratch buffers through the formats the console offers,
+    RGB565, 4bpp gray, 1bpp mono and the 8bpp global palette, and for each
+    prints the pixels the scratch RAM holds, the blits of the repaint after
+    the switch and of a round of text changes, the bytes on the wire and
+    the CPU time. The scratch RAM is the same in every format, the indexed
+    ones add the driver's 512 byte palette. Fails unless the indexed
+    formats repaint the screen in fewer blits than RGB565.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <time.h>
+
+#include "definitions.h"
+#include "host_app.h"
+#include "host_spi.h"
+#include "host_test.h"
+
+#define SCRATCH_BYTES   (LE_SCRATCH_BUFFER_SIZE_KB * 1024)
+
+/* the driver keeps 256 RGB565 colors for the indexed formats */
+#define PALETTE_BYTES   512
+
+static const uint16_t grayPaletteData[16] =
+{
+    0x0000,0x1082,0x2104,0x3186,0x4228,0x52AA,0x632C,0x73AE,
+    0x8C51,0x9CD3,0xAD55,0xBDD7,0xCE79,0xDEFB,0xEF7D,0xFFFF,
+};
+
+static const uint16_t monoPaletteData[2] =
+{
+    0x0000,0xFFFF,
+};
+
+static const lePalette grayPalette =
+{
+    {
+        LE_STREAM_LOCATION_ID_INTERNAL,
+        (void*)grayPaletteData,
+        sizeof(grayPaletteData),
+    },
+    16,
+    LE_COLOR_MODE_RGB_565
+};
+
+static const lePalette monoPalette =
+{
+    {
+        LE_STREAM_LOCATION_ID_INTERNAL,
+        (void*)monoPaletteData,
+        sizeof(monoPaletteData),
+    },
+    2,
+    LE_COLOR_MODE_RGB_565
+};
+
+static const struct
+{
+    const char* name;
+    const lePalette* palette;
+    uint32_t bpp;
+} formats[] =
+{
+    { "rgb565", NULL, 16 },
+    { "4bpp gray", &grayPalette, 4 },
+    { "1bpp mono", &monoPalette, 1 },
+    { "8bpp global", &leGlobalPalette, 8 },
+};
+
+static const char* texts[] =
+{
+    "Hello",
+    "12:34 21.5C",
+    "the quick brown fox",
+    "",
+};
+
+static void reset(void)
+{
+    leRenderer_ResetDamageStats();
+    HOST_SPI_ResetStats();
+}
+
+static uint32_t blits(void)
+{
+    leDamageStats stats;
+
+    HOST_TEST_EQUAL(leRenderer_GetDamageStats(&stats), LE_SUCCESS);
+
+    return stats.blitCount;
+}
+
+static uint32_t wireBytes(void)
+{
+    HOST_SPI_STATS spi;
+
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_EQUAL(spi.violations, 0);
+
+    return spi.commandBytes + spi.dataBytes;
+}
+
+int main(void)
+{
+    uint32_t repaint[sizeof(formats) / sizeof(formats[0])];
+    uint32_t i, t, text, bytes;
+    clock_t cpu;
+
+    HOST_APP_Initialize();
+
+    printf("format       pixels/buffer  ram bytes  repaint blits  text blits  wire bytes  cpu ms\n");
+
+    for(i = 0; i < sizeof(formats) / sizeof(formats[0]); i++)
+    {
+        HOST_TEST_EQUAL(leRenderer_SetScratchPalette(formats[i].palette), LE_SUCCESS);
+        HOST_APP_RunUntilIdle(1000);
+
+        HOST_TEST_CHECK(HOST_APP_IsIdle() == true);
+
+        // the switch repaints, except to RGB565 at the start, so repaint again
+        reset();
+        leRenderer_DamageArea(&leGetLayerState(0)->root.rect, 0);
+        HOST_APP_RunUntilIdle(1000);
+
+        repaint[i] = blits();
+
+        reset();
+        cpu = clock();
+
+        for(t = 0; t < sizeof(texts) / sizeof(texts[0]); t++)
+        {
+            HOST_TEST_CHECK(HOST_APP_BleText(2, texts[t]) == true);
+            HOST_APP_RunUntilIdle(1000);
+        }
+
+        cpu = clock() - cpu;
+        text = blits();
+        bytes = wireBytes();
+
+        printf("%-12s %13u %10u %14u %11u %11u %7.3f\n",
+               formats[i].name,
+               (unsigned)(SCRATCH_BYTES * 8 / formats[i].bpp),
+               (unsigned)(LE_SCRATCH_BUFFER_COUNT * SCRATCH_BYTES +
+                          (formats[i].palette != NULL ? PALETTE_BYTES : 0)),
+               (unsigned)repaint[i],
+               (unsigned)text,
+               (unsigned)bytes,
+               (double)cpu * 1000.0 / CLOCKS_PER_SEC);
+
+        HOST_TEST_CHECK(repaint[i] > 0);
+
+        if(i > 0)
+        {
+            HOST_TEST_CHECK(repaint[i] < repaint[0]);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,20 @@
+# Runs two builds of a host test and fails unless both pass and print the
+# same output.
+#
+#   cmake -DFIRST=<executable> -DSECOND=<executable> -P compare_output.cmake
+
+foreach(run FIRST SECOND)
+    execute_process(COMMAND ${${run}}
+                    RESULT_VARIABLE result
+                    OUTPUT_VARIABLE output_${run})
+
+    message("${${run}}:\n${output_${run}}")
+
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${${run}} failed: ${result}")
+    endif()
+endforeach()
+
+if(NOT output_FIRST STREQUAL output_SECOND)
+    message(FATAL_ERROR "the outputs differ")
+endif()
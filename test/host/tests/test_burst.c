@@ -0,0 +1,172 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+  BLE Burst Host Test
+
+  File Name:
+    test_burst.c
+
+  Summary:
+    Sends a 1 kHz burst of text updates and checks the display keeps up.
+
+  Description:
+    Posts BURST_COUNT line 2 updates one millisecond apart with a line 1
+    update every tenth of them, the way back to back TRSPS packets arrive,
+    and prints how many the command queue merged, applied and dropped and
+    how many frames were drawn. Fails if more frames are drawn than the
+    LE_COMMAND_MAX_FPS limit allows, if an update is lost instead of merged
+    or if the panel doesn't show the last text of both lines within one
+    frame period and the time to send it after the burst.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "definitions.h"
+#include "host_app.h"
+#include "host_test.h"
+
+#define BURST_COUNT     1000
+#define LINE1_EVERY     10
+#define STEP_LIMIT_MS   1000
+
+#define FRAME_MS            (1000 / LE_COMMAND_MAX_FPS)
+
+/* a frame period plus a full screen at the 4 MHz pixel clock */
+#define SETTLE_LIMIT_MS     (FRAME_MS + 40)
+
+static uint16_t burstFrame[HOST_APP_WIDTH * HOST_APP_HEIGHT];
+
+static void lineText(char* text, size_t size, uint8_t line, uint32_t i)
+{
+    snprintf(text, size, line == 1 ? "count %u" : "value %u", (unsigned)i);
+}
+
+static uint32_t settle(void)
+{
+    uint32_t ms;
+
+    for(ms = 1; ms <= STEP_LIMIT_MS; ms++)
+    {
+        HOST_APP_Run(1);
+
+        if(HOST_APP_IsIdle() == true)
+            break;
+    }
+
+    return ms;
+}
+
+int main(void)
+{
+    leCommandStats command;
+    leDamageStats damage;
+    char text[32];
+    uint32_t i, posted = 0, refused = 0, ms;
+
+    HOST_APP_Initialize();
+
+    leCommand_ResetStats();
+    leRenderer_ResetDamageStats();
+
+    for(i = 0; i < BURST_COUNT; i++)
+    {
+        lineText(text, sizeof(text), 2, i);
+
+        if(HOST_APP_BleText(2, text) == true)
+        {
+            posted++;
+        }
+        else
+        {
+            refused++;
+        }
+
+        if(i % LINE1_EVERY == LINE1_EVERY - 1)
+        {
+            lineText(text, sizeof(text), 1, i / LINE1_EVERY);
+
+            if(HOST_APP_BleText(1, text) == true)
+            {
+                posted++;
+            }
+            else
+            {
+                refused++;
+            }
+        }
+
+        HOST_APP_Run(1);
+    }
+
+    ms = settle();
+
+    leCommand_GetStats(&command);
+    HOST_TEST_EQUAL(leRenderer_GetDamageStats(&damage), LE_SUCCESS);
+
+    printf("burst:   %u updates in %u ms, %u refused by the application queue\n",
+           (unsigned)(posted + refused), (unsigned)BURST_COUNT, (unsigned)refused);
+    printf("command: %u queued, %u full, %u merged, %u applied, %u batches\n",
+           (unsigned)command.queued,
+           (unsigned)command.full,
+           (unsigned)command.merged,
+           (unsigned)command.applied,
+           (unsigned)command.batches);
+    printf("frames:  %u, %u blits, final state %u ms after the burst\n",
+           (unsigned)damage.frameCount,
+           (unsigned)damage.blitCount,
+           (unsigned)ms);
+
+    // nothing is lost, only replaced by a later update of the same line
+    HOST_TEST_EQUAL(refused, 0);
+    HOST_TEST_EQUAL(command.full, 0);
+    // every update also shows the logo
+    HOST_TEST_EQUAL(command.queued, 2 * posted);
+    HOST_TEST_EQUAL(command.merged + command.applied, command.queued);
+    HOST_TEST_CHECK(command.merged > 0);
+
+    HOST_TEST_CHECK(damage.frameCount <= (BURST_COUNT + ms) / FRAME_MS + 1);
+    HOST_TEST_CHECK(ms <= SETTLE_LIMIT_MS);
+
+    memcpy(burstFrame, HOST_APP_Frame(), sizeof(burstFrame));
+
+    // clear both lines and set the last texts again one at a time, the panel
+    // must end up where the burst left it
+    HOST_TEST_CHECK(HOST_APP_BleText(1, "") == true);
+    HOST_TEST_CHECK(HOST_APP_BleText(2, "") == true);
+    settle();
+
+    HOST_TEST_CHECK(memcmp(burstFrame, HOST_APP_Frame(), sizeof(burstFrame)) != 0);
+
+    lineText(text, sizeof(text), 1, BURST_COUNT / LINE1_EVERY - 1);
+    HOST_TEST_CHECK(HOST_APP_BleText(1, text) == true);
+    lineText(text, sizeof(text), 2, BURST_COUNT - 1);
+    HOST_TEST_CHECK(HOST_APP_BleText(2, text) == true);
+    settle();
+
+    HOST_TEST_CHECK(memcmp(burstFrame, HOST_APP_Frame(), sizeof(burstFrame)) == 0);
+
+    return 0;
+}
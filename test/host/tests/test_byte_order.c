@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+  Scratch Byte Order Host Test
+
+  File Name:
+    test_byte_order.c
+
+  Summary:
+    Draws Screen0 with RGB565 scratch buffers and prints what went over the
+    wire.
+
+  Description:
+    Built once with LE_SCRATCH_BIG_ENDIAN 0, where the driver swaps every
+    pixel on the way out, and once with 1, where Legato draws in display
+    byte order and the driver sends the scratch buffers in place. The
+    shadow framebuffer is off so every blit goes out whole. ctest compares
+    the two outputs, which have to match: the same bytes with the same
+    RS/DCx levels for the startup screen and each text change. The
+    transfer counts, which differ, go to stderr.
+*******************************************************************************/
+
+#include <stdio.h>
+
+#include "definitions.h"
+#include "host_app.h"
+#include "host_spi.h"
+#include "host_test.h"
+
+static const struct
+{
+    uint8_t line;
+    const char* text;
+} steps[] =
+{
+    { 1, "  CONNECTED  " },
+    { 2, "Hello" },
+    { 2, "12:34 21.5C" },
+    { 2, "the quick brown fox" },
+    { 1, "DISCONNECTED" },
+    { 2, "" },
+};
+
+static uint32_t frameHash(void)
+{
+    const uint16_t* frame = HOST_APP_Frame();
+    uint32_t i, hash = 0;
+
+    for(i = 0; i < HOST_APP_WIDTH * HOST_APP_HEIGHT; i++)
+    {
+        hash = (hash ^ frame[i]) * 16777619u;
+    }
+
+    return hash;
+}
+
+static void report(const char* step)
+{
+    HOST_SPI_STATS spi;
+
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_EQUAL(spi.violations, 0);
+    HOST_TEST_CHECK(spi.dataBytes > 0);
+
+    printf("%-22s wire %08x, %u command bytes, %u data bytes, frame %08x\n",
+           step,
+           (unsigned)spi.wireHash,
+           (unsigned)spi.commandBytes,
+           (unsigned)spi.dataBytes,
+           (unsigned)frameHash());
+
+    fprintf(stderr, "%-22s %u transfers\n", step, (unsigned)spi.transfers);
+
+    HOST_SPI_ResetStats();
+}
+
+int main(void)
+{
+    uint32_t i;
+
+    HOST_APP_Initialize();
+
+    report("startup");
+
+    for(i = 0; i < sizeof(steps) / sizeof(steps[0]); i++)
+    {
+        HOST_TEST_CHECK(HOST_APP_BleText(steps[i].line, steps[i].text) == true);
+        HOST_APP_RunUntilIdle(1000);
+
+        report(steps[i].text);
+    }
+
+    return 0;
+}
@@ -0,0 +1,521 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  SSD1351 Graphics Processor Host Test
+
+  File Name:
+    test_gpu.c
+
+  Summary:
+    Checks the fills and copies of the SSD1351 graphics processor interface.
+
+  Description:
+    Compares DRV_SSD1351_GPU_FillRect and DRV_SSD1351_GPU_BlitBuffer against
+    a pixel at a time reference for both scratch buffer byte orders, odd
+    alignments and clipping, and checks that what they don't handle is
+    refused so Legato draws it itself. Then repaints Screen0 with and
+    without the interface installed and checks the panel ends up the same,
+    printing how many operations went to it and the CPU time of both.
+
+    The SPI bytes are measured on a four line terminal made of labels. New
+    lines are pushed in at the bottom once with a repaint of the shifted
+    lines and once with leRenderer_ScrollDisplay, which moves the picture
+    with the start line and repaints only the line scrolled into view.
+    Clearing a line is a solid fill, the SSD1351 has no fill command so it
+    costs the pixels it changes, compared with pushing every pixel of the
+    damaged area. The panel has to match the scene after each step.
+*******************************************************************************/
+
+#include <string.h>
+#include <time.h>
+
+#include "definitions.h"
+#include "host_app.h"
+#include "host_paint.h"
+#include "host_spi.h"
+#include "host_test.h"
+
+#define BUF_WIDTH       10
+#define BUF_HEIGHT      6
+#define SRC_WIDTH       12
+#define SRC_HEIGHT      5
+
+#define TERM_LINES      4
+#define TERM_LINE_H     (HOST_APP_HEIGHT / TERM_LINES)
+#define TERM_CHARS      16
+#define TERM_PUSHES     8
+
+#define WINDOW_BYTES    (HOST_APP_WIDTH * HOST_APP_HEIGHT * 2)
+#define LINE_BYTES      (HOST_APP_WIDTH * TERM_LINE_H * 2)
+
+/* start line and window commands of a push, generously */
+#define SETUP_BYTES     64
+
+static uint32_t destWords[BUF_WIDTH * BUF_HEIGHT / 2 + 1];
+static uint16_t expect[BUF_WIDTH * BUF_HEIGHT];
+static uint16_t source[SRC_WIDTH * SRC_HEIGHT];
+
+static const char* const termText[] =
+{
+    "conn 4A:1F ok",
+    "rx 23 bytes",
+    "temp 21.5 C",
+    "bat 87%",
+    "notify on",
+    "MTU 247",
+    "rssi -61",
+    "tx queue 3",
+    "link lost",
+    "adv start",
+};
+
+static leTextFieldWidget* termField[TERM_LINES];
+static leFixedString termString;
+static leChar termChars[TERM_CHARS];
+static uint32_t termNext;
+
+static uint16_t scene[HOST_APP_WIDTH * HOST_APP_HEIGHT];
+
+static uint32_t fills;
+static uint32_t fillsRefused;
+static uint32_t blits;
+static uint32_t blitsRefused;
+
+static uint16_t swap(uint16_t clr)
+{
+    return (uint16_t)((clr << 8) | (clr >> 8));
+}
+
+static void destCreate(gfxPixelBuffer* buf, uint32_t flags)
+{
+    uint16_t* pixels = (uint16_t*)destWords;
+    int32_t i;
+
+    gfxPixelBufferCreate(BUF_WIDTH, BUF_HEIGHT, GFX_COLOR_MODE_RGB_565, destWords, buf);
+
+    buf->flags = flags;
+
+    for(i = 0; i < BUF_WIDTH * BUF_HEIGHT; i++)
+    {
+        pixels[i] = (uint16_t)(0x8000 + i);
+        expect[i] = pixels[i];
+    }
+}
+
+static void checkDest(void)
+{
+    HOST_TEST_CHECK(memcmp(destWords, expect, sizeof(expect)) == 0);
+}
+
+static void testFill(void)
+{
+    static const gfxRect rects[] =
+    {
+        { 0, 0, BUF_WIDTH, BUF_HEIGHT },
+        { 1, 1, 3, 2 },     // odd start
+        { 2, 0, 4, 1 },     // even start, even width
+        { 1, 2, 1, 3 },     // single column
+        { -3, -2, 6, 4 },   // clipped top left
+        { 7, 4, 10, 10 },   // clipped bottom right
+    };
+    static const uint32_t flags[] = { 0, GFX_BF_BIG_ENDIAN };
+    gfxPixelBuffer buf;
+    gfxRect clipped;
+    uint16_t clr = 0x1234;
+    uint32_t r, f;
+    int32_t x, y;
+
+    for(f = 0; f < 2; f++)
+    {
+        for(r = 0; r < sizeof(rects) / sizeof(rects[0]); r++)
+        {
+            destCreate(&buf, flags[f]);
+
+            HOST_TEST_EQUAL(DRV_SSD1351_GPU_FillRect(&buf, &rects[r], clr), GFX_SUCCESS);
+
+            clipped = rects[r];
+
+            for(y = 0; y < BUF_HEIGHT; y++)
+            {
+                for(x = 0; x < BUF_WIDTH; x++)
+                {
+                    if(x >= clipped.x && x < clipped.x + clipped.width &&
+                       y >= clipped.y && y < clipped.y + clipped.height)
+                    {
+                        expect[y * BUF_WIDTH + x] = flags[f] != 0 ? swap(clr) : clr;
+                    }
+                }
+            }
+
+            checkDest();
+        }
+    }
+}
+
+static void testBlit(void)
+{
+    static const gfxRect srcRects[] =
+    {
+        { 0, 0, BUF_WIDTH, BUF_HEIGHT - 1 },
+        { 3, 1, 5, 3 },
+        { 1, 2, 4, 3 },
+    };
+    static const gfxRect destRects[] =
+    {
+        { 0, 0, BUF_WIDTH, BUF_HEIGHT - 1 },
+        { 1, 2, 5, 3 },
+        { -2, 4, 4, 3 },    // clipped left and bottom
+    };
+    static const uint32_t flags[] = { 0, GFX_BF_BIG_ENDIAN };
+    gfxPixelBuffer src, buf;
+    uint32_t r, sf, df;
+    int32_t x, y, sx, sy;
+    uint16_t clr;
+
+    for(sf = 0; sf < 2; sf++)
+    {
+        for(df = 0; df < 2; df++)
+        {
+            for(r = 0; r < sizeof(srcRects) / sizeof(srcRects[0]); r++)
+            {
+                gfxPixelBufferCreate(SRC_WIDTH, SRC_HEIGHT, GFX_COLOR_MODE_RGB_565, source, &src);
+
+                src.flags = flags[sf];
+
+                for(x = 0; x < SRC_WIDTH * SRC_HEIGHT; x++)
+                {
+                    source[x] = (uint16_t)(0x0100 * x + 7);
+                }
+
+                destCreate(&buf, flags[df]);
+
+                HOST_TEST_EQUAL(DRV_SSD1351_GPU_BlitBuffer(&src, &srcRects[r], &buf, &destRects[r]),
+                                GFX_SUCCESS);
+
+                for(y = 0; y < destRects[r].height; y++)
+                {
+                    for(x = 0; x < destRects[r].width; x++)
+                    {
+                        sx = srcRects[r].x + x;
+                        sy = srcRects[r].y + y;
+
+                        if(destRects[r].x + x < 0 || destRects[r].x + x >= BUF_WIDTH ||
+                           destRects[r].y + y < 0 || destRects[r].y + y >= BUF_HEIGHT)
+                            continue;
+
+                        clr = source[sy * SRC_WIDTH + sx];
+
+                        if(flags[sf] != flags[df])
+                        {
+                            clr = swap(clr);
+                        }
+
+                        expect[(destRects[r].y + y) * BUF_WIDTH + destRects[r].x + x] = clr;
+                    }
+                }
+
+                checkDest();
+            }
+        }
+    }
+}
+
+/* blending, global alpha, other formats and scaling are left to Legato */
+static void testRefused(void)
+{
+    gfxPixelBuffer src, buf;
+    gfxRect rect = { 0, 0, 4, 4 };
+    gfxRect big = { 0, 0, 5, 4 };
+    gfxRect outside = { SRC_WIDTH - 2, 0, 4, 4 };
+
+    gfxPixelBufferCreate(SRC_WIDTH, SRC_HEIGHT, GFX_COLOR_MODE_RGB_565, source, &src);
+    destCreate(&buf, 0);
+
+    DRV_SSD1351_GPU_SetBlend(GFX_BLEND_SRC_OVER);
+    HOST_TEST_EQUAL(DRV_SSD1351_GPU_FillRect(&buf, &rect, 0), GFX_FAILURE);
+    HOST_TEST_EQUAL(DRV_SSD1351_GPU_BlitBuffer(&src, &rect, &buf, &rect), GFX_FAILURE);
+    DRV_SSD1351_GPU_SetBlend(GFX_BLEND_NONE);
+
+    DRV_SSD1351_GPU_SetGlobalAlpha(GFX_GLOBAL_ALPHA_SCALE, GFX_GLOBAL_ALPHA_OFF, 128, 255);
+    HOST_TEST_EQUAL(DRV_SSD1351_GPU_FillRect(&buf, &rect, 0), GFX_FAILURE);
+    DRV_SSD1351_GPU_SetGlobalAlpha(GFX_GLOBAL_ALPHA_SCALE, GFX_GLOBAL_ALPHA_OFF, 255, 255);
+    HOST_TEST_EQUAL(DRV_SSD1351_GPU_FillRect(&buf, &rect, 0), GFX_SUCCESS);
+    DRV_SSD1351_GPU_SetGlobalAlpha(GFX_GLOBAL_ALPHA_OFF, GFX_GLOBAL_ALPHA_OFF, 255, 255);
+
+    HOST_TEST_EQUAL(DRV_SSD1351_GPU_BlitBuffer(&src, &rect, &buf, &big), GFX_FAILURE);
+    HOST_TEST_EQUAL(DRV_SSD1351_GPU_BlitBuffer(&src, &outside, &buf, &rect), GFX_FAILURE);
+
+    src.mode = GFX_COLOR_MODE_RGB_888;
+    HOST_TEST_EQUAL(DRV_SSD1351_GPU_BlitBuffer(&src, &rect, &buf, &rect), GFX_FAILURE);
+
+    buf.mode = GFX_COLOR_MODE_RGB_888;
+    HOST_TEST_EQUAL(DRV_SSD1351_GPU_FillRect(&buf, &rect, 0), GFX_FAILURE);
+}
+
+static gfxResult countFill(gfxPixelBuffer* dest, const gfxRect* rect, const gfxColor color)
+{
+    gfxResult res = DRV_SSD1351_GPU_FillRect(dest, rect, color);
+
+    fills++;
+    fillsRefused += res != GFX_SUCCESS;
+
+    return res;
+}
+
+static gfxResult countBlit(const gfxPixelBuffer* src,
+                           const gfxRect* srcRect,
+                           const gfxPixelBuffer* dest,
+                           const gfxRect* destRect)
+{
+    gfxResult res = DRV_SSD1351_GPU_BlitBuffer(src, srcRect, dest, destRect);
+
+    blits++;
+    blitsRefused += res != GFX_SUCCESS;
+
+    return res;
+}
+
+static const gfxGraphicsProcessor countingGPU =
+{
+    .fillRect = countFill,
+    .blitBuffer = countBlit,
+    .setBlend = DRV_SSD1351_GPU_SetBlend,
+    .setGlobalAlpha = DRV_SSD1351_GPU_SetGlobalAlpha,
+};
+
+/* repaints the whole screen, returns the CPU time in microseconds */
+static double repaint(void)
+{
+    clock_t start = clock();
+
+    Screen0_BackgroundPanel->fn->invalidate(Screen0_BackgroundPanel);
+
+    HOST_APP_RunUntilIdle(1000);
+
+    return (double)(clock() - start) * 1000000.0 / CLOCKS_PER_SEC;
+}
+
+static void testScreen0(void)
+{
+    static uint16_t gpuFrame[HOST_APP_WIDTH * HOST_APP_HEIGHT];
+    double gpuTime, cpuTime;
+
+    HOST_APP_Initialize();
+    HOST_APP_BleText(2, "GPU test");
+    HOST_APP_RunUntilIdle(1000);
+
+    leRenderer_SetGPUInterface(&countingGPU);
+
+    gpuTime = repaint();
+
+    memcpy(gpuFrame, HOST_APP_Frame(), sizeof(gpuFrame));
+
+    HOST_TEST_CHECK(fills > fillsRefused);
+
+    leRenderer_SetGPUInterface(&gfxGPUInterface);
+
+    cpuTime = repaint();
+
+    HOST_TEST_CHECK(memcmp(gpuFrame, HOST_APP_Frame(), sizeof(gpuFrame)) == 0);
+
+    printf("Screen0 repaint: %u fills (%u refused), %u copies (%u refused), "
+           "%.0f us with the GPU interface, %.0f us without\n",
+           (unsigned)fills,
+           (unsigned)fillsRefused,
+           (unsigned)blits,
+           (unsigned)blitsRefused,
+           gpuTime,
+           cpuTime);
+}
+
+static void captureScene(const leRect* frame)
+{
+    int32_t x, y;
+
+    for(y = frame->y; y < frame->y + frame->height; y++)
+    {
+        for(x = frame->x; x < frame->x + frame->width; x++)
+        {
+            scene[y * HOST_APP_WIDTH + x] = (uint16_t)leRenderer_GetPixel(x, y);
+        }
+    }
+}
+
+/* the panel shows what Legato draws, wherever the start line is */
+static void checkPanel(void)
+{
+    HOST_PAINT_Run(captureScene);
+
+    HOST_TEST_CHECK(memcmp(scene, HOST_APP_Frame(), sizeof(scene)) == 0);
+}
+
+static void termSetLine(uint32_t line, const char* text)
+{
+    termString.fn->setFromCStr(&termString, text);
+
+    termField[line]->fn->setString(termField[line], (leString*)&termString);
+}
+
+static void termCreate(void)
+{
+    leWidget* term;
+    uint32_t i;
+
+    leFixedString_Constructor(&termString, termChars, TERM_CHARS);
+
+    term = leWidget_New();
+    term->fn->setSize(term, HOST_APP_WIDTH, HOST_APP_HEIGHT);
+    term->fn->setScheme(term, &WhiteScheme);
+
+    for(i = 0; i < TERM_LINES; i++)
+    {
+        termField[i] = leTextFieldWidget_New();
+        termField[i]->fn->setPosition(termField[i], 0, i * TERM_LINE_H);
+        termField[i]->fn->setSize(termField[i], HOST_APP_WIDTH, TERM_LINE_H);
+        termField[i]->fn->setScheme(termField[i], &WhiteScheme);
+        termField[i]->fn->setBorderType(termField[i], LE_WIDGET_BORDER_NONE);
+        termField[i]->fn->setHAlignment(termField[i], LE_HALIGN_LEFT);
+        termField[i]->fn->setFont(termField[i], (leFont*)&NotoSans_Bold);
+        term->fn->addChild(term, (leWidget*)termField[i]);
+
+        termSetLine(i, termText[i]);
+    }
+
+    termNext = TERM_LINES;
+
+    leAddRootWidget(term, 0);
+    HOST_APP_RunUntilIdle(1000);
+}
+
+/* moves every line up by one and adds the next one at the bottom, returns
+   the SPI bytes it took */
+static uint32_t termPush(leBool scroll)
+{
+    HOST_SPI_STATS spi;
+    uint32_t i;
+
+    HOST_SPI_ResetStats();
+
+    for(i = 0; i < TERM_LINES; i++)
+    {
+        termSetLine(i, termText[(termNext - TERM_LINES + 1 + i) %
+                                (sizeof(termText) / sizeof(termText[0]))]);
+    }
+
+    termNext++;
+
+    if(scroll == LE_TRUE)
+    {
+        HOST_TEST_EQUAL(leRenderer_ScrollDisplay(TERM_LINE_H), LE_SUCCESS);
+    }
+
+    HOST_APP_RunUntilIdle(1000);
+
+    HOST_SPI_GetStats(&spi);
+
+    return spi.commandBytes + spi.dataBytes;
+}
+
+static void testScroll(void)
+{
+    uint32_t repaintBytes = 0;
+    uint32_t scrollBytes = 0;
+    uint32_t i;
+
+    termCreate();
+    checkPanel();
+
+    for(i = 0; i < TERM_PUSHES; i++)
+    {
+        repaintBytes += termPush(LE_FALSE);
+    }
+
+    checkPanel();
+    HOST_TEST_EQUAL(HOST_SPI_StartLine(), 0x20);
+
+    /* 8 lines of 24 rows wrap around the 128 GRAM rows */
+    for(i = 0; i < TERM_PUSHES; i++)
+    {
+        scrollBytes += termPush(LE_TRUE);
+
+        checkPanel();
+    }
+
+    HOST_TEST_EQUAL(HOST_SPI_StartLine(), (0x20 + TERM_PUSHES * TERM_LINE_H) % 128);
+
+    /* only the line scrolled into view goes out, less once its GRAM rows
+       still hold the line that scrolled out of view there */
+    HOST_TEST_CHECK(scrollBytes < repaintBytes);
+    HOST_TEST_CHECK(scrollBytes < TERM_PUSHES * (LINE_BYTES + SETUP_BYTES));
+
+    printf("%u terminal lines: %u SPI bytes with the hardware scroll, "
+           "%u repainting the shifted lines, %u pushing the whole window\n",
+           (unsigned)TERM_PUSHES,
+           (unsigned)scrollBytes,
+           (unsigned)repaintBytes,
+           (unsigned)(TERM_PUSHES * WINDOW_BYTES));
+}
+
+static void testClear(void)
+{
+    gfxIOCTLArg_TransferStats before, after;
+    HOST_SPI_STATS spi;
+    uint32_t pushBytes;
+
+    gfxDriverInterface.ioctl(GFX_IOCTL_GET_TRANSFER_STATS, &before);
+    HOST_SPI_ResetStats();
+
+    termSetLine(1, "");
+    HOST_APP_RunUntilIdle(1000);
+
+    HOST_SPI_GetStats(&spi);
+    gfxDriverInterface.ioctl(GFX_IOCTL_GET_TRANSFER_STATS, &after);
+
+    checkPanel();
+
+    /* every pixel of the blits, sent or not */
+    pushBytes = (after.bytesSent + after.bytesSkipped) -
+                (before.bytesSent + before.bytesSkipped);
+
+    HOST_TEST_CHECK(pushBytes > 0);
+    HOST_TEST_CHECK(spi.commandBytes + spi.dataBytes < pushBytes);
+
+    printf("line clear: %u SPI bytes for the fill, %u pushing its pixels\n",
+           (unsigned)(spi.commandBytes + spi.dataBytes),
+           (unsigned)pushBytes);
+}
+
+int main(void)
+{
+    testFill();
+    testBlit();
+    testRefused();
+    testScreen0();
+    testScroll();
+    testClear();
+
+    printf("test_gpu: passed\n");
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  Screen0 Host Test
+
+  File Name:
+    test_screen0.c
+
+  Summary:
+    Draws Screen0 on the mock display and changes its text lines.
+
+  Description:
+    Checks that the first frame draws something, that a text change only
+    sends the part of the screen it damages, that the display counters add
+    up and that a frame can be dumped to PNG.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "definitions.h"
+#include "host_app.h"
+#include "host_png.h"
+#include "host_test.h"
+#ifdef HOST_DISPLAY_SSD1351
+#include "host_spi.h"
+#endif
+
+static uint16_t before[HOST_APP_WIDTH * HOST_APP_HEIGHT];
+
+static uint32_t litPixels(const uint16_t* frame)
+{
+    uint32_t i, count = 0;
+
+    for(i = 0; i < HOST_APP_WIDTH * HOST_APP_HEIGHT; i++)
+    {
+        count += frame[i] != 0;
+    }
+
+    return count;
+}
+
+/* rows between first and last that differ from before */
+static void changedRows(const uint16_t* frame, int32_t* first, int32_t* last)
+{
+    int32_t y;
+
+    *first = -1;
+    *last = -1;
+
+    for(y = 0; y < HOST_APP_HEIGHT; y++)
+    {
+        if(memcmp(&frame[y * HOST_APP_WIDTH],
+                  &before[y * HOST_APP_WIDTH],
+                  HOST_APP_WIDTH * sizeof(uint16_t)) != 0)
+        {
+            if(*first < 0)
+                *first = y;
+
+            *last = y;
+        }
+    }
+}
+
+static void resetDisplay(void)
+{
+#ifdef HOST_DISPLAY_SSD1351
+    HOST_SPI_ResetStats();
+#else
+    HOST_Display_ResetStats();
+#endif
+}
+
+/* checks that the display counters add up, returns the pixels sent */
+static uint32_t checkDisplay(void)
+{
+#ifdef HOST_DISPLAY_SSD1351
+    HOST_SPI_STATS spi;
+
+    HOST_SPI_GetStats(&spi);
+
+    /* a window is three commands with two parameters each for the column
+       and row addresses */
+    HOST_TEST_EQUAL(spi.violations, 0);
+    HOST_TEST_EQUAL(spi.commandBytes, 3 * spi.windows);
+    HOST_TEST_EQUAL(spi.dataBytes, 4 * spi.windows + 2 * spi.pixels);
+
+    return spi.pixels;
+#else
+    HOST_DISPLAY_STATS stats;
+
+    HOST_Display_GetStats(&stats);
+
+    HOST_TEST_EQUAL(stats.bytes, 7 * stats.blits + 2 * stats.pixels);
+
+    return stats.pixels;
+#endif
+}
+
+int main(void)
+{
+    int32_t first, last;
+    uint32_t pixels;
+    leRect line1, line2;
+    uint8_t sig[8];
+    FILE* file;
+
+    HOST_APP_Initialize();
+
+    HOST_TEST_CHECK(HOST_APP_IsIdle() == true);
+
+    HOST_TEST_CHECK(litPixels(HOST_APP_Frame()) > 0);
+
+    ((leWidget*)Screen0_txtStr1)->fn->localRect((leWidget*)Screen0_txtStr1, &line1);
+    ((leWidget*)Screen0_txtStr2)->fn->localRect((leWidget*)Screen0_txtStr2, &line2);
+
+    ((leWidget*)Screen0_txtStr1)->fn->rectToScreen((leWidget*)Screen0_txtStr1, &line1);
+    ((leWidget*)Screen0_txtStr2)->fn->rectToScreen((leWidget*)Screen0_txtStr2, &line2);
+
+    /* the second line only redraws the second text field */
+    memcpy(before, HOST_APP_Frame(), sizeof(before));
+    resetDisplay();
+
+    HOST_TEST_CHECK(HOST_APP_BleText(2, "Hello") == true);
+    HOST_APP_RunUntilIdle(1000);
+
+    changedRows(HOST_APP_Frame(), &first, &last);
+
+    pixels = checkDisplay();
+
+    HOST_TEST_CHECK(pixels > 0);
+    HOST_TEST_CHECK(pixels < HOST_APP_WIDTH * HOST_APP_HEIGHT);
+    HOST_TEST_CHECK(first >= line2.y);
+    HOST_TEST_CHECK(last < line2.y + line2.height);
+
+    /* the same for the first line */
+    memcpy(before, HOST_APP_Frame(), sizeof(before));
+
+    HOST_TEST_CHECK(HOST_APP_BleText(1, "  CONNECTED  ") == true);
+    HOST_APP_RunUntilIdle(1000);
+
+    changedRows(HOST_APP_Frame(), &first, &last);
+
+    HOST_TEST_CHECK(first >= line1.y);
+    HOST_TEST_CHECK(last < line1.y + line1.height);
+
+    /* sending the text again changes nothing */
+    memcpy(before, HOST_APP_Frame(), sizeof(before));
+
+    HOST_TEST_CHECK(HOST_APP_BleText(1, "  CONNECTED  ") == true);
+    HOST_APP_RunUntilIdle(1000);
+
+    HOST_TEST_CHECK(memcmp(before, HOST_APP_Frame(), sizeof(before)) == 0);
+
+    HOST_TEST_EQUAL(HOST_PNG_Write("test_screen0.png", HOST_APP_Frame(),
+                                   HOST_APP_WIDTH, HOST_APP_HEIGHT), 0);
+
+    file = fopen("test_screen0.png", "rb");
+
+    HOST_TEST_CHECK(file != NULL);
+    HOST_TEST_EQUAL(fread(sig, 1, sizeof(sig), file), sizeof(sig));
+    HOST_TEST_CHECK(memcmp(sig, "\x89PNG\r\n\x1a\n", sizeof(sig)) == 0);
+
+    fclose(file);
+
+    printf("test_screen0: passed\n");
+
+    return 0;
+}
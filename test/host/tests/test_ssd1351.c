@@ -0,0 +1,641 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+/*******************************************************************************
+  SSD1351 Driver Host Test
+
+  File Name:
+    test_ssd1351.c
+
+  Summary:
+    Sends scratch buffers through the SSD1351 driver to the SPI mock.
+
+  Description:
+    Checks the bytes each kind of blit puts on the wire, that the GRAM ends
+    up holding the buffer, and the order of completion: a blit returns while
+    its transfers are still running, the scratch buffer stays locked until
+    the last pixel has reached the controller and the blit callback comes
+    after that, once. The driver must never wait for a transfer by polling,
+    with the bus running at its real speed that would hang the test.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "definitions.h"
+#include "host_gpio.h"
+#include "host_spi.h"
+#include "host_test.h"
+
+#define WIDTH       96
+#define HEIGHT      96
+
+/* bytes of a window setup, column and row address and the RAM write */
+#define WINDOW_COMMAND_BYTES    3
+#define WINDOW_DATA_BYTES       4
+
+static uint16_t pixels[WIDTH * 32];
+static uint8_t indices[WIDTH * 16];
+static uint16_t colors[16];
+static gfxPixelBuffer buffer;
+
+static uint32_t callbacks;
+static gfxBool lockedInCallback;
+static gfxBool panelInCallback;
+static int32_t expectY;
+static int32_t expectRows;
+
+static uint16_t swap(uint16_t clr)
+{
+    return (uint16_t)((clr << 8) | (clr >> 8));
+}
+
+/* the color of a pixel of the test pattern, seed keeps blits apart */
+static uint16_t pattern(uint32_t seed, int32_t x, int32_t y)
+{
+    return (uint16_t)(seed * 0x1F3D + x * 0x0841 + y * 0x2001 + 1);
+}
+
+/* true if rows y to y + rows - 1 of the panel show the pattern */
+static gfxBool panelShows(uint32_t seed, int32_t y, int32_t rows)
+{
+    const uint16_t* panel = HOST_SPI_Panel();
+    int32_t row, col;
+
+    for(row = 0; row < rows; row++)
+    {
+        for(col = 0; col < WIDTH; col++)
+        {
+            if(panel[(y + row) * WIDTH + col] != pattern(seed, col, row))
+                return GFX_FALSE;
+        }
+    }
+
+    return GFX_TRUE;
+}
+
+/* true if rows y to y + rows - 1 of the panel show the big-endian buffer */
+static gfxBool panelShowsBuffer(int32_t y, int32_t rows)
+{
+    const uint16_t* panel = HOST_SPI_Panel();
+    int32_t row, col;
+
+    for(row = 0; row < rows; row++)
+    {
+        for(col = 0; col < WIDTH; col++)
+        {
+            if(panel[(y + row) * WIDTH + col] != swap(pixels[row * WIDTH + col]))
+                return GFX_FALSE;
+        }
+    }
+
+    return GFX_TRUE;
+}
+
+/* changes columns left to right of a row of the big-endian buffer */
+static void paint(uint32_t seed, int32_t row, int32_t left, int32_t right)
+{
+    int32_t col;
+
+    for(col = left; col <= right; col++)
+    {
+        pixels[row * WIDTH + col] = swap(pattern(seed, col, row));
+    }
+}
+
+static uint32_t seedInFlight;
+
+static void blitDone(void)
+{
+    callbacks++;
+
+    lockedInCallback = gfxPixelBuffer_IsLocked(&buffer);
+    panelInCallback = panelShows(seedInFlight, expectY, expectRows);
+}
+
+/* fills the RGB565 buffer with the pattern */
+static void fill(uint32_t seed, int32_t rows, gfxBool bigEndian)
+{
+    int32_t row, col;
+    uint16_t clr;
+
+    gfxPixelBufferCreate(WIDTH, rows, GFX_COLOR_MODE_RGB_565, pixels, &buffer);
+
+    for(row = 0; row < rows; row++)
+    {
+        for(col = 0; col < WIDTH; col++)
+        {
+            clr = pattern(seed, col, row);
+
+            pixels[row * WIDTH + col] = bigEndian == GFX_TRUE ? swap(clr) : clr;
+        }
+    }
+
+    buffer.flags = bigEndian == GFX_TRUE ? GFX_BF_BIG_ENDIAN : 0;
+
+    seedInFlight = seed;
+    expectRows = rows;
+}
+
+static gfxResult blit(int32_t y)
+{
+    expectY = y;
+
+    return DRV_SSD1351_BlitBuffer(0, y, &buffer);
+}
+
+static uint32_t status(void)
+{
+    gfxIOCTLArg_Value val;
+
+    DRV_SSD1351_IOCTL(GFX_IOCTL_GET_STATUS, &val);
+
+    return val.value.v_uint;
+}
+
+static void startup(void)
+{
+    gfxIOCTLArg_Value val;
+    HOST_SPI_STATS spi;
+
+    HOST_GPIO_Reset();
+    HOST_SPI_Reset();
+
+    DRV_SSD1351_Initialize();
+    DRV_SSD1351_Update();
+
+    HOST_TEST_EQUAL(status(), 0);
+
+    HOST_SPI_GetStats(&spi);
+
+    /* display on, remap and start line, configured at the slow clock and
+       switched to the fast one */
+    HOST_TEST_EQUAL(spi.commandBytes, 3);
+    HOST_TEST_EQUAL(spi.dataBytes, 2);
+    HOST_TEST_EQUAL(spi.setups, 2);
+    HOST_TEST_EQUAL(spi.violations, 0);
+    HOST_TEST_EQUAL(HOST_SPI_Remap(), 0x32);
+    HOST_TEST_EQUAL(HOST_SPI_StartLine(), 0x20);
+
+    val.value.v_pointer = (void*)blitDone;
+    DRV_SSD1351_IOCTL(GFX_IOCTL_SET_BLIT_CALLBACK, &val);
+}
+
+/* a big-endian buffer goes out in place after its window */
+static void testBlitBytes(void)
+{
+    HOST_SPI_STATS spi;
+
+    fill(1, 8, GFX_TRUE);
+
+    HOST_SPI_ResetStats();
+    callbacks = 0;
+
+    HOST_TEST_EQUAL(blit(0), GFX_SUCCESS);
+
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_EQUAL(callbacks, 1);
+    HOST_TEST_CHECK(lockedInCallback == GFX_FALSE);
+    HOST_TEST_CHECK(panelInCallback == GFX_TRUE);
+    HOST_TEST_EQUAL(spi.windows, 1);
+    HOST_TEST_EQUAL(spi.commandBytes, WINDOW_COMMAND_BYTES);
+    HOST_TEST_EQUAL(spi.dataBytes, WINDOW_DATA_BYTES + WIDTH * 8 * 2);
+    HOST_TEST_EQUAL(spi.pixels, WIDTH * 8);
+    HOST_TEST_EQUAL(spi.violations, 0);
+    HOST_TEST_EQUAL(spi.selects, 1);
+}
+
+/* the next band below carries on in the open window */
+static void testBandContinues(void)
+{
+    HOST_SPI_STATS spi;
+
+    fill(2, 8, GFX_TRUE);
+
+    HOST_SPI_ResetStats();
+    callbacks = 0;
+
+    HOST_TEST_EQUAL(blit(8), GFX_SUCCESS);
+
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_EQUAL(callbacks, 1);
+    HOST_TEST_CHECK(panelInCallback == GFX_TRUE);
+    HOST_TEST_EQUAL(spi.windows, 0);
+    HOST_TEST_EQUAL(spi.commandBytes, 0);
+    HOST_TEST_EQUAL(spi.dataBytes, WIDTH * 8 * 2);
+}
+
+/* a buffer in CPU byte order is swapped a chunk at a time from the
+   transfer callback */
+static void testSwappedChunks(void)
+{
+    HOST_SPI_STATS spi;
+
+    fill(3, 4, GFX_FALSE);
+
+    HOST_SPI_ResetStats();
+    callbacks = 0;
+
+    HOST_TEST_EQUAL(blit(16), GFX_SUCCESS);
+
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_EQUAL(callbacks, 1);
+    HOST_TEST_CHECK(lockedInCallback == GFX_FALSE);
+    HOST_TEST_CHECK(panelInCallback == GFX_TRUE);
+    HOST_TEST_EQUAL(spi.dataBytes, WIDTH * 4 * 2);
+    HOST_TEST_EQUAL(spi.transfers, 4);
+}
+
+/* with the bus running at its real speed the blit returns first, the
+   buffer is released and the callback made once the pixels are in GRAM */
+static void testCompletionOrder(void)
+{
+    HOST_SPI_STATS spi;
+    gfxPixelBuffer other;
+
+    fill(4, 8, GFX_TRUE);
+
+    HOST_SPI_SetMode(HOST_SPI_TIMED);
+    HOST_SPI_ResetStats();
+    callbacks = 0;
+
+    HOST_TEST_EQUAL(blit(40), GFX_SUCCESS);
+
+    HOST_TEST_EQUAL(callbacks, 0);
+    HOST_TEST_CHECK(gfxPixelBuffer_IsLocked(&buffer) == GFX_TRUE);
+    HOST_TEST_EQUAL(status(), 1);
+    HOST_TEST_CHECK(panelShows(4, 40, 8) == GFX_FALSE);
+
+    /* the driver takes one blit at a time */
+    gfxPixelBufferCreate(WIDTH, 1, GFX_COLOR_MODE_RGB_565, indices, &other);
+    HOST_TEST_EQUAL(DRV_SSD1351_BlitBuffer(0, 0, &other), GFX_FAILURE);
+
+    /* 4 MHz moves half a byte a microsecond */
+    HOST_SPI_Run(100);
+
+    HOST_TEST_EQUAL(callbacks, 0);
+    HOST_TEST_CHECK(gfxPixelBuffer_IsLocked(&buffer) == GFX_TRUE);
+
+    HOST_SPI_Run(WIDTH * 8 * 2 * 2);
+
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_CHECK(HOST_SPI_IsIdle() == true);
+    HOST_TEST_EQUAL(callbacks, 1);
+    HOST_TEST_CHECK(lockedInCallback == GFX_FALSE);
+    HOST_TEST_CHECK(panelInCallback == GFX_TRUE);
+    HOST_TEST_EQUAL(status(), 0);
+    HOST_TEST_EQUAL(spi.violations, 0);
+    HOST_TEST_EQUAL(spi.wireNs, (uint64_t)spi.dataBytes * 2000 + spi.commandBytes * 2000);
+
+    HOST_SPI_SetMode(HOST_SPI_IMMEDIATE);
+}
+
+/* palette indexed buffers are expanded on the way out */
+static void testIndexed(void)
+{
+    static const gfxColorMode modes[] =
+    {
+        GFX_COLOR_MODE_INDEX_1,
+        GFX_COLOR_MODE_INDEX_4,
+        GFX_COLOR_MODE_INDEX_8
+    };
+    static const uint32_t bpp[] = { 1, 4, 8 };
+    gfxIOCTLArg_Palette pal;
+    const uint16_t* panel;
+    uint32_t m, i, idx, shift;
+    int32_t row, col;
+
+    for(i = 0; i < 16; i++)
+    {
+        colors[i] = pattern(5, i, 0);
+    }
+
+    pal.palette = (gfxBuffer*)colors;
+    pal.mode = GFX_COLOR_MODE_RGB_565;
+    pal.colorCount = 16;
+
+    HOST_TEST_EQUAL(DRV_SSD1351_IOCTL(GFX_IOCTL_SET_PALETTE, &pal), GFX_IOCTL_OK);
+
+    for(m = 0; m < 3; m++)
+    {
+        for(i = 0; i < sizeof(indices); i++)
+        {
+            indices[i] = (uint8_t)(i * 7 + m * 3 + (i >> 3));
+        }
+
+        if(bpp[m] == 8)
+        {
+            for(i = 0; i < sizeof(indices); i++)
+            {
+                indices[i] &= 0xF;
+            }
+        }
+
+        gfxPixelBufferCreate(WIDTH, 4, modes[m], indices, &buffer);
+
+        callbacks = 0;
+
+        HOST_TEST_EQUAL(DRV_SSD1351_BlitBuffer(0, 60, &buffer), GFX_SUCCESS);
+        HOST_TEST_EQUAL(callbacks, 1);
+
+        panel = HOST_SPI_Panel();
+
+        for(row = 0; row < 4; row++)
+        {
+            for(col = 0; col < WIDTH; col++)
+            {
+                i = row * WIDTH + col;
+
+                switch(bpp[m])
+                {
+                    case 1:
+                        shift = 7 - (i & 0x7);
+                        idx = (indices[i >> 3] >> shift) & 0x1;
+                        break;
+                    case 4:
+                        shift = (i & 0x1) ? 0 : 4;
+                        idx = (indices[i >> 1] >> shift) & 0xF;
+                        break;
+                    default:
+                        idx = indices[i];
+                        break;
+                }
+
+                HOST_TEST_EQUAL(panel[(60 + row) * WIDTH + col], colors[idx]);
+            }
+        }
+    }
+}
+
+/* a failed transfer still releases the buffer and calls back, and the next
+   blit sets its window up again */
+static void testTransferError(void)
+{
+    HOST_SPI_STATS spi;
+
+    fill(6, 4, GFX_TRUE);
+
+    HOST_SPI_FailTransfers(1);
+    callbacks = 0;
+
+    HOST_TEST_EQUAL(blit(70), GFX_SUCCESS);
+
+    HOST_TEST_EQUAL(callbacks, 1);
+    HOST_TEST_CHECK(lockedInCallback == GFX_FALSE);
+    HOST_TEST_EQUAL(status(), 0);
+
+    fill(7, 4, GFX_TRUE);
+
+    HOST_SPI_ResetStats();
+
+    HOST_TEST_EQUAL(blit(74), GFX_SUCCESS);
+
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_EQUAL(spi.windows, 1);
+    HOST_TEST_CHECK(panelShows(7, 74, 4) == GFX_TRUE);
+}
+
+/* a refused transfer fails the blit and leaves the buffer unlocked */
+static void testRefused(void)
+{
+    fill(8, 4, GFX_TRUE);
+
+    HOST_SPI_RefuseTransfers(1);
+    callbacks = 0;
+
+    HOST_TEST_EQUAL(blit(80), GFX_FAILURE);
+
+    HOST_TEST_EQUAL(callbacks, 0);
+    HOST_TEST_CHECK(gfxPixelBuffer_IsLocked(&buffer) == GFX_FALSE);
+    HOST_TEST_EQUAL(status(), 0);
+
+    HOST_TEST_EQUAL(blit(80), GFX_SUCCESS);
+    HOST_TEST_CHECK(panelShows(8, 80, 4) == GFX_TRUE);
+}
+
+/* a strided region with more rows than a batch holds goes out a batch at a
+   time from the transfer callback */
+static void testStridedRows(void)
+{
+    HOST_SPI_STATS spi;
+    int32_t row;
+    uint32_t us;
+
+    fill(9, 20, GFX_TRUE);
+
+    HOST_TEST_EQUAL(blit(20), GFX_SUCCESS);
+
+    /* only columns 10 to 19 change, so each row is sent on its own */
+    for(row = 0; row < 20; row++)
+    {
+        paint(10, row, 10, 19);
+    }
+
+    HOST_SPI_SetMode(HOST_SPI_TIMED);
+    HOST_SPI_ResetStats();
+    callbacks = 0;
+
+    HOST_TEST_EQUAL(blit(20), GFX_SUCCESS);
+
+    HOST_TEST_EQUAL(callbacks, 0);
+    HOST_TEST_CHECK(gfxPixelBuffer_IsLocked(&buffer) == GFX_TRUE);
+
+    for(us = 0; us < 10000 && HOST_SPI_IsIdle() == false; us += 10)
+    {
+        HOST_SPI_Run(10);
+    }
+
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_CHECK(HOST_SPI_IsIdle() == true);
+    HOST_TEST_EQUAL(callbacks, 1);
+    HOST_TEST_CHECK(lockedInCallback == GFX_FALSE);
+    HOST_TEST_EQUAL(status(), 0);
+    HOST_TEST_EQUAL(spi.windows, 1);
+    HOST_TEST_EQUAL(spi.dataBytes, WINDOW_DATA_BYTES + 10 * 20 * 2);
+    HOST_TEST_EQUAL(spi.selects, 2);
+    HOST_TEST_EQUAL(spi.violations, 0);
+    HOST_TEST_CHECK(panelShowsBuffer(20, 20) == GFX_TRUE);
+
+    HOST_SPI_SetMode(HOST_SPI_IMMEDIATE);
+}
+
+/* changes far apart get a window each, changes close together share one */
+static void testSpans(void)
+{
+    HOST_SPI_STATS spi;
+
+    fill(11, 12, GFX_TRUE);
+
+    HOST_TEST_EQUAL(blit(84), GFX_SUCCESS);
+
+    /* two glyphs in different rows and columns */
+    paint(12, 1, 5, 10);
+    paint(12, 2, 5, 10);
+    paint(12, 8, 60, 70);
+    paint(12, 9, 60, 70);
+
+    HOST_SPI_ResetStats();
+    callbacks = 0;
+
+    HOST_TEST_EQUAL(blit(84), GFX_SUCCESS);
+
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_EQUAL(callbacks, 1);
+    HOST_TEST_EQUAL(spi.windows, 2);
+    HOST_TEST_EQUAL(spi.pixels, 2 * 6 + 2 * 11);
+    HOST_TEST_EQUAL(spi.dataBytes, 2 * WINDOW_DATA_BYTES + (2 * 6 + 2 * 11) * 2);
+    HOST_TEST_EQUAL(spi.violations, 0);
+    HOST_TEST_CHECK(panelShowsBuffer(84, 12) == GFX_TRUE);
+
+    /* a slanted edge, a second window costs more than the extra columns */
+    paint(13, 3, 10, 19);
+    paint(13, 4, 11, 20);
+
+    HOST_SPI_ResetStats();
+
+    HOST_TEST_EQUAL(blit(84), GFX_SUCCESS);
+
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_EQUAL(spi.windows, 1);
+    HOST_TEST_EQUAL(spi.pixels, 2 * 11);
+    HOST_TEST_CHECK(panelShowsBuffer(84, 12) == GFX_TRUE);
+
+    /* a window costs less than sending the unchanged row in between */
+    paint(14, 5, 0, WIDTH - 1);
+    paint(14, 7, 0, WIDTH - 1);
+
+    HOST_SPI_ResetStats();
+
+    HOST_TEST_EQUAL(blit(84), GFX_SUCCESS);
+
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_EQUAL(spi.windows, 2);
+    HOST_TEST_EQUAL(spi.pixels, 2 * WIDTH);
+    HOST_TEST_CHECK(panelShowsBuffer(84, 12) == GFX_TRUE);
+}
+
+/* pixels the panel already shows aren't sent again */
+static void testUnchanged(void)
+{
+    HOST_SPI_STATS spi;
+
+    fill(8, 4, GFX_TRUE);
+
+    HOST_SPI_ResetStats();
+
+    HOST_TEST_EQUAL(blit(80), GFX_SUCCESS);
+
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_EQUAL(spi.transfers, 0);
+}
+
+/* once scrolled, rows past the end of GRAM go to its top, a window for
+   each part. A scroll with nothing new to draw still goes out */
+static void testScroll(void)
+{
+    gfxIOCTLArg_Value val;
+    HOST_SPI_STATS spi;
+
+    val.value.v_int = 56;
+    HOST_TEST_EQUAL(DRV_SSD1351_IOCTL(GFX_IOCTL_SET_VERTICAL_SCROLL, &val), GFX_IOCTL_OK);
+
+    /* panel row 72 is shown from GRAM row 0 */
+    fill(9, 16, GFX_FALSE);
+
+    HOST_SPI_ResetStats();
+    callbacks = 0;
+
+    HOST_TEST_EQUAL(blit(64), GFX_SUCCESS);
+
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_EQUAL(callbacks, 1);
+    HOST_TEST_CHECK(lockedInCallback == GFX_FALSE);
+    HOST_TEST_CHECK(panelInCallback == GFX_TRUE);
+    HOST_TEST_EQUAL(HOST_SPI_StartLine(), 0x20 + 56);
+    HOST_TEST_EQUAL(spi.windows, 2);
+    HOST_TEST_EQUAL(spi.pixels, WIDTH * 16);
+    HOST_TEST_EQUAL(spi.violations, 0);
+
+    fill(10, 16, GFX_TRUE);
+
+    HOST_SPI_ResetStats();
+    callbacks = 0;
+
+    HOST_TEST_EQUAL(blit(68), GFX_SUCCESS);
+
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_EQUAL(callbacks, 1);
+    HOST_TEST_CHECK(panelInCallback == GFX_TRUE);
+    HOST_TEST_EQUAL(spi.windows, 2);
+    HOST_TEST_EQUAL(spi.pixels, WIDTH * 16);
+
+    /* a full turn of GRAM leaves the picture where it is */
+    val.value.v_int = 128;
+    HOST_TEST_EQUAL(DRV_SSD1351_IOCTL(GFX_IOCTL_SET_VERTICAL_SCROLL, &val), GFX_IOCTL_OK);
+
+    HOST_SPI_ResetStats();
+    callbacks = 0;
+
+    HOST_TEST_EQUAL(blit(68), GFX_SUCCESS);
+
+    HOST_SPI_GetStats(&spi);
+
+    HOST_TEST_EQUAL(callbacks, 1);
+    HOST_TEST_CHECK(lockedInCallback == GFX_FALSE);
+    HOST_TEST_CHECK(panelInCallback == GFX_TRUE);
+    HOST_TEST_EQUAL(spi.commandBytes, 1);
+    HOST_TEST_EQUAL(spi.dataBytes, 1);
+    HOST_TEST_EQUAL(spi.pixels, 0);
+}
+
+int main(void)
+{
+    startup();
+
+    testBlitBytes();
+    testBandContinues();
+    testSwappedChunks();
+    testCompletionOrder();
+    testIndexed();
+    testTransferError();
+    testRefused();
+    testUnchanged();
+    testStridedRows();
+    testSpans();
+    testScroll();
+
+    printf("test_ssd1351: passed\n");
+
+    return 0;
+}
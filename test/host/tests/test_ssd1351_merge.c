@@ -0,0 +1,198 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+  SSD1351 Window Merge Host Test
+
+  File Name:
+    test_ssd1351_merge.c
+
+  Summary:
+    Blits sets of rects through the SSD1351 driver and checks which of them
+    share a GRAM window.
+
+  Description:
+    A rect that starts below the window the last one left open, at the same
+    column and width, carries on in that window when the rows in between
+    cost fewer bytes than a new window. Those rows are sent from the shadow.
+    Each set starts from a panel the shadow fully knows, and the check is
+    the number of windows, the pixels put on the wire and the panel image.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "definitions.h"
+#include "host_gpio.h"
+#include "host_spi.h"
+#include "host_test.h"
+
+#define WIDTH       96
+#define HEIGHT      96
+#define MAX_RECTS   4
+
+typedef struct
+{
+    int32_t x;
+    int32_t y;
+    int32_t width;
+    int32_t height;
+} RECT;
+
+typedef struct
+{
+    const char* name;
+    RECT rects[MAX_RECTS];
+    uint32_t count;
+    uint32_t windows;       // windows set up for the rects
+    uint32_t gapPixels;     // pixels sent from the shadow
+} RECT_SET;
+
+static const RECT_SET sets[] =
+{
+    /* the two text fields of Screen0 */
+    { "text fields",        { { 0, 28, 96, 12 }, { 0, 61, 96, 12 } }, 2, 2, 0 },
+    /* band split rect */
+    { "bands",              { { 0, 28, 96, 6 }, { 0, 34, 96, 6 } }, 2, 1, 0 },
+    /* a full row in between costs more than a window */
+    { "full row apart",     { { 0, 10, 96, 2 }, { 0, 13, 96, 2 } }, 2, 2, 0 },
+    /* a short row in between costs less */
+    { "column row apart",   { { 50, 10, 4, 4 }, { 50, 15, 4, 4 } }, 2, 1, 4 },
+    { "column two apart",   { { 50, 10, 4, 4 }, { 50, 16, 4, 4 } }, 2, 1, 8 },
+    /* three rows cost more than a window */
+    { "column three apart", { { 50, 10, 4, 4 }, { 50, 17, 4, 4 } }, 2, 2, 0 },
+    { "chain",              { { 70, 40, 2, 3 }, { 70, 44, 2, 3 }, { 70, 48, 2, 3 } }, 3, 1, 4 },
+    { "shifted column",     { { 50, 10, 4, 4 }, { 51, 15, 4, 4 } }, 2, 2, 0 },
+    { "above",              { { 50, 20, 4, 4 }, { 50, 10, 4, 4 } }, 2, 2, 0 },
+};
+
+static uint16_t screen[WIDTH * HEIGHT];
+static uint16_t pixels[WIDTH * HEIGHT];
+static uint16_t expect[WIDTH * HEIGHT];
+static uint32_t seed;
+
+static uint16_t swap(uint16_t clr)
+{
+    return (uint16_t)((clr << 8) | (clr >> 8));
+}
+
+static uint16_t pattern(int32_t x, int32_t y)
+{
+    return (uint16_t)(seed * 0x1F3D + x * 0x0841 + y * 0x2001 + 1);
+}
+
+/* blits a rect of new pixels and notes them in the expected image */
+static void blitRect(const RECT* rect)
+{
+    gfxPixelBuffer buf;
+    int32_t row, col;
+    uint16_t clr;
+
+    seed++;
+
+    gfxPixelBufferCreate(rect->width, rect->height, GFX_COLOR_MODE_RGB_565, pixels, &buf);
+    buf.flags = GFX_BF_BIG_ENDIAN;
+
+    for(row = 0; row < rect->height; row++)
+    {
+        for(col = 0; col < rect->width; col++)
+        {
+            clr = pattern(rect->x + col, rect->y + row);
+
+            pixels[row * rect->width + col] = swap(clr);
+            expect[(rect->y + row) * WIDTH + rect->x + col] = clr;
+        }
+    }
+
+    HOST_TEST_EQUAL(DRV_SSD1351_BlitBuffer(rect->x, rect->y, &buf), GFX_SUCCESS);
+}
+
+/* a freshly configured controller showing a full screen blit */
+static void startup(void)
+{
+    gfxPixelBuffer buf;
+    int32_t i;
+
+    HOST_GPIO_Reset();
+    HOST_SPI_Reset();
+
+    DRV_SSD1351_Initialize();
+    DRV_SSD1351_Update();
+
+    seed++;
+
+    for(i = 0; i < WIDTH * HEIGHT; i++)
+    {
+        expect[i] = pattern(i % WIDTH, i / WIDTH);
+        screen[i] = swap(expect[i]);
+    }
+
+    gfxPixelBufferCreate(WIDTH, HEIGHT, GFX_COLOR_MODE_RGB_565, screen, &buf);
+    buf.flags = GFX_BF_BIG_ENDIAN;
+
+    HOST_TEST_EQUAL(DRV_SSD1351_BlitBuffer(0, 0, &buf), GFX_SUCCESS);
+}
+
+static void testSet(const RECT_SET* set)
+{
+    HOST_SPI_STATS spi;
+    uint32_t i, area;
+
+    startup();
+
+    HOST_SPI_ResetStats();
+
+    for(i = 0, area = 0; i < set->count; i++)
+    {
+        blitRect(&set->rects[i]);
+
+        area += set->rects[i].width * set->rects[i].height;
+    }
+
+    HOST_SPI_GetStats(&spi);
+
+    printf("%-20s %u windows, %u pixels, %u bytes\n",
+           set->name,
+           (unsigned)spi.windows,
+           (unsigned)spi.pixels,
+           (unsigned)(spi.commandBytes + spi.dataBytes));
+
+    HOST_TEST_EQUAL(spi.windows, set->windows);
+    HOST_TEST_EQUAL(spi.pixels, area + set->gapPixels);
+    HOST_TEST_EQUAL(spi.violations, 0);
+    HOST_TEST_CHECK(memcmp(HOST_SPI_Panel(), expect, sizeof(expect)) == 0);
+}
+
+int main(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < sizeof(sets) / sizeof(sets[0]); i++)
+    {
+        testSet(&sets[i]);
+    }
+
+    printf("test_ssd1351_merge: passed\n");
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+/*******************************************************************************
+* Copyright (C) 2022 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+
+/*******************************************************************************
+  Legato Task Wakeup Host Test
+
+  File Name:
+    test_wakeups.c
+
+  Summary:
+    Measures the Legato task wakeups while idle and the time from a text
+    update to its pixels on the panel.
+
+  Description:
+    The Legato task blocks until damage or a finished blit notifies it, so
+    an idle screen must not wake it at all, where the old 10 ms polling
+    loop woke it 100 times a second. Each text update is then stepped one
+    millisecond at a time until the panel shows it and everything is idle,
+    and the milliseconds and wakeups it took are printed. Fails if the
+    task wakes while idle or an update takes longer than the frame period
+    plus the time to send the whole screen.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "definitions.h"
+#include "host_app.h"
+#include "host_test.h"
+
+#define IDLE_MS         10000
+#define STEP_LIMIT_MS   1000
+
+/* the update rate limit plus a full screen at the 4 MHz pixel clock */
+#define LATENCY_LIMIT_MS    (1000 / LE_COMMAND_MAX_FPS + 40)
+
+static uint16_t before[HOST_APP_WIDTH * HOST_APP_HEIGHT];
+
+static const char* texts[] =
+{
+    "Hello",
+    "12:34 21.5C",
+    "the quick brown fox",
+    "x",
+    "",
+};
+
+static void testIdle(void)
+{
+    HOST_APP_STATS stats;
+
+    HOST_APP_ResetStats();
+    HOST_APP_Run(IDLE_MS);
+    HOST_APP_GetStats(&stats);
+
+    printf("idle:    %u wakeups in %u ms, %.1f per second\n",
+           (unsigned)stats.wakeups,
+           (unsigned)IDLE_MS,
+           stats.wakeups * 1000.0 / IDLE_MS);
+
+    HOST_TEST_EQUAL(stats.wakeups, 0);
+}
+
+static void testLatency(void)
+{
+    HOST_APP_STATS stats;
+    uint32_t t, ms, worst = 0;
+
+    for(t = 0; t < sizeof(texts) / sizeof(texts[0]); t++)
+    {
+        memcpy(before, HOST_APP_Frame(), sizeof(before));
+
+        HOST_APP_ResetStats();
+        HOST_TEST_CHECK(HOST_APP_BleText(2, texts[t]) == true);
+
+        for(ms = 0; ms < STEP_LIMIT_MS; ms++)
+        {
+            HOST_APP_Run(1);
+
+            if(HOST_APP_IsIdle() == true &&
+               memcmp(before, HOST_APP_Frame(), sizeof(before)) != 0)
+                break;
+        }
+
+        HOST_APP_GetStats(&stats);
+
+        printf("update:  \"%s\" on the panel after %u ms, %u wakeups\n",
+               texts[t],
+               (unsigned)(ms + 1),
+               (unsigned)stats.wakeups);
+
+        HOST_TEST_CHECK(ms < STEP_LIMIT_MS);
+
+        if(ms + 1 > worst)
+        {
+            worst = ms + 1;
+        }
+
+        // idle until the rate limit has certainly passed
+        HOST_APP_Run(1000 / LE_COMMAND_MAX_FPS);
+    }
+
+    HOST_TEST_CHECK(worst <= LATENCY_LIMIT_MS);
+}
+
+int main(void)
+{
+    HOST_APP_Initialize();
+
+    testIdle();
+    testLatency();
+    testIdle();
+
+    return 0;
+}
@@ -0,0 +1,273 @@
+#!/usr/bin/env python3
+"""Run length encodes the glyph data of generated Legato raster fonts.
+
+Rewrites the fonts in a generated le_gen_fonts.c in place.  Every glyph whose
+encoded data is smaller than its raw rows is encoded and gets the
+LE_FONT_GLYPH_RLE flag, the others stay raw.  The glyph data is repacked
+without the per glyph padding and the kerning table offsets, the array sizes
+and the font data sizes are updated.  Only internal fonts are converted,
+streamed fonts are read a whole raw glyph at a time.
+
+The encoding is the one leFont_DecodeGlyphRow reads.  A control byte other
+than zero stands for (control >> 4) zero bytes followed by (control & 0xF)
+literal bytes.  A zero control byte is followed by a count and a value and
+stands for count + 1 copies of the value.
+
+Each font also gets its glyph lookup index, which leFont_GetGlyphInfo uses
+in place of a linear search: a direct index when the code points form one
+ascending range, a binary search when they ascend with gaps.
+
+Regenerating the font assets in MPLAB Harmony writes raw glyphs and no
+index, so run it again afterwards.  --decode turns the fonts back into raw
+glyphs in the generator's layout and keeps the index.
+
+    python3 tools/le_font_rle.py firmware/firmware/src/config/default/gfx/legato/generated/font/le_gen_fonts.c
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+GLYPH_RLE = 0x1
+GLYPH_SIZE = 20      # bytes per kerning table entry
+GLYPH_FLAGS = 12     # offset of the flags in an entry
+MAX_NIBBLE = 15
+MAX_REPEAT = 256
+MIN_REPEAT = 4       # a repeat packet costs three bytes
+
+ENCODED_NOTE = (r'* run length encoded font glyph data\n'
+                r' * written by tools/le_font_rle.py, regenerating the fonts in MHC\n'
+                r' * writes raw glyphs again, so run it afterwards\n')
+
+ARRAY = r'const uint8_t {name}_{kind}\[(\d+)\] =\s*\{{(.*?)\}};'
+
+
+def encode(data):
+    out = bytearray()
+    i = 0
+    n = len(data)
+
+    while i < n:
+        run = 1
+
+        while i + run < n and data[i + run] == data[i] and run < MAX_REPEAT:
+            run += 1
+
+        # zero runs up to 45 bytes are cheaper as zero nibbles
+        if run >= MIN_REPEAT and (data[i] != 0 or run > 3 * MAX_NIBBLE):
+            out += bytes([0, run - 1, data[i]])
+            i += run
+            continue
+
+        zeros = 0
+
+        while i < n and data[i] == 0 and zeros < MAX_NIBBLE:
+            zeros += 1
+            i += 1
+
+        start = i
+
+        while i < n and i - start < MAX_NIBBLE:
+            # leave zero pairs and repeats to the next packet
+            if data[i] == 0 and (i + 1 >= n or data[i + 1] == 0):
+                break
+
+            if data[i:i + MIN_REPEAT] == bytes([data[i]]) * MIN_REPEAT:
+                break
+
+            i += 1
+
+        out.append((zeros << 4) | (i - start))
+        out += data[start:i]
+
+    return bytes(out)
+
+
+def decode(data, size):
+    out = bytearray()
+    i = 0
+
+    while len(out) < size:
+        ctrl = data[i]
+        i += 1
+
+        if ctrl == 0:
+            out += bytes([data[i + 1]]) * (data[i] + 1)
+            i += 2
+        else:
+            out += bytes(ctrl >> 4)
+            out += data[i:i + (ctrl & 0xF)]
+            i += ctrl & 0xF
+
+    if len(out) != size:
+        raise ValueError('encoded glyph does not end on its last row')
+
+    return bytes(out)
+
+
+def read_array(source, name, kind):
+    match = re.search(ARRAY.format(name=name, kind=kind), source, re.S)
+
+    if match is None:
+        raise ValueError('%s_%s not found' % (name, kind))
+
+    data = bytes(int(x, 16) for x in re.findall(r'0x([0-9A-Fa-f]{2})', match.group(2)))
+
+    if len(data) != int(match.group(1)):
+        raise ValueError('%s_%s holds %d bytes, not %s' % (name, kind, len(data), match.group(1)))
+
+    return match, data
+
+
+def format_array(name, kind, data):
+    lines = ['const uint8_t %s_%s[%d] =' % (name, kind, len(data)), '{']
+
+    for i in range(0, len(data), 16):
+        lines.append('    ' + ''.join('0x%02X,' % b for b in data[i:i + 16]))
+
+    lines.append('};')
+
+    return '\n'.join(lines)
+
+
+def glyph_index(table, count):
+    codes = [struct.unpack_from('<H', table, 4 + idx * GLYPH_SIZE)[0] for idx in range(count)]
+
+    if count == 0 or any(b <= a for a, b in zip(codes, codes[1:])):
+        return 'LE_FONT_GLYPH_INDEX_NONE', 0
+
+    if codes[-1] - codes[0] == count - 1:
+        return 'LE_FONT_GLYPH_INDEX_RANGE', codes[0]
+
+    return 'LE_FONT_GLYPH_INDEX_SORTED', codes[0]
+
+
+def write_index(source, name, mode, first):
+    font = re.search(r'leRasterFont %s =\s*\{.*?\n\};' % name, source, re.S)
+    text = re.sub(r'\n    \{\n        LE_FONT_GLYPH_INDEX_\w+, // glyph lookup index\n.*?\n    \},', '',
+                  font.group(0), flags=re.S)
+
+    text = re.sub(r'(\n    %s_data, // kerning table)' % name,
+                  r'\1\n    {\n        %s, // glyph lookup index\n        0x%X, // first code point\n    },' %
+                  (mode, first),
+                  text)
+
+    return source[:font.start()] + text + source[font.end():]
+
+
+def convert_font(source, name, rle, max_row):
+    font = re.search(r'leRasterFont %s =\s*\{(.*?)\n\};' % name, source, re.S)
+
+    if 'LE_STREAM_LOCATION_ID_INTERNAL' not in font.group(1):
+        print('%s: not an internal font, skipped' % name)
+        return source
+
+    table_match, table = read_array(source, name, 'data')
+    glyph_match, glyphs = read_array(source, name, 'glyphs')
+
+    table = bytearray(table)
+    count = struct.unpack_from('<I', table, 0)[0]
+    packed = bytearray()
+    encoded = 0
+    padded = 0
+    unpadded = 0
+
+    for idx in range(count):
+        entry = 4 + idx * GLYPH_SIZE
+
+        height = struct.unpack_from('<h', table, entry + 4)[0]
+        flags, row_width, offset = struct.unpack_from('<HHI', table, entry + GLYPH_FLAGS)
+        size = row_width * height
+
+        if flags & GLYPH_RLE:
+            raw = decode(glyphs[offset:], size)
+        else:
+            raw = glyphs[offset:offset + size]
+
+        flags &= ~GLYPH_RLE
+        data = raw
+
+        padded += -padded % 4 + len(raw)
+        unpadded += len(raw)
+
+        if rle:
+            rle_data = encode(raw)
+
+            if len(rle_data) < len(raw) and row_width <= max_row:
+                flags |= GLYPH_RLE
+                data = rle_data
+                encoded += 1
+        else:
+            # the generator aligns every glyph to four bytes
+            packed += bytes(-len(packed) % 4)
+
+        struct.pack_into('<HHI', table, entry + GLYPH_FLAGS, flags, row_width, len(packed))
+
+        packed += data
+
+    if not rle:
+        packed += bytes(-len(packed) % 4)
+
+    padded += -padded % 4
+
+    if rle:
+        padding_saved = padded - unpadded
+        rle_saved = unpadded - len(packed)
+    else:
+        padding_saved = 0
+        rle_saved = 0
+
+    mode, first = glyph_index(table, count)
+
+    print('%s: %d of %d glyphs encoded, glyph data %d -> %d bytes '
+          '(raw %d, padding saves %d, RLE saves %d), %s' %
+          (name, encoded, count, len(glyphs), len(packed), padded,
+           padding_saved, rle_saved, mode))
+
+    source = (source[:glyph_match.start()] +
+              format_array(name, 'glyphs', packed) +
+              source[glyph_match.end():])
+
+    source = source.replace(table_match.group(0), format_array(name, 'data', table), 1)
+
+    source = re.sub(r'\* (raw|run length encoded) font glyph data\n(?: \*[^\n]*\n)*?'
+                    r'( \*+/\s*const uint8_t %s_glyphs)' % name,
+                    (ENCODED_NOTE if encoded > 0 else '* raw font glyph data\n') + r'\2',
+                    source)
+
+    source = re.sub(r'(\(void\*\)%s_glyphs, // glyph table variable pointer\s*)\d+' % name,
+                    r'\g<1>%d' % len(packed),
+                    source)
+
+    return write_index(source, name, mode, first)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('file', help='generated le_gen_fonts.c, rewritten in place')
+    parser.add_argument('--decode', action='store_true', help='restore raw glyphs')
+    parser.add_argument('--max-row', type=int, default=64,
+                        help='largest row in bytes to encode, LE_FONT_RLE_ROW_SIZE (default 64)')
+    args = parser.parse_args()
+
+    with open(args.file) as f:
+        source = f.read()
+
+    names = re.findall(r'^leRasterFont (\w+) =', source, re.M)
+
+    if len(names) == 0:
+        sys.exit('%s: no raster fonts found' % args.file)
+
+    for name in names:
+        source = convert_font(source, name, not args.decode, args.max_row)
+
+    if not args.decode:
+        print('regenerating the fonts in MHC writes raw glyphs and no index, run this again afterwards')
+
+    with open(args.file, 'w', newline='') as f:
+        f.write(source)
+
+
+if __name__ == '__main__':
+    main()